@@ -0,0 +1,115 @@
+//
+//  IMA ADPCM decoder
+//
+//! \file tonc_adpcm.s
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+// === NOTES ===
+@ * Standard IMA ADPCM: 4bit codes, low nibble first, 16bit predictor.
+@   Output is the top 8 bits of the predictor, for the mixer.
+@ * ~25 instructions per sample; about 30 cycles with the tables
+@   in IWRAM.
+
+	.file "tonc_adpcm.s"
+
+#include "tonc_asminc.hpp"
+
+@ Decode one nibble.
+@   \nib: code (only the low 4 bits are used)
+@   r4: predictor; r5: index; r6: step table; r7: index table
+@   r9: 0x7FFF
+.macro ADPCM_NIBBLE nib
+	mov		ip, r5, lsl #1
+	ldrh	ip, [r6, ip]			@ step
+	mov		lr, ip, lsr #3			@ diff= step/8
+	tst		\nib, #1
+	addne	lr, lr, ip, lsr #2
+	tst		\nib, #2
+	addne	lr, lr, ip, lsr #1
+	tst		\nib, #4
+	addne	lr, lr, ip
+	tst		\nib, #8
+	subne	r4, r4, lr
+	addeq	r4, r4, lr
+	@ Clamp predictor to s16
+	cmp		r4, r9
+	movgt	r4, r9
+	cmn		r4, #0x8000
+	mvnlt	r4, r9
+	@ Next index, clamped to [0, 88]
+	and		lr, \nib, #7
+	ldrsb	lr, [r7, lr]
+	adds	r5, r5, lr
+	movmi	r5, #0
+	cmp		r5, #88
+	movgt	r5, #88
+	@ Output
+	mov		lr, r4, asr #8
+	strb	lr, [r0], #1
+.endm
+
+@ === const u8 *adpcm_decode(s8 *dst, const u8 *src, uint nbytes, TAdpcmState *state);
+/*! \fn const u8 *adpcm_decode(s8 *dst, const u8 *src, uint nbytes, TAdpcmState *state) IWRAM_CODE;
+    \brief Decode IMA ADPCM to signed 8bit PCM.
+	\param dst	Destination; gets 2*\a nbytes samples.
+	\param src	ADPCM codes.
+	\param nbytes	Number of source bytes.
+	\param state	Predictor and step index; updated on return.
+	\return	Source pointer after the last byte decoded.
+*/
+/* Reglist:
+  r0: dst
+  r1: src
+  r2: nbytes
+  r3: state
+  r4: predictor
+  r5: step index
+  r6, r7: step and index tables
+  r8: source byte
+  r9: 0x7FFF
+  ip, lr: temps
+*/
+BEGIN_FUNC_ARM(adpcm_decode, CSEC_IWRAM)
+	cmp		r2, #0
+	moveq	r0, r1
+	bxeq	lr
+	stmfd	sp!, {r4-r9, lr}
+	ldmia	r3, {r4, r5}
+	ldr		r6, =.Ladpcm_steps
+	ldr		r7, =.Ladpcm_index
+	ldr		r9, =0x7FFF
+.Ladpcm_loop:
+		ldrb	r8, [r1], #1
+		ADPCM_NIBBLE r8
+		mov		r8, r8, lsr #4
+		ADPCM_NIBBLE r8
+		subs	r2, r2, #1
+		bne		.Ladpcm_loop
+	stmia	r3, {r4, r5}
+	mov		r0, r1
+	ldmfd	sp!, {r4-r9, lr}
+	bx		lr
+	.pool
+
+.Ladpcm_index:
+	.byte	-1, -1, -1, -1, 2, 4, 6, 8
+
+	.align 2
+.Ladpcm_steps:
+	.hword	    7,     8,     9,    10,    11,    12,    13,    14
+	.hword	   16,    17,    19,    21,    23,    25,    28,    31
+	.hword	   34,    37,    41,    45,    50,    55,    60,    66
+	.hword	   73,    80,    88,    97,   107,   118,   130,   143
+	.hword	  157,   173,   190,   209,   230,   253,   279,   307
+	.hword	  337,   371,   408,   449,   494,   544,   598,   658
+	.hword	  724,   796,   876,   963,  1060,  1166,  1282,  1411
+	.hword	 1552,  1707,  1878,  2066,  2272,  2499,  2749,  3024
+	.hword	 3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484
+	.hword	 7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899
+	.hword	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794
+	.hword	32767
+	.align 2
+END_FUNC(adpcm_decode)
+
+@ EOF
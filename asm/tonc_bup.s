@@ -0,0 +1,104 @@
+//
+//  Table-driven bit unpacking
+//
+//! \file tonc_bup.s
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+// === NOTES ===
+@ * The table is built by bup_unpack(); this just does the lookups.
+@   Each entry is the unpacked form of one group of source bits: a
+@   byte, a nybble or a bit pair, depending on how much the data
+@   grows. Source bits are taken low bits first, like BitUnPack.
+@ * Sources are read by byte, so they needn't be aligned.
+
+	.file "tonc_bup.s"
+
+#include "tonc_asminc.hpp"
+
+@ === void bup_expand(void *dst, const void *src, uint len, const u32 *lut, uint mode);
+/*! \fn void bup_expand(void *dst, const void *src, uint len, const u32 *lut, uint mode) IWRAM_CODE;
+    \brief Unpack \a len source bytes through a lookup table.
+	\param dst	Destination; word aligned.
+	\param src	Source.
+	\param len	Source length in bytes. Must be even for BUPX_8TO16.
+	\param lut	Lookup table.
+	\param mode	BUPX_8TO32: byte to word; BUPX_8TO16: byte to
+		halfword; BUPX_4TO32: nybble to word; BUPX_2TO32: bit pair
+		to word.
+*/
+/* Reglist:
+  r0: dst
+  r1: src
+  r2: len
+  r3: lut
+  r4-r7: unpacked words
+  ip: mode, then source byte
+*/
+BEGIN_FUNC_ARM(bup_expand, CSEC_IWRAM)
+	cmp		r2, #0
+	bxeq	lr
+	ldr		ip, [sp]
+	stmfd	sp!, {r4-r7}
+	cmp		ip, #1
+	beq		.Lbx_8to16
+	bhi		.Lbx_small
+
+	@ Byte -> word
+.Lbx_8to32:
+		ldrb	r4, [r1], #1
+		ldr		r4, [r3, r4, lsl #2]
+		str		r4, [r0], #4
+		subs	r2, r2, #1
+		bne		.Lbx_8to32
+	b		.Lbx_done
+
+	@ Byte pair -> halfword pair
+.Lbx_8to16:
+		ldrb	r4, [r1], #1
+		ldrb	r5, [r1], #1
+		ldr		r4, [r3, r4, lsl #2]
+		ldr		r5, [r3, r5, lsl #2]
+		orr		r4, r4, r5, lsl #16
+		str		r4, [r0], #4
+		subs	r2, r2, #2
+		bgt		.Lbx_8to16
+	b		.Lbx_done
+
+.Lbx_small:
+	cmp		ip, #2
+	bne		.Lbx_2to32
+
+	@ Nybbles -> 2 words
+.Lbx_4to32:
+		ldrb	ip, [r1], #1
+		and		r4, ip, #15
+		ldr		r4, [r3, r4, lsl #2]
+		mov		r5, ip, lsr #4
+		ldr		r5, [r3, r5, lsl #2]
+		stmia	r0!, {r4, r5}
+		subs	r2, r2, #1
+		bne		.Lbx_4to32
+	b		.Lbx_done
+
+	@ Bit pairs -> 4 words
+.Lbx_2to32:
+		ldrb	ip, [r1], #1
+		and		r4, ip, #0x03
+		ldr		r4, [r3, r4, lsl #2]
+		and		r5, ip, #0x0C			@ Already *4
+		ldr		r5, [r3, r5]
+		and		r6, ip, #0x30
+		ldr		r6, [r3, r6, lsr #2]
+		mov		r7, ip, lsr #6
+		ldr		r7, [r3, r7, lsl #2]
+		stmia	r0!, {r4-r7}
+		subs	r2, r2, #1
+		bne		.Lbx_2to32
+
+.Lbx_done:
+	ldmfd	sp!, {r4-r7}
+	bx		lr
+END_FUNC(bup_expand)
+
+@ EOF
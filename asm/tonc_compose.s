@@ -0,0 +1,126 @@
+//
+//  Scanline compositor span routines
+//
+//! \file tonc_compose.s
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+// === NOTES ===
+@ * All of these work on a line buffer in IWRAM, so the halfword
+@   and byte accesses are cheap; the line goes to VRAM in one go
+@   afterwards.
+@ * A \a key that doesn't fit in a pixel (like -1) means no key.
+@ * Blending uses the usual -g-|b-r spread. (s-d)*a + d*32 can borrow
+@   across fields, but the end result is exact since every field of
+@   s*a + d*(32-a) fits in its gap.
+
+	.file "tonc_compose.s"
+
+#include "tonc_asminc.hpp"
+
+@ === void cmp_span16_key(u16 *dst, const u16 *src, uint count, u32 key);
+/*! \fn void cmp_span16_key(u16 *dst, const u16 *src, uint count, u32 key) IWRAM_CODE;
+    \brief Copy 16bpp pixels, skipping those equal to \a key.
+	\param dst	Destination (line buffer).
+	\param src	Source pixels.
+	\param count	Number of pixels.
+	\param key	Transparent color.
+*/
+/* Reglist:
+  r0: dst
+  r1: src
+  r2: count
+  r3: key
+  ip: pixel
+*/
+BEGIN_FUNC_ARM(cmp_span16_key, CSEC_IWRAM)
+	cmp		r2, #0
+	bxeq	lr
+.Lcs16k_loop:
+		ldrh	ip, [r1], #2
+		cmp		ip, r3
+		strneh	ip, [r0]
+		add		r0, r0, #2
+		subs	r2, r2, #1
+		bne		.Lcs16k_loop
+	bx		lr
+END_FUNC(cmp_span16_key)
+
+@ === void cmp_span16_blend(u16 *dst, const u16 *src, uint count, u32 key, uint alpha);
+/*! \fn void cmp_span16_blend(u16 *dst, const u16 *src, uint count, u32 key, uint alpha) IWRAM_CODE;
+    \brief Alpha-blend 16bpp pixels onto \a dst, skipping \a key.
+	\param dst	Destination (line buffer).
+	\param src	Source pixels.
+	\param count	Number of pixels.
+	\param key	Transparent color.
+	\param alpha	Source weight, 0-32.
+*/
+/* Reglist:
+  r0: dst
+  r1: src
+  r2: count
+  r3: key
+  r4: alpha
+  r5: 0x03E07C1F
+  r6, r7: src, dst pixel
+  ip: blend
+*/
+BEGIN_FUNC_ARM(cmp_span16_blend, CSEC_IWRAM)
+	cmp		r2, #0
+	bxeq	lr
+	stmfd	sp!, {r4-r7}
+	ldr		r4, [sp, #16]
+	ldr		r5, =0x03E07C1F
+.Lcs16b_loop:
+		ldrh	r6, [r1], #2
+		cmp		r6, r3
+		beq		.Lcs16b_skip
+		ldrh	r7, [r0]
+		orr		r6, r6, r6, lsl #16
+		and		r6, r6, r5				@ s: -g-|b-r
+		orr		r7, r7, r7, lsl #16
+		and		r7, r7, r5				@ d: -g-|b-r
+		sub		r6, r6, r7
+		mul		ip, r6, r4				@ (s-d)*a
+		add		ip, ip, r7, lsl #5		@ + d*32
+		and		ip, r5, ip, lsr #5
+		orr		ip, ip, ip, lsr #16
+		strh	ip, [r0]
+.Lcs16b_skip:
+		add		r0, r0, #2
+		subs	r2, r2, #1
+		bne		.Lcs16b_loop
+	ldmfd	sp!, {r4-r7}
+	bx		lr
+	.pool
+END_FUNC(cmp_span16_blend)
+
+@ === void cmp_span8_key(u8 *dst, const u8 *src, uint count, u32 key);
+/*! \fn void cmp_span8_key(u8 *dst, const u8 *src, uint count, u32 key) IWRAM_CODE;
+    \brief Copy 8bpp pixels, skipping those equal to \a key.
+	\param dst	Destination (line buffer).
+	\param src	Source pixels.
+	\param count	Number of pixels.
+	\param key	Transparent color index.
+*/
+/* Reglist:
+  r0: dst
+  r1: src
+  r2: count
+  r3: key
+  ip: pixel
+*/
+BEGIN_FUNC_ARM(cmp_span8_key, CSEC_IWRAM)
+	cmp		r2, #0
+	bxeq	lr
+.Lcs8k_loop:
+		ldrb	ip, [r1], #1
+		cmp		ip, r3
+		strneb	ip, [r0]
+		add		r0, r0, #1
+		subs	r2, r2, #1
+		bne		.Lcs8k_loop
+	bx		lr
+END_FUNC(cmp_span8_key)
+
+@ EOF
@@ -0,0 +1,124 @@
+//
+//  DirectSound mixer inner loops
+//
+//! \file tonc_mixer.s
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+// === NOTES ===
+@ * The accumulator holds both channels in one word: left in the low
+@   halfword, right in the high halfword. A single mla with the packed
+@   gains adds a sample to both. Borrows from the left half are undone
+@   in mix_output by rounding the right half with +0x8000.
+@ * This is exact as long as each half stays within s16. With 8-bit
+@   samples and gains up to 32, that holds for up to 8 voices.
+@ * Loop costs: mix_voice_add: ~14 cycles/sample; mix_output: ~25.
+
+	.file "tonc_mixer.s"
+
+#include "tonc_asminc.hpp"
+
+@ === u32 mix_voice_add(u32 *acc, const s8 *src, u32 pos, u32 step, uint count, u32 gains);
+/*! \fn u32 mix_voice_add(u32 *acc, const s8 *src, u32 pos, u32 step, uint count, u32 gains) IWRAM_CODE;
+    \brief Resample one voice and add it to the stereo accumulator.
+	\param acc	Packed stereo accumulator.
+	\param src	Sample data.
+	\param pos	Sample position (.12f).
+	\param step	Position step per output sample (.12f).
+	\param count	Number of output samples.
+	\param gains	Left gain | right gain&lt;&lt;16.
+	\return	Position after \a count samples.
+*/
+/* Reglist:
+  r0: acc
+  r1: src
+  r2: pos
+  r3: step
+  r4: count, then count/2
+  r5: gains
+  r6: sample
+  r7, r8: acc words
+*/
+BEGIN_FUNC_ARM(mix_voice_add, CSEC_IWRAM)
+	stmfd	sp!, {r4-r8}
+	ldr		r4, [sp, #20]
+	ldr		r5, [sp, #24]
+	movs	r4, r4, lsr #1			@ Odd count -> C
+	bcc		.Lmva_pairs
+	@ Single
+	mov		r6, r2, lsr #12
+	ldrsb	r6, [r1, r6]
+	ldr		r7, [r0]
+	mla		r7, r6, r5, r7
+	str		r7, [r0], #4
+	add		r2, r2, r3
+	cmp		r4, #0
+.Lmva_pairs:
+	beq		.Lmva_done
+	@ Main loop: 2 per round
+.Lmva_loop:
+		ldmia	r0, {r7, r8}
+		mov		r6, r2, lsr #12
+		ldrsb	r6, [r1, r6]
+		add		r2, r2, r3
+		mla		r7, r6, r5, r7
+		mov		r6, r2, lsr #12
+		ldrsb	r6, [r1, r6]
+		add		r2, r2, r3
+		mla		r8, r6, r5, r8
+		stmia	r0!, {r7, r8}
+		subs	r4, r4, #1
+		bne		.Lmva_loop
+.Lmva_done:
+	mov		r0, r2
+	ldmfd	sp!, {r4-r8}
+	bx		lr
+END_FUNC(mix_voice_add)
+
+@ === void mix_output(s8 *dstL, s8 *dstR, const u32 *acc, uint count, uint shift);
+/*! \fn void mix_output(s8 *dstL, s8 *dstR, const u32 *acc, uint count, uint shift) IWRAM_CODE;
+    \brief Convert the stereo accumulator to clipped 8bit output.
+	\param dstL	Left output.
+	\param dstR	Right output.
+	\param acc	Packed stereo accumulator.
+	\param count	Number of samples.
+	\param shift	Attenuation shift.
+*/
+/* Reglist:
+  r0, r1: dstL, dstR
+  r2: acc
+  r3: count
+  r4, r5: left, right
+  r6: 16+shift
+  ip: acc word
+*/
+BEGIN_FUNC_ARM(mix_output, CSEC_IWRAM)
+	cmp		r3, #0
+	bxeq	lr
+	stmfd	sp!, {r4-r6}
+	ldr		r6, [sp, #12]
+	add		r6, r6, #16
+.Lmo_loop:
+		ldr		ip, [r2], #4
+		mov		r4, ip, lsl #16
+		mov		r4, r4, asr r6			@ left
+		add		r5, ip, #0x8000
+		mov		r5, r5, asr r6			@ right
+		@ Clip to s8
+		cmp		r4, #127
+		movgt	r4, #127
+		cmn		r4, #128
+		mvnlt	r4, #127
+		cmp		r5, #127
+		movgt	r5, #127
+		cmn		r5, #128
+		mvnlt	r5, #127
+		strb	r4, [r0], #1
+		strb	r5, [r1], #1
+		subs	r3, r3, #1
+		bne		.Lmo_loop
+	ldmfd	sp!, {r4-r6}
+	bx		lr
+END_FUNC(mix_output)
+
+@ EOF
@@ -1,43 +1,43 @@
-//
-//  [[ ]]
-//
-//! \file [[ ]]
-//! \author J Vijn
-//! \date 20079021 - 20079021
-//
-/* === NOTES ===
-*/
-
-#include "tonc_memmap.hpp"
-
-// --------------------------------------------------------------------
-// CONSTANTS
-// --------------------------------------------------------------------
-
-// --------------------------------------------------------------------
-// CLASSES 
-// --------------------------------------------------------------------
-
-
-// --------------------------------------------------------------------
-// GLOBALS 
-// --------------------------------------------------------------------
-
-
-
-// --------------------------------------------------------------------
-// PROTOTYPES 
-// --------------------------------------------------------------------
-
-
-// --------------------------------------------------------------------
-// MACROS 
-// --------------------------------------------------------------------
-// === INLINES=========================================================
-
-// --------------------------------------------------------------------
-// FUNCTIONS 
-// --------------------------------------------------------------------
-
-
-// EOF
+//
+//  [[ ]]
+//
+//! \file [[ ]]
+//! \author J Vijn
+//! \date 20079021 - 20079021
+//
+/* === NOTES ===
+*/
+
+#include "tonc_memmap.hpp"
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+// --------------------------------------------------------------------
+// CLASSES 
+// --------------------------------------------------------------------
+
+
+// --------------------------------------------------------------------
+// GLOBALS 
+// --------------------------------------------------------------------
+
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES 
+// --------------------------------------------------------------------
+
+
+// --------------------------------------------------------------------
+// MACROS 
+// --------------------------------------------------------------------
+// === INLINES=========================================================
+
+// --------------------------------------------------------------------
+// FUNCTIONS 
+// --------------------------------------------------------------------
+
+
+// EOF
@@ -1,46 +1,46 @@
-//
-//  [[ ]]
-//
-//! \file [[ ]]
-//! \author J Vijn
-//! \date 20060508 - 20060508
-//
-/* === NOTES ===
-*/
-
-#ifndef TONC_XXX
-#define TONC_XXX
-
-#include "tonc_memmap.hpp"
-
-// --------------------------------------------------------------------
-// CONSTANTS
-// --------------------------------------------------------------------
-// --------------------------------------------------------------------
-// MACROS 
-// --------------------------------------------------------------------
-
-// --------------------------------------------------------------------
-// CLASSES 
-// --------------------------------------------------------------------
-
-
-// --------------------------------------------------------------------
-// GLOBALS 
-// --------------------------------------------------------------------
-
-
-// --------------------------------------------------------------------
-// PROTOTYPES 
-// --------------------------------------------------------------------
-
-
-
-// --------------------------------------------------------------------
-// INLINES 
-// --------------------------------------------------------------------
-
-
-#endif // TONC_XXX
-
-// EOF
+//
+//  [[ ]]
+//
+//! \file [[ ]]
+//! \author J Vijn
+//! \date 20060508 - 20060508
+//
+/* === NOTES ===
+*/
+
+#ifndef TONC_XXX
+#define TONC_XXX
+
+#include "tonc_memmap.hpp"
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+// --------------------------------------------------------------------
+// MACROS 
+// --------------------------------------------------------------------
+
+// --------------------------------------------------------------------
+// CLASSES 
+// --------------------------------------------------------------------
+
+
+// --------------------------------------------------------------------
+// GLOBALS 
+// --------------------------------------------------------------------
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES 
+// --------------------------------------------------------------------
+
+
+
+// --------------------------------------------------------------------
+// INLINES 
+// --------------------------------------------------------------------
+
+
+#endif // TONC_XXX
+
+// EOF
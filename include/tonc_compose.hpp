@@ -0,0 +1,144 @@
+//
+//  Scanline compositor for bitmap modes
+//
+//! \file tonc_compose.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Each output line is built once in an IWRAM line buffer and then
+	copied to the destination with memcpy32. Overlap costs IWRAM
+	accesses, not VRAM ones.
+  * Lines start at the topmost opaque layer that covers the whole
+	width; nothing below it is touched.
+*/
+
+#ifndef TONC_COMPOSE
+#define TONC_COMPOSE
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+#include "tonc_video.hpp"
+#include "tonc_surface.hpp"
+
+/*! \defgroup grpSurfaceCompose	Scanline compositor
+	\ingroup grpSurface
+	Software layers for modes 3, 4 and 5. Layers are bmp16 or bmp8
+	surfaces (matching the destination) with a position, an optional
+	transparent color and, for 16bpp, an alpha blend. They're stacked
+	in the order they're added, first at the bottom.
+\code
+TCompositor comp;
+
+cmp_init(&comp, &m3_surface, CLR_BLACK);
+cmp_add(&comp, &backdrop, 0, 0, 0);
+int hero= cmp_add(&comp, &heroSrf, 100, 60, CMP_KEY);
+int hud= cmp_add(&comp, &hudSrf, 0, 144, CMP_BLEND);
+cmp_layer(&comp, hud)->alpha= 20;
+
+while(1)
+{
+	cmp_move(&comp, hero, x, y);
+	cmp_render(&comp);
+	...
+}
+\endcode
+*/
+
+/*!	\addtogroup grpSurfaceCompose	*/
+/*!	\{	*/
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+#define CMP_LAYERS			8		//!< Maximum number of layers.
+#define CMP_WIDTH_MAX		SCREEN_WIDTH	//!< Maximum destination width.
+
+//! \name Layer flags
+//\{
+#define CMP_HIDE			0x0001	//!< Layer is skipped.
+#define CMP_KEY				0x0002	//!< Pixels equal to \a key are transparent.
+#define CMP_BLEND			0x0004	//!< Blend with \a alpha (16bpp only).
+//\}
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! Compositor layer.
+typedef struct TCompLayer
+{
+	const TSurface *srf;	//!< Layer image.
+	s16 x, y;				//!< Position on the destination.
+	u16 flags;				//!< CMP_xxx flags.
+	u16 key;				//!< Transparent color or index (default 0).
+	u8 alpha;				//!< Layer weight for CMP_BLEND, 0-32.
+	u8 _pad[3];
+} TCompLayer;
+
+//! Compositor.
+typedef struct TCompositor
+{
+	const TSurface *dst;	//!< Output surface, bmp16 or bmp8.
+	u32 clear;				//!< Color for lines no opaque layer covers.
+	uint count;				//!< Number of layers.
+	TCompLayer layers[CMP_LAYERS];
+} TCompositor;
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+void cmp_init(TCompositor *cmp, const TSurface *dst, u32 clear);
+int cmp_add(TCompositor *cmp, const TSurface *srf, int x, int y, u32 flags);
+void cmp_render(TCompositor *cmp);
+void cmp_render_lines(TCompositor *cmp, int top, int bottom);
+
+INLINE TCompLayer *cmp_layer(TCompositor *cmp, int id);
+INLINE void cmp_move(TCompositor *cmp, int id, int x, int y);
+INLINE void cmp_show(TCompositor *cmp, int id, bool show);
+
+
+extern "C" {
+
+IWRAM_CODE void cmp_span16_key(u16 *dst, const u16 *src, uint count, u32 key);
+IWRAM_CODE void cmp_span16_blend(u16 *dst, const u16 *src, uint count,
+	u32 key, uint alpha);
+IWRAM_CODE void cmp_span8_key(u8 *dst, const u8 *src, uint count, u32 key);
+
+}
+
+
+// --------------------------------------------------------------------
+// INLINES
+// --------------------------------------------------------------------
+
+
+//! Get layer \a id.
+INLINE TCompLayer *cmp_layer(TCompositor *cmp, int id)
+{	return &cmp->layers[id];						}
+
+//! Move layer \a id to (\a x, \a y).
+INLINE void cmp_move(TCompositor *cmp, int id, int x, int y)
+{	cmp->layers[id].x= x;	cmp->layers[id].y= y;	}
+
+//! Show or hide layer \a id.
+INLINE void cmp_show(TCompositor *cmp, int id, bool show)
+{
+	if(show)
+		cmp->layers[id].flags &= ~CMP_HIDE;
+	else
+		cmp->layers[id].flags |= CMP_HIDE;
+}
+
+/*!	\}	*/
+
+#endif // TONC_COMPOSE
+
+// EOF
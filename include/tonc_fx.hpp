@@ -0,0 +1,200 @@
+//
+//  Window, blend and mosaic effects
+//
+//! \file tonc_fx.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Window shapes are tables of REG_WINxH values, one per scanline,
+	fed to the window by HBlank DMA. The CPU only touches them when
+	the shape changes, and then only O(size) work per redraw.
+  * HBlank DMA doesn't run in VBlank, so the first line comes from
+	the VBlank handler and the DMA starts at the second entry.
+*/
+
+#ifndef TONC_FX
+#define TONC_FX
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_video.hpp"
+
+/*! \defgroup grpVideoFx	Window and blend effects
+	\ingroup grpVideo
+	Hardware-driven transitions: shaped windows (circles, diamonds,
+	boxes) and iris wipes, fades and alpha-blend ramps via REG_BLDY
+	and REG_BLDALPHA, and mosaic ramps.
+
+	The effects only set the varying registers. Which layers are
+	inside the window (REG_WININ/REG_WINOUT), which layers blend
+	(REG_BLDCNT) and which layers use mosaic is still up to you, as is
+	enabling the window in REG_DISPCNT.
+\code
+EWRAM_BSS TWinFx iris;
+TBlendFx fade;
+
+REG_DISPCNT |= DCNT_WIN0;
+REG_WININ= WININ_BUILD(WIN_ALL, 0);
+REG_WINOUT= WINOUT_BUILD(0, 0);
+winfx_init(&iris, 0, 0);
+winfx_iris(&iris, WFX_CIRCLE, 120, 80, false, 60);	// Close in 1 second.
+
+REG_BLDCNT= BLD_BUILD(BLD_ALL|BLD_BACKDROP, 0, 3);
+bldfx_init(&fade, 0, 0, 0);
+bldfx_fade(&fade, 16, 60);							// Fade to black alongside.
+
+while(1)
+{
+	VBlankIntrWait();
+	winfx_vblank(&iris);
+	bldfx_update(&fade);
+	winfx_update(&iris);
+	...
+}
+\endcode
+*/
+
+/*!	\addtogroup grpVideoFx	*/
+/*!	\{	*/
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+//! Entries in a window table: one per line, plus one for the HBlank
+//! after the last line.
+#define FX_WIN_LINES		(SCREEN_HEIGHT+1)
+
+//! \name Window shapes
+//\{
+#define WFX_CIRCLE			0	//!< Circle with radius \a size.
+#define WFX_DIAMOND			1	//!< Diamond; \a size from center to tip.
+#define WFX_BOX				2	//!< Square; \a size is half the width.
+//\}
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! Value that moves linearly to a target over a number of frames.
+typedef struct TFxRamp
+{
+	s32 value;			//!< Current value (.8f).
+	s32 step;			//!< Change per frame (.8f).
+	s32 target;			//!< Final value (.8f).
+	u32 frames;			//!< Frames left.
+} TFxRamp;
+
+//! Shaped window, double-buffered and driven by HBlank DMA.
+typedef struct TWinFx
+{
+	u16 tables[2][FX_WIN_LINES];	//!< REG_WINxH per line.
+	u8 win;				//!< Window: 0 or 1.
+	u8 dma;				//!< DMA channel for the HBlank transfer.
+	u8 shape;			//!< WFX_xxx shape.
+	u8 page;			//!< Table on display.
+	vu8 ready;			//!< Other table is done; swap at VBlank.
+	u8 dirty;			//!< Shape needs a redraw.
+	s16 x, y;			//!< Center.
+	TFxRamp size;		//!< Shape size.
+} TWinFx;
+
+//! Blend weight and fade ramps.
+typedef struct TBlendFx
+{
+	TFxRamp eva;		//!< Top weight (0-16).
+	TFxRamp evb;		//!< Bottom weight (0-16).
+	TFxRamp ey;			//!< Fade level (0-16).
+} TBlendFx;
+
+//! Mosaic ramps.
+typedef struct TMosaicFx
+{
+	TFxRamp bg;			//!< Background mosaic size (0-15).
+	TFxRamp obj;		//!< Object mosaic size (0-15).
+} TMosaicFx;
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+//! \name Ramps
+//\{
+void fxr_set(TFxRamp *ramp, int value);
+void fxr_start(TFxRamp *ramp, int from, int to, uint frames);
+
+INLINE BOOL fxr_update(TFxRamp *ramp);
+INLINE int fxr_get(const TFxRamp *ramp);
+INLINE BOOL fxr_is_running(const TFxRamp *ramp);
+//\}
+
+//! \name Window tables
+//\{
+void win_clear(u16 *tbl);
+void win_rect(u16 *tbl, int left, int top, int right, int bottom);
+void win_circle(u16 *tbl, int x0, int y0, int rr);
+void win_diamond(u16 *tbl, int x0, int y0, int rr);
+//\}
+
+//! \name Window effects
+//\{
+void winfx_init(TWinFx *wfx, uint win, uint dma);
+void winfx_start(TWinFx *wfx, uint shape, int x, int y,
+	int from, int to, uint frames);
+void winfx_iris(TWinFx *wfx, uint shape, int x, int y, bool open,
+	uint frames);
+BOOL winfx_update(TWinFx *wfx);
+void winfx_vblank(TWinFx *wfx);
+void winfx_stop(TWinFx *wfx);
+//\}
+
+//! \name Blend and mosaic effects
+//\{
+void bldfx_init(TBlendFx *bfx, uint eva, uint evb, uint ey);
+void bldfx_alpha(TBlendFx *bfx, uint eva, uint evb, uint frames);
+void bldfx_fade(TBlendFx *bfx, uint ey, uint frames);
+BOOL bldfx_update(TBlendFx *bfx);
+
+void mosfx_init(TMosaicFx *mfx, uint bg, uint obj);
+void mosfx_ramp(TMosaicFx *mfx, uint bg, uint obj, uint frames);
+BOOL mosfx_update(TMosaicFx *mfx);
+//\}
+
+
+// --------------------------------------------------------------------
+// INLINES
+// --------------------------------------------------------------------
+
+
+//! Advance a ramp by one frame.
+/*!	\return	true if the value changed.
+*/
+INLINE BOOL fxr_update(TFxRamp *ramp)
+{
+	if(ramp->frames == 0)
+		return false;
+
+	ramp->value= --ramp->frames ? ramp->value+ramp->step : ramp->target;
+	return true;
+}
+
+//! Get the current value of a ramp, rounded to an integer.
+INLINE int fxr_get(const TFxRamp *ramp)
+{	return (ramp->value+0x80)>>8;	}
+
+//! Check if a ramp is still moving.
+INLINE BOOL fxr_is_running(const TFxRamp *ramp)
+{	return ramp->frames != 0;		}
+
+/*!	\}	*/
+
+#endif // TONC_FX
+
+// EOF
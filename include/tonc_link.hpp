@@ -0,0 +1,216 @@
+//
+//  Link cable: multiplayer transport and lockstep input
+//
+//! \file tonc_link.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Multiplayer (MP) mode moves one halfword per GBA per transfer, so
+	a packet is LINK_PACKET_LEN transfers. The master starts a packet
+	every VBlank; timer 3 spaces the transfers so that the slaves'
+	serial interrupts have time to load their next halfword.
+  * Packet: header (magic | message count | frame), acks, two input
+	words and LINK_MSG_MAX message halfwords. A slot that isn't
+	connected reads 0xFFFF and fails the magic check.
+  * Each player acks, per sender, the next frame whose input it's
+	missing, as a nibble relative to its frame - LINK_ACK_BIAS.
+	Senders always send from there, so a lost packet is simply filled
+	in by the next one.
+  * Frame numbers are full 32-bit numbers; packets carry the low 8
+	bits, which is plenty since lockstep keeps players within a few
+	frames of each other.
+*/
+
+#ifndef TONC_LINK
+#define TONC_LINK
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+
+/*! \defgroup grpLink	Link cable
+	\ingroup grpCore
+	Up to four GBAs over the link cable in multiplayer mode. There's a
+	message queue for general traffic and a lockstep mode for input:
+	every player runs frame \e n with the same keys for everyone.
+\code
+irq_init(NULL);
+irq_add(II_VBLANK, link_vblank);
+link_init(LINK_MP, SIOM_115200);
+
+// Lobby: messages only. Agree on a start, then:
+link_start(2);
+
+while(1)
+{
+	VBlankIntrWait();
+	if(!link_key_poll())
+		continue;			// Waiting for the others.
+
+	for(ii=0; ii<LINK_PLAYERS; ii++)
+		if(link_is_connected(ii))
+			player_update(ii, link_keys(ii));
+	...
+}
+\endcode
+	Use LINK_LOOPBACK to test without a cable: your own packets come
+	back as player 1, which then plays exactly like you do.
+
+	\note	The input delay is how many frames ahead local keys are
+		sampled. Keys are exchanged in VBlank and arrive during the
+		next one, so a delay of 2 runs without stalls.
+	\note	For rollback, use link_key_predict() instead: it never
+		waits, but fills in missing keys with predictions.
+		link_confirmed() tells how far the real input goes; resimulate
+		from there when it moves.
+*/
+
+/*!	\addtogroup grpLink	*/
+/*!	\{	*/
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+//! \name Modes
+//\{
+#define LINK_OFF			0	//!< Not running.
+#define LINK_MP				1	//!< Multiplayer mode over the cable.
+#define LINK_LOOPBACK		2	//!< No cable; player 1 echoes player 0.
+//\}
+
+#define LINK_PLAYERS		4		//!< Maximum number of players.
+#define LINK_MSG_MAX		4		//!< Message halfwords per packet.
+#define LINK_PACKET_LEN		(4+LINK_MSG_MAX)	//!< Transfers per packet.
+#define LINK_QUEUE_SIZE		64		//!< Message queue size (power of 2).
+#define LINK_HISTORY		32		//!< Input history frames (power of 2).
+#define LINK_DELAY_MAX		8		//!< Maximum input delay.
+#define LINK_PREDICT_MAX	8		//!< Maximum frames to run on predictions.
+
+#define LINK_ACK_BIAS		LINK_PREDICT_MAX	//!< Ack offset below the frame.
+
+#define LINK_HDR_MAGIC		0xA000	//!< Packet header magic.
+#define LINK_HDR_MASK		0xF000
+#define LINK_KEYS_NONE		0xFFFF	//!< Input word without input.
+
+#ifndef LINK_TIMER_GAP
+#define LINK_TIMER_GAP		64		//!< Gap between transfers, 64-cycle ticks.
+#endif
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! Ring buffer of message halfwords.
+typedef struct TLinkQueue
+{
+	vu16 head;				//!< Write position.
+	vu16 tail;				//!< Read position.
+	u16 data[LINK_QUEUE_SIZE];
+} TLinkQueue;
+
+//! Link player.
+typedef struct TLinkPlayer
+{
+	vu32 confirmed;			//!< First frame we don't have input for.
+	u32 frame;				//!< Player's frame, as of its last packet.
+	u32 need;				//!< First frame the player needs from us.
+	u16 curr;				//!< Keys for the current frame.
+	u16 prev;				//!< Keys for the previous frame.
+	u16 keys[LINK_HISTORY];	//!< Input history, by frame number.
+	TLinkQueue in;			//!< Received messages.
+} TLinkPlayer;
+
+//! Link state.
+typedef struct TLink
+{
+	u8 mode;				//!< LINK_OFF, LINK_MP or LINK_LOOPBACK.
+	u8 id;					//!< Local player.
+	u8 delay;				//!< Input delay in frames.
+	u8 sync;				//!< Lockstep running.
+	vu8 ready;				//!< \a txNext is complete.
+	vu8 index;				//!< Transfer within the packet.
+	vu8 connected;			//!< Players with a valid last packet (bits).
+	u8 error;				//!< Transfer error in the current packet.
+	u32 frame;				//!< Current frame.
+	u32 packets;			//!< Packets exchanged.
+	u32 errors;				//!< Packets dropped for transfer errors.
+	u32 stalls;				//!< Frames spent waiting for input.
+	u16 tx[LINK_PACKET_LEN];		//!< Packet being sent.
+	u16 txNext[LINK_PACKET_LEN];	//!< Next packet.
+	u16 rx[LINK_PLAYERS][LINK_PACKET_LEN];	//!< Packets being received.
+	TLinkQueue out;			//!< Outgoing messages.
+	TLinkPlayer players[LINK_PLAYERS];
+} TLink;
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+extern TLink gLink;
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+void link_init(uint mode, uint baud);
+void link_stop(void);
+void link_start(uint delay);
+
+void link_vblank(void);
+void link_serial_isr(void);
+void link_timer_isr(void);
+
+void link_update(void);
+BOOL link_key_poll(void);
+BOOL link_key_predict(void);
+u32 link_keys_at(uint player, u32 frame);
+
+BOOL link_send(u16 msg);
+BOOL link_recv(uint player, u16 *msg);
+
+INLINE u32 link_frame(void);
+INLINE u32 link_keys(uint player);
+INLINE u32 link_keys_prev(uint player);
+INLINE u32 link_confirmed(uint player);
+INLINE BOOL link_is_connected(uint player);
+
+
+// --------------------------------------------------------------------
+// INLINES
+// --------------------------------------------------------------------
+
+
+//! Number of the next frame link_key_poll() will run.
+INLINE u32 link_frame(void)
+{	return gLink.frame;										}
+
+//! Keys of \a player for the current frame.
+INLINE u32 link_keys(uint player)
+{	return gLink.players[player].curr;						}
+
+//! Keys of \a player for the previous frame.
+INLINE u32 link_keys_prev(uint player)
+{	return gLink.players[player].prev;						}
+
+//! First frame without real input from \a player.
+INLINE u32 link_confirmed(uint player)
+{	return gLink.players[player].confirmed;					}
+
+//! Check if \a player sent a valid packet last time.
+INLINE BOOL link_is_connected(uint player)
+{	return (gLink.connected>>player) & 1;					}
+
+/*!	\}	*/
+
+#endif // TONC_LINK
+
+// EOF
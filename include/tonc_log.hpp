@@ -0,0 +1,226 @@
+//
+//  Debug logging
+//
+//! \file tonc_log.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Logging a message only stores the format pointer and up to
+	LOG_ARGS_MAX 32-bit arguments in a ring buffer. The text is made
+	in log_flush(), outside the hot path.
+  * Messages above LOG_LEVEL_MAX are removed by the compiler, arguments
+	and all. With NDEBUG, that's every message.
+  * Arguments are stored as 32-bit words, so ints, chars and pointers
+	only. A %s argument must still be valid at flush time.
+*/
+
+#ifndef TONC_LOG
+#define TONC_LOG
+
+#include "tonc_types.hpp"
+
+/*! \defgroup grpLog	Debug logging
+	\ingroup grpCore
+	Leveled, categorized debug messages for the no$gba and mGBA debug
+	consoles.
+\code
+log_init(LOG_OUT_MGBA | LOG_OUT_NOCASH);
+
+void enemy_update(TEnemy *en)
+{
+	// Costs a ring buffer store, or nothing with NDEBUG.
+	LOG_DEBUG(LOGC_GAME, "enemy %d at (%d,%d)", en->id, en->x, en->y);
+	...
+}
+
+while(1)
+{
+	VBlankIntrWait();
+	...
+	log_flush(0);
+}
+\endcode
+	The format is a small subset of printf: %d, %u, %x, %X, %c, %s,
+	%p and %%, with optional '0' and width for the numbers.
+
+	\note	With LOG_RAW, log_flush() skips the formatting and prints
+		the format address and the raw arguments instead. The strings
+		can then be looked up in the .elf on the host.
+*/
+
+/*!	\addtogroup grpLog	*/
+/*!	\{	*/
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+//! \name Levels (same as mGBA's)
+//\{
+#define LOGL_NONE		(-1)	//!< For LOG_LEVEL_MAX: no logging.
+#define LOGL_FATAL			0	//!< Unrecoverable. Flushes at once.
+#define LOGL_ERROR			1	//!< Something went wrong.
+#define LOGL_WARN			2	//!< Something looks wrong.
+#define LOGL_INFO			3	//!< Progress.
+#define LOGL_DEBUG			4	//!< Details.
+//\}
+
+//! \name Categories
+/*!	Categories are 0-31; these are the ones tonc has names for.
+*/
+//\{
+#define LOGC_GENERAL		0
+#define LOGC_VIDEO			1
+#define LOGC_AUDIO			2
+#define LOGC_INPUT			3
+#define LOGC_LINK			4
+#define LOGC_SAVE			5
+#define LOGC_TEXT			6
+#define LOGC_GAME			8	//!< First category for the game.
+//\}
+
+//! \name Outputs and flags
+//\{
+#define LOG_OUT_NOCASH		0x0001	//!< no$gba debug window.
+#define LOG_OUT_MGBA		0x0002	//!< mGBA debug log, if present.
+#define LOG_RAW				0x0100	//!< Don't format; print the format address.
+//\}
+
+#define LOG_ARGS_MAX		4		//!< Arguments per message.
+#define LOG_RING_SIZE		64		//!< Ring buffer entries (power of 2).
+#define LOG_LINE_MAX		128		//!< Longest formatted line.
+
+//! Highest level that's compiled in.
+#ifndef LOG_LEVEL_MAX
+#ifdef NDEBUG
+#define LOG_LEVEL_MAX	LOGL_NONE
+#else
+#define LOG_LEVEL_MAX	LOGL_DEBUG
+#endif
+#endif
+
+//! \name mGBA debug registers
+//\{
+#define REG_MGBA_DEBUG_STRING	((char*)0x04FFF600)
+#define REG_MGBA_DEBUG_FLAGS	*(vu16*)0x04FFF700
+#define REG_MGBA_DEBUG_ENABLE	*(vu16*)0x04FFF780
+
+#define MGBA_DEBUG_SEND			0x0100
+#define MGBA_DEBUG_KEY			0xC0DE
+#define MGBA_DEBUG_ACK			0x1DEA
+//\}
+
+
+// --------------------------------------------------------------------
+// MACROS
+// --------------------------------------------------------------------
+
+
+#define LOG_NARGS_(_0, _1, _2, _3, _4, n, ...)	n
+#define LOG_NARGS(...)	LOG_NARGS_(_, ##__VA_ARGS__, 4, 3, 2, 1, 0)
+
+//! Log a message at \a level in category \a cat.
+/*!	Nothing is evaluated if \a level is filtered out, at compile time
+	or at run time.
+*/
+#define LOG(level, cat, fmt, ...)											\
+	do {																	\
+		if((level) <= LOG_LEVEL_MAX && log_wants(level, cat))				\
+			log_put(level, cat, fmt, LOG_NARGS(__VA_ARGS__), ##__VA_ARGS__);	\
+	} while(0)
+
+#define LOG_FATAL(cat, fmt, ...)	LOG(LOGL_FATAL, cat, fmt, ##__VA_ARGS__)
+#define LOG_ERROR(cat, fmt, ...)	LOG(LOGL_ERROR, cat, fmt, ##__VA_ARGS__)
+#define LOG_WARN(cat, fmt, ...)		LOG(LOGL_WARN, cat, fmt, ##__VA_ARGS__)
+#define LOG_INFO(cat, fmt, ...)		LOG(LOGL_INFO, cat, fmt, ##__VA_ARGS__)
+#define LOG_DEBUG(cat, fmt, ...)	LOG(LOGL_DEBUG, cat, fmt, ##__VA_ARGS__)
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! Stored message.
+typedef struct TLogEntry
+{
+	const char *fmt;		//!< Format string.
+	u8 level;				//!< LOGL_xxx level.
+	u8 cat;					//!< Category.
+	u8 argc;				//!< Number of arguments.
+	u8 _pad;
+	u32 args[LOG_ARGS_MAX];	//!< Arguments.
+} TLogEntry;
+
+//! Log state.
+typedef struct TLog
+{
+	s8 level;				//!< Highest level that's stored.
+	u8 _pad;
+	u16 flags;				//!< LOG_OUT_xxx outputs and LOG_RAW.
+	u32 mask;				//!< Categories that are stored (bits).
+	vu16 head;				//!< Write position.
+	vu16 tail;				//!< Read position.
+	u32 dropped;			//!< Messages lost to a full ring.
+	const char *names[32];	//!< Category names; NULL prints the number.
+} TLog;
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+extern TLog gLog;
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+uint log_init(uint flags);
+void log_put(uint level, uint cat, const char *fmt, uint argc, ...);
+uint log_flush(uint max);
+int log_format(char *dst, uint size, const TLogEntry *entry);
+void log_write(uint level, const char *str);
+
+INLINE BOOL log_wants(uint level, uint cat);
+INLINE void log_set_level(int level);
+INLINE void log_set_mask(u32 mask);
+INLINE void log_set_name(uint cat, const char *name);
+INLINE uint log_pending(void);
+
+
+// --------------------------------------------------------------------
+// INLINES
+// --------------------------------------------------------------------
+
+
+//! Check if a message at \a level in \a cat would be stored.
+INLINE BOOL log_wants(uint level, uint cat)
+{	return (int)level <= gLog.level && (gLog.mask>>cat & 1);	}
+
+//! Set the highest level to store.
+INLINE void log_set_level(int level)
+{	gLog.level= level;										}
+
+//! Set the categories to store, one bit each.
+INLINE void log_set_mask(u32 mask)
+{	gLog.mask= mask;										}
+
+//! Name category \a cat in the output.
+INLINE void log_set_name(uint cat, const char *name)
+{	gLog.names[cat&31]= name;								}
+
+//! Number of messages waiting for log_flush().
+INLINE uint log_pending(void)
+{	return (gLog.head-gLog.tail) & (LOG_RING_SIZE-1);		}
+
+/*!	\}	*/
+
+#endif // TONC_LOG
+
+// EOF
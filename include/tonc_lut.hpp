@@ -0,0 +1,282 @@
+//
+//  Compile-time look-up table generators
+//
+//! \file tonc_lut.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * sin_lut and div_lut are still the prebuilt tables from asm/; these
+    are for when you need a different size or precision, or a table
+	that tonc doesn't have.
+  * All math here is done in doubles, but only by the compiler. A
+    table defined as a namespace-scope constexpr is a const object
+	and ends up in .rodata (ROM); nothing runs on the GBA.
+  * If GCC complains about exceeding the constexpr operation limit
+    for very large tables, raise -fconstexpr-ops-limit.
+*/
+
+#ifndef TONC_LUT
+#define TONC_LUT
+
+#include "tonc_types.hpp"
+
+/*!	\addtogroup grpMathLut	*/
+/*!	\{	*/
+
+/*!	\name Compile-time LUT generators
+	Each generator returns a LUT struct that can be used as a
+	constant initializer. Sizes and fixed-point precision are
+	template parameters, so you can trade ROM for accuracy per table:
+\code
+// 256-entry sine, .14f, with 2 extra entries for lu_lerp16().
+constexpr auto sin_lut_hq= lut_sin<s16, 256, 14>();
+
+s32 y= lu_lerp16(sin_lut_hq.data, theta>>6, 2);
+\endcode
+*/
+//\{
+
+//! Compile-time look-up table.
+/*!	Just an array wrapped in a struct so that it can be returned
+	from a constexpr function. Use \a data to pass it to the lu_xxx
+	routines.
+*/
+template<typename T, uint N>
+struct LUT
+{
+	T data[N];
+
+	constexpr const T &operator[](uint ii) const	{	return data[ii];	}
+	static constexpr uint size()					{	return N;			}
+};
+
+constexpr double __LUT_PI= 3.14159265358979323846;
+
+// --- Internal constexpr math ----------------------------------------
+
+//! Round to nearest, halves away from zero.
+constexpr s64 __lut_round(double x)
+{	return (s64)(x >= 0 ? x+0.5 : x-0.5);	}
+
+//! Sine by Taylor series, after reduction to [-&pi;, &pi;].
+constexpr double __lut_sin(double x)
+{
+	x -= 2*__LUT_PI*(double)__lut_round(x/(2*__LUT_PI));
+
+	double term= x, sum= x;
+	for(int ii=1; ii<12; ii++)
+	{
+		term *= -x*x/((2*ii)*(2*ii+1));
+		sum += term;
+	}
+	return sum;
+}
+
+//! Square root by Newton iteration.
+constexpr double __lut_sqrt(double x)
+{
+	if(x <= 0)
+		return 0;
+
+	double y= x > 1 ? x : 1;
+	for(int ii=0; ii<64; ii++)
+		y= (y + x/y)/2;
+	return y;
+}
+
+//! Arctangent, for x in [0, 1].
+/*!	Halves the angle twice with atan(x) = 2 atan(x/(1+sqrt(1+x&sup2;)))
+	so that the series converges fast.
+*/
+constexpr double __lut_atan(double x)
+{
+	x= x/(1 + __lut_sqrt(1 + x*x));
+	x= x/(1 + __lut_sqrt(1 + x*x));
+
+	double term= x, sum= x;
+	for(int ii=1; ii<16; ii++)
+	{
+		term *= -x*x;
+		sum += term/(2*ii+1);
+	}
+	return 4*sum;
+}
+
+//! Natural log, for x > 0.
+constexpr double __lut_log(double x)
+{
+	double ofs= 0;
+	while(x >= 2)	{	x /= 2;	ofs += 0.69314718055994530942;	}
+	while(x < 1)	{	x *= 2;	ofs -= 0.69314718055994530942;	}
+
+	// ln(x) = 2 atanh((x-1)/(x+1))
+	double t= (x-1)/(x+1), term= t, sum= t;
+	for(int ii=1; ii<24; ii++)
+	{
+		term *= t*t;
+		sum += term/(2*ii+1);
+	}
+	return ofs + 2*sum;
+}
+
+//! Exponent, by series on x/1024 and squaring.
+constexpr double __lut_exp(double x)
+{
+	x /= 1024;
+	double term= 1, sum= 1;
+	for(int ii=1; ii<12; ii++)
+	{
+		term *= x/ii;
+		sum += term;
+	}
+	for(int ii=0; ii<10; ii++)
+		sum *= sum;
+	return sum;
+}
+
+//! Power function for \a b &ge; 0.
+constexpr double __lut_pow(double b, double e)
+{	return b > 0 ? __lut_exp(e*__lut_log(b)) : 0;	}
+
+//! Clamp to the range of an integral type.
+template<typename T>
+constexpr T __lut_sat(s64 x)
+{
+	constexpr s64 lo= (T)-1 < 0 ? -((s64)1<<(8*sizeof(T)-1)) : 0;
+	constexpr s64 hi= (T)-1 < 0 ? ((s64)1<<(8*sizeof(T)-1))-1
+		: (s64)((u64)(T)-1 >> (sizeof(T)==8));
+	return (T)(x < lo ? lo : x > hi ? hi : x);
+}
+
+
+// --- Generators -----------------------------------------------------
+
+//! Sine table: N entries per full circle, \a FP fractional bits.
+/*!	Has 2 extra entries for interpolation with lu_lerp16() /
+	lu_lerp32(), just like sin_lut. Cosine is the same table,
+	offset by N/4.
+	\note	Values are rounded, where sin_lut truncates; so
+		lut_sin<s16, 512, 12>() can be 1 off from sin_lut.
+*/
+template<typename T, uint N, uint FP>
+constexpr LUT<T, N+2> lut_sin()
+{
+	LUT<T, N+2> lut= {};
+	for(uint ii=0; ii<N+2; ii++)
+		lut.data[ii]= __lut_sat<T>(
+			__lut_round(__lut_sin(2*__LUT_PI*ii/N)*((s64)1<<FP)) );
+	return lut;
+}
+
+//! Reciprocal table: ceil(2<sup>FP</sup>/x) for x in [0, N].
+/*!	Entry 0 is the maximum value of \a T. lut_div<s32, 256, 16>()
+	reproduces div_lut.
+*/
+template<typename T, uint N, uint FP>
+constexpr LUT<T, N+1> lut_div()
+{
+	LUT<T, N+1> lut= {};
+	lut.data[0]= __lut_sat<T>(INT64_MAX);
+	for(uint ii=1; ii<N+1; ii++)
+		lut.data[ii]= __lut_sat<T>( (((s64)1<<FP) + ii-1)/ii );
+	return lut;
+}
+
+//! Arctangent table for x= i/N, i in [0, N].
+/*!	The result is in tonc angle units (0x10000 for a full circle),
+	so the range is [0, 0x2000]. Combine with octant() and a
+	min/max division for a full atan2.
+*/
+template<typename T, uint N>
+constexpr LUT<T, N+1> lut_atan()
+{
+	LUT<T, N+1> lut= {};
+	for(uint ii=0; ii<N+1; ii++)
+		lut.data[ii]= __lut_sat<T>(
+			__lut_round(__lut_atan((double)ii/N)*0x10000/(2*__LUT_PI)) );
+	return lut;
+}
+
+//! Square root table: sqrt(i/N) for i in [0, N], \a FP fractional bits.
+/*!	Has one extra entry for interpolation.
+*/
+template<typename T, uint N, uint FP>
+constexpr LUT<T, N+1> lut_sqrt()
+{
+	LUT<T, N+1> lut= {};
+	for(uint ii=0; ii<N+1; ii++)
+		lut.data[ii]= __lut_sat<T>(
+			__lut_round(__lut_sqrt((double)ii/N)*((s64)1<<FP)) );
+	return lut;
+}
+
+//! Gamma curve for 5bit color components; use with clr_adj_lut().
+/*!	out= 31*(in/31)<sup>&gamma;</sup>
+	\tparam GAMMA	Exponent &gamma;, in .8f. 0x100 is the identity;
+		lower is brighter.
+*/
+template<uint GAMMA>
+constexpr LUT<u8, 32> lut_gamma()
+{
+	LUT<u8, 32> lut= {};
+	for(uint ii=0; ii<32; ii++)
+		lut.data[ii]= (u8)__lut_round(31*__lut_pow(ii/31.0, GAMMA/256.0));
+	return lut;
+}
+
+//! Brightness curve for 5bit color components; use with clr_adj_lut().
+/*!	Same operation as clr_adj_brightness().
+	\tparam BRIGHT	Brightness difference, in .8f.
+*/
+template<int BRIGHT>
+constexpr LUT<u8, 32> lut_brightness()
+{
+	LUT<u8, 32> lut= {};
+	for(int ii=0; ii<32; ii++)
+	{
+		int x= ii + (BRIGHT>>3);
+		lut.data[ii]= (u8)(x < 0 ? 0 : x > 31 ? 31 : x);
+	}
+	return lut;
+}
+
+//! Contrast curve for 5bit color components; use with clr_adj_lut().
+/*!	Same operation as clr_adj_contrast().
+	\tparam CONTRAST	Contrast difference, in .8f.
+*/
+template<int CONTRAST>
+constexpr LUT<u8, 32> lut_contrast()
+{
+	LUT<u8, 32> lut= {};
+	for(int ii=0; ii<32; ii++)
+	{
+		int x= (ii*(CONTRAST+256) + ((-CONTRAST)>>1)*32)>>8;
+		lut.data[ii]= (u8)(x < 0 ? 0 : x > 31 ? 31 : x);
+	}
+	return lut;
+}
+
+//! Mode 7 distance table: 2<sup>FP</sup>/(y - HORIZON) per scanline.
+/*!	Multiply by the camera height to get the scanline's scale
+	factor &lambda;. Lines at or above the horizon get 0.
+	\tparam NLINES	Number of scanlines (usually 160).
+	\tparam HORIZON	Scanline of the horizon.
+*/
+template<typename T, uint NLINES, uint FP, int HORIZON>
+constexpr LUT<T, NLINES> lut_m7_dist()
+{
+	LUT<T, NLINES> lut= {};
+	for(int ii=0; ii<(int)NLINES; ii++)
+		lut.data[ii]= ii > HORIZON
+			? __lut_sat<T>( ((s64)1<<FP)/(ii-HORIZON) ) : 0;
+	return lut;
+}
+
+//\}
+
+/*!	\}	*/
+
+#endif // TONC_LUT
+
+// EOF
@@ -0,0 +1,230 @@
+//
+//  DirectSound software mixer
+//
+//! \file tonc_mixer.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Stereo: Direct Sound A is left, B is right. Both run off timer 0,
+	fed by DMA1 and DMA2 respectively. Timer 1, DMA1 and DMA2 are
+	left alone otherwise, but don't use DMA1/2 for anything else.
+  * The output rate is tied to the frame rate: one frame is exactly
+	MIX_xxx samples, so buffers can be swapped at VBlank without
+	any drift.
+*/
+
+#ifndef TONC_MIXER
+#define TONC_MIXER
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+
+/*! \defgroup grpAudioMixer	DirectSound mixer
+	\ingroup grpAudio
+	Software mixer for 8bit PCM samples. Voices are mixed by ARM
+	routines in IWRAM into a packed stereo accumulator, then clipped
+	into double-buffered 8bit output that DMA streams to the FIFOs.
+
+	Usage:
+\code
+irq_init(NULL);
+irq_add(II_VBLANK, mix_vblank);		// Must be the first thing in VBlank.
+mix_init(MIX_16KHZ);
+
+int voice= mix_play(&boom, -1, 64, MIX_PAN_CENTER);
+
+while(1)
+{
+	VBlankIntrWait();
+	mix_frame();
+	...
+}
+\endcode
+
+	Cost: ~14 cycles per voice-sample plus ~25 per output sample.
+	For 8 active voices at MIX_16KHZ that's about 13% of a frame,
+	and it doesn't get worse than that.
+
+	Samples can also be IMA ADPCM (mix_play_adpcm()), at a quarter of
+	the ROM. These are decoded each frame into a small buffer, just
+	ahead of where the voice is playing, for about 30 extra cycles per
+	sample. Up to MIX_STREAMS can play at once, at up to ~2.5x the
+	output rate.
+*/
+
+/*!	\addtogroup grpAudioMixer	*/
+/*!	\{	*/
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+#define MIX_VOICES			8		//!< Number of voices.
+
+//! \name Samples per frame. The rate is this times 59.73 Hz.
+//\{
+#define MIX_10KHZ		176		//!< 10512 Hz
+#define MIX_13KHZ		224		//!< 13379 Hz
+#define MIX_16KHZ		264		//!< 15768 Hz
+#define MIX_18KHZ		304		//!< 18157 Hz
+#define MIX_21KHZ		352		//!< 21024 Hz
+
+#define MIX_BUFSIZE_MAX	MIX_21KHZ
+//\}
+
+#define MIX_VOL_MAX			64		//!< Full voice volume.
+#define MIX_PAN_LEFT		0		//!< Hard left.
+#define MIX_PAN_CENTER		64		//!< Full volume on both sides.
+#define MIX_PAN_RIGHT		128		//!< Hard right.
+
+#define MIX_POS_SHIFT		12		//!< Fractional bits for position and step.
+
+#define MIX_STREAMS			2		//!< Number of ADPCM streams.
+#define MIX_STREAM_SIZE		1024	//!< Decode buffer per stream, in samples.
+#define MIX_STREAM_AHEAD	4		//!< Extra samples decoded ahead.
+
+//! Cycles per frame; 228 lines of 1232 cycles.
+#define MIX_FRAME_CYCLES	280896
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! Sample description.
+typedef struct TMixSample
+{
+	const s8 *data;		//!< Signed 8bit PCM.
+	u32 length;			//!< Length in samples (max 1M).
+	u32 loopLength;		//!< Loop length, from the end back. 0 for no loop.
+	u32 rate;			//!< Playback rate in Hz at pitch 1.0.
+} TMixSample;
+
+//! IMA ADPCM sample description.
+/*!	4bit codes, low nibble first, with the decoder state at the first
+	sample. This is the data of a mono IMA ADPCM wav with a single
+	block.
+*/
+typedef struct TAdpcmSample
+{
+	const u8 *data;		//!< ADPCM codes.
+	u32 length;			//!< Length in samples (even).
+	u32 loopLength;		//!< Loop length, from the end back (even). 0 for no loop.
+	u32 rate;			//!< Playback rate in Hz at pitch 1.0.
+	s16 pred;			//!< Initial predictor.
+	u16 index;			//!< Initial step index (0-88).
+} TAdpcmSample;
+
+//! ADPCM decoder state.
+typedef struct TAdpcmState
+{
+	s32 pred;			//!< Predictor.
+	s32 index;			//!< Step index.
+} TAdpcmState;
+
+//! ADPCM stream: decodes just ahead of the voice that plays it.
+typedef struct TMixStream
+{
+	const TAdpcmSample *smp;	//!< Sample; NULL if the stream is free.
+	const u8 *src;				//!< Next ADPCM byte.
+	TAdpcmState state;			//!< Decoder state at \a src.
+	TAdpcmState loopState;		//!< Decoder state at the loop start.
+	uint filled;				//!< Decoded samples in \a buffer.
+	s8 buffer[MIX_STREAM_SIZE+2];
+} TMixStream;
+
+//! Active voice.
+typedef struct TMixVoice
+{
+	const s8 *data;		//!< Sample data.
+	u32 pos;			//!< Position (.12f).
+	u32 step;			//!< Step per output sample (.12f).
+	u32 end;			//!< Sample end (.12f).
+	u32 loopLength;		//!< Loop length (.12f); 0 for one-shots.
+	u32 gains;			//!< Left gain | right gain<<16; 0-32 each.
+	u8 vol;				//!< Volume (0-64).
+	u8 pan;				//!< Panning (0-128).
+	u16 active;			//!< Voice is playing.
+	TMixStream *stream;	//!< ADPCM stream feeding \a data, or NULL.
+} TMixVoice;
+
+//! Mixer state.
+typedef struct TMixer
+{
+	uint bufsize;		//!< Samples per frame.
+	uint rate;			//!< Output rate in Hz.
+	uint shift;			//!< Output attenuation shift (default 6).
+	uint active;		//!< Half of the output buffer that is playing.
+	s8 *bufL;			//!< Output buffers, two frames each.
+	s8 *bufR;
+	TMixVoice voices[MIX_VOICES];
+} TMixer;
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+extern TMixer gMixer;
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+void mix_init(uint bufsize);
+void mix_stop_all(void);
+
+void mix_vblank(void);
+void mix_frame(void);
+
+int mix_play(const TMixSample *smp, int voice, uint vol, uint pan);
+int mix_play_adpcm(const TAdpcmSample *smp, int voice, uint vol, uint pan);
+void mix_stop(int voice);
+void mix_set_vol(int voice, uint vol, uint pan);
+void mix_set_rate(int voice, uint rate);
+
+INLINE void mix_set_shift(uint shift);
+INLINE BOOL mix_is_playing(int voice);
+
+
+extern "C" {
+
+IWRAM_CODE u32 mix_voice_add(u32 *acc, const s8 *src, u32 pos, u32 step,
+	uint count, u32 gains);
+IWRAM_CODE void mix_output(s8 *dstL, s8 *dstR, const u32 *acc, uint count,
+	uint shift);
+
+IWRAM_CODE const u8 *adpcm_decode(s8 *dst, const u8 *src, uint nbytes,
+	TAdpcmState *state);
+
+}
+
+
+// --------------------------------------------------------------------
+// INLINES
+// --------------------------------------------------------------------
+
+
+//! Set the output attenuation.
+/*!	At \a shift 5, a single voice at full volume plays at its
+	original amplitude; each extra step halves the output, giving
+	more headroom for many loud voices before clipping.
+*/
+INLINE void mix_set_shift(uint shift)
+{	gMixer.shift= shift;	}
+
+//! Check if \a voice is still playing.
+INLINE BOOL mix_is_playing(int voice)
+{	return gMixer.voices[voice].active;	}
+
+/*!	\}	*/
+
+#endif // TONC_MIXER
+
+// EOF
@@ -0,0 +1,141 @@
+//
+//  Palette animation
+//
+//! \file tonc_palanim.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * All work is done on a shadow copy of the palette. panim_update()
+    runs the ranges and marks the 16-color banks they touched;
+	panim_commit() copies only those banks to palette memory, so call
+	that one in VBlank.
+*/
+
+#ifndef TONC_PALANIM
+#define TONC_PALANIM
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+
+/*! \defgroup grpVideoPalAnim	Palette animation
+	\ingroup grpVideo
+	Declarative palette effects: color cycling (water, lava), ping-pong
+	cycles and gradient sweeps (glows, fades). Effects are described by
+	TPalRange entries, which can come straight from a const table:
+\code
+const TPalRange ranges[]=
+{
+	// first count  type                     dir speed
+	{   16,    8,   PA_CYCLE,                 1, 0x040 },	// Water
+	{   32,    6,   PA_CYCLE|PA_PINGPONG,    -1, 0x100 },	// Lava
+	{   48,   16,   PA_SWEEP|PA_PINGPONG,     1, 0x200, 0, 0,
+		{ CLR_NAVY, CLR_BLUE, CLR_BLUE, CLR_CYAN } },		// Glow
+};
+
+EWRAM_BSS TPalAnim palAnim;
+
+panim_init(&palAnim, pal_data, ranges, countof(ranges));
+
+while(1)
+{
+	VBlankIntrWait();
+	panim_commit(&palAnim);
+	panim_update(&palAnim);
+	...
+}
+\endcode
+*/
+
+/*!	\addtogroup grpVideoPalAnim	*/
+/*!	\{	*/
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+#define PANIM_MAX			16		//!< Maximum number of ranges.
+#define PANIM_SWEEP_MAX		32		//!< Sweep steps (= clr_blend() alpha).
+
+//! \name Range types
+//\{
+
+#define PA_OFF				0x00	//!< Inactive range.
+#define PA_CYCLE			0x01	//!< Rotate colors by one per step.
+#define PA_SWEEP			0x02	//!< Gradient between moving end colors.
+#define PA_TYPE_MASK		0x0F
+
+#define PA_PINGPONG			0x80	//!< Reverse at the ends instead of wrapping.
+
+//\}
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! A single animated palette range.
+typedef struct TPalRange
+{
+	u16 first;		//!< First palette index (256+ for OBJ colors).
+	u16 count;		//!< Number of colors.
+	u8 type;		//!< Range type (PA_xxx).
+	s8 dir;			//!< Direction: 1 (right/forward) or -1.
+	u16 speed;		//!< Steps per frame (.8f).
+	u16 acc;		//!< Step accumulator (.8f).
+	u16 phase;		//!< Current step.
+	//! Sweep colors: first/last at phase 0; first/last at PANIM_SWEEP_MAX.
+	COLOR clrs[4];
+} ALIGN4 TPalRange;
+
+//! Palette animator.
+typedef struct TPalAnim
+{
+	u32 dirty;					//!< Changed banks (bit 0-15: BG, 16-31: OBJ).
+	uint count;					//!< Number of ranges in use.
+	TPalRange ranges[PANIM_MAX];	//!< Ranges.
+	COLOR shadow[512];			//!< Shadow of the full BG+OBJ palette.
+} ALIGN4 TPalAnim;
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+void panim_init(TPalAnim *pa, const COLOR *pal,
+	const TPalRange *ranges, uint count);
+
+TPalRange *panim_add(TPalAnim *pa, const TPalRange *range);
+void panim_remove(TPalAnim *pa, TPalRange *range);
+
+void panim_update(TPalAnim *pa);
+void panim_commit(TPalAnim *pa);
+
+INLINE void panim_mark(TPalAnim *pa, uint first, uint count);
+
+
+// --------------------------------------------------------------------
+// INLINES
+// --------------------------------------------------------------------
+
+
+//! Mark colors [\a first, \a first+\a count) as changed.
+/*!	Use after writing to \a pa->shadow directly.
+*/
+INLINE void panim_mark(TPalAnim *pa, uint first, uint count)
+{
+	if(count == 0)
+		return;
+
+	uint bank0= first/16, bank1= (first+count-1)/16;
+	pa->dirty |= (0xFFFFFFFF>>(31-(bank1-bank0)))<<bank0;
+}
+
+/*!	\}	*/
+
+#endif // TONC_PALANIM
+
+// EOF
@@ -0,0 +1,207 @@
+//
+//  Performance overlay
+//
+//! \file tonc_perf.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Times come from one free-running timer at 64 cycles per tick:
+	4389 ticks per frame, and enough range for a 14 frame hiccup.
+	That's fine for frame budgets, but too coarse for tiny scopes;
+	use profile_start() for those.
+  * The overlay is two objects: 64x64 of text and a 64x32 graph.
+	The font is sys8Font, unpacked to 4bpp tiles once in perf_init(),
+	so a character costs an 8-word copy.
+  * Per frame, the overlay updates one text line and one graph column.
+	That stays well under 1% of the frame.
+*/
+
+#ifndef TONC_PERF
+#define TONC_PERF
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_bios.hpp"
+#include "tonc_irq.hpp"
+
+/*! \defgroup grpPerf	Performance overlay
+	\ingroup grpTimer
+	On-screen CPU, IRQ and scope timings, VBlank overruns and a
+	rolling CPU graph.
+\code
+perf_init(&obj_buffer[0], 512, 15, SCREEN_WIDTH-64, 0);
+perf_set_name(0, "ai");
+perf_set_name(1, "phys");
+perf_irq_hook(II_VBLANK);		// After irq_add().
+
+while(1)
+{
+	perf_vsync();				// Instead of VBlankIntrWait()
+	oam_copy(oam_mem, obj_buffer, 128);
+
+	PERF_SCOPE(0)
+		ai_update();
+
+	perf_begin(1);
+	physics_update();
+	perf_end(1);
+	...
+}
+\endcode
+	Text lines: CPU use, IRQ time, the number of overruns (frames
+	missed), then the scopes. Percentages are averages over the last
+	PERF_REFRESH frames. Graph bars are green for frames that made it
+	and red for overruns.
+*/
+
+/*!	\addtogroup grpPerf	*/
+/*!	\{	*/
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+#ifndef PERF_TIMER
+#define PERF_TIMER			1	//!< Timer used for the clock.
+#endif
+
+#define PERF_SCOPES			5		//!< Number of scoped timers.
+#define PERF_REFRESH		16		//!< Frames per average.
+#define PERF_FRAME_TICKS	4389	//!< Ticks per frame (280896/64).
+#define PERF_GRAPH_W		64		//!< Graph width (samples).
+#define PERF_GRAPH_H		32		//!< Graph height.
+#define PERF_LINES			8		//!< Text lines.
+#define PERF_COLS			8		//!< Characters per line.
+#define PERF_TILES			96		//!< Object tiles used.
+
+//! \name Overlay colors (palette bank indices)
+//\{
+#define PERF_CLR_PAPER		1
+#define PERF_CLR_INK		2
+#define PERF_CLR_OK			3
+#define PERF_CLR_OVER		4
+//\}
+
+
+// --------------------------------------------------------------------
+// MACROS
+// --------------------------------------------------------------------
+
+
+//! Time the statement or block that follows as scope \a id.
+#define PERF_SCOPE(id)													\
+	for(uint _perf_once= (perf_begin(id), 1); _perf_once;				\
+		_perf_once= (perf_end(id), 0))
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! Scoped timer.
+typedef struct TPerfScope
+{
+	const char *name;		//!< Name; three characters are shown.
+	u16 start;				//!< Clock at perf_begin().
+	u16 _pad;
+	u32 sum;				//!< Ticks in this averaging window.
+	u16 shown;				//!< Per mille of the last window.
+	u16 _pad2;
+} TPerfScope;
+
+//! Performance overlay state.
+typedef struct TPerf
+{
+	OBJ_ATTR *obj;			//!< The two overlay objects.
+	TILE *text;				//!< First text tile.
+	TILE *graph;			//!< First graph tile.
+	u8 stride;				//!< Tiles per object tile row.
+	u8 line;				//!< Next text line to draw.
+	u8 column;				//!< Next graph column.
+	u8 frames;				//!< Frames in this window.
+	bool visible;			//!< Overlay is shown.
+	u8 _pad[3];
+	u16 frameStart;			//!< Clock at the start of the frame.
+	u16 idle;				//!< Clock at perf_idle(), this frame.
+	u32 busy;				//!< Busy ticks in this window.
+	u32 total;				//!< Ticks in this window.
+	vu32 irq;				//!< IRQ ticks in this window.
+	u32 overruns;			//!< Frames missed so far.
+	u16 cpuShown;			//!< CPU per mille of the last window.
+	u16 irqShown;			//!< IRQ per mille of the last window.
+	u32 self;				//!< Ticks of the last perf_frame().
+	TPerfScope scopes[PERF_SCOPES];
+} TPerf;
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+extern TPerf gPerf;
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+void perf_init(OBJ_ATTR *obj, uint tid, uint pb, int x, int y);
+void perf_show(bool show);
+void perf_frame(void);
+BOOL perf_irq_hook(enum eIrqIndex irq);
+
+INLINE u32 perf_ticks(void);
+INLINE void perf_begin(uint id);
+INLINE void perf_end(uint id);
+INLINE void perf_idle(void);
+INLINE void perf_vsync(void);
+INLINE void perf_set_name(uint id, const char *name);
+
+
+// --------------------------------------------------------------------
+// INLINES
+// --------------------------------------------------------------------
+
+
+//! Current clock, in 64-cycle ticks (wraps at 16 bits).
+INLINE u32 perf_ticks(void)
+{	return REG_TM[PERF_TIMER].count;								}
+
+//! Start scope \a id.
+INLINE void perf_begin(uint id)
+{	gPerf.scopes[id].start= perf_ticks();						}
+
+//! End scope \a id. Scopes can be timed more than once per frame.
+INLINE void perf_end(uint id)
+{
+	TPerfScope *ps= &gPerf.scopes[id];
+	ps->sum += (u16)(perf_ticks() - ps->start);
+}
+
+//! Mark the end of the frame's work; call just before waiting.
+INLINE void perf_idle(void)
+{	gPerf.idle= perf_ticks();									}
+
+//! Wait for VBlank, measuring the frame and updating the overlay.
+INLINE void perf_vsync(void)
+{
+	perf_idle();
+	VBlankIntrWait();
+	perf_frame();
+}
+
+//! Set the name of scope \a id.
+INLINE void perf_set_name(uint id, const char *name)
+{	gPerf.scopes[id].name= name;								}
+
+/*!	\}	*/
+
+#endif // TONC_PERF
+
+// EOF
@@ -0,0 +1,183 @@
+//
+//  Save memory: SRAM, Flash and EEPROM
+//
+//! \file tonc_save.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * The save is split into two slots. A commit always goes to the
+	slot that doesn't hold the latest save, header last, so a power
+	cut mid-write leaves the previous save intact.
+  * Commits run a little per frame through save_update(). Flash
+	erases and EEPROM writes take milliseconds, but they run on the
+	chip; the update just checks back next frame.
+  * Off the GBA (no __arm__), the save memory is an image in RAM
+	mirrored to the file SAVE_HOST_FILE.
+*/
+
+#ifndef TONC_SAVE
+#define TONC_SAVE
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+
+/*! \defgroup grpSave	Save memory
+	\ingroup grpCore
+	Block-level saves for all cartridge save types, with checksums and
+	a double-slot journal.
+\code
+// Emulators and flash carts pick the save type from this string.
+__attribute__((used)) const char saveId[] ALIGN4= SAVE_ID_SRAM;
+
+save_init(save_detect(SAVE_NONE));
+if(save_load(&game, sizeof(game)) < 0)
+	game_new(&game);
+
+...
+// Autosave: returns at once; the write runs alongside the game.
+save_commit(&game, sizeof(game));
+
+while(1)
+{
+	VBlankIntrWait();
+	save_update(256);
+	...
+}
+\endcode
+	Don't change the data while a commit runs; copy it first if that's
+	a problem.
+
+	\note	EEPROM can't be probed safely, and neither can its size;
+	pass the EEPROM type to save_init() directly, or as the fallback
+	for save_detect().
+	\note	EEPROM transfers use DMA3 and mustn't be broken up, so
+	they're done with interrupts off. Don't run HBlank DMA on
+	channels 0-2 during a commit to EEPROM.
+*/
+
+/*!	\addtogroup grpSave	*/
+/*!	\{	*/
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+//! \name Save types
+//\{
+#define SAVE_NONE			0	//!< No save memory.
+#define SAVE_SRAM			1	//!< 32 KiB SRAM (or FRAM).
+#define SAVE_FLASH_64K		2	//!< 64 KiB Flash.
+#define SAVE_FLASH_128K		3	//!< 128 KiB Flash, two banks.
+#define SAVE_EEPROM_512		4	//!< 512 byte EEPROM.
+#define SAVE_EEPROM_8K		5	//!< 8 KiB EEPROM.
+//\}
+
+//! \name Save ID strings, for emulators and flash carts
+//\{
+#define SAVE_ID_SRAM		"SRAM_V113"
+#define SAVE_ID_FLASH_64K	"FLASH512_V131"
+#define SAVE_ID_FLASH_128K	"FLASH1M_V103"
+#define SAVE_ID_EEPROM		"EEPROM_V124"
+//\}
+
+//! \name Commit states
+//\{
+#define SAVE_IDLE			0	//!< Nothing to do.
+#define SAVE_SUM			1	//!< Computing the checksum.
+#define SAVE_ERASE			2	//!< Erasing Flash sectors.
+#define SAVE_WRITE			3	//!< Writing.
+#define SAVE_VERIFY			4	//!< Reading back.
+#define SAVE_ERROR			5	//!< Last commit failed.
+//\}
+
+#define SAVE_HEADER_SIZE	16			//!< Slot header size.
+#define SAVE_MAGIC			0x56415354	//!< "TSAV"
+#define SAVE_SLOT_NONE		0xFF		//!< No valid slot.
+
+#ifndef SAVE_HOST_FILE
+#define SAVE_HOST_FILE		"tonc.sav"	//!< Host build backing file.
+#endif
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! Slot header.
+typedef struct TSaveHeader
+{
+	u32 magic;			//!< SAVE_MAGIC.
+	u32 seq;			//!< Commit number; the highest valid one wins.
+	u32 size;			//!< Data size in bytes.
+	u32 check;			//!< Data checksum.
+} TSaveHeader;
+
+//! Save state.
+typedef struct TSave
+{
+	u8 type;			//!< SAVE_xxx type.
+	u8 state;			//!< Commit state.
+	u8 slot;			//!< Slot with the latest save, or SAVE_SLOT_NONE.
+	u8 _pad;
+	u16 flashId;		//!< Flash manufacturer | device&lt;&lt;8.
+	u16 unit;			//!< Write unit in bytes.
+	u32 size;			//!< Size of save memory.
+	u32 slotSize;		//!< Size of a slot.
+	u32 seq;			//!< Commit number of the latest save.
+	// Commit in progress
+	const u8 *src;		//!< Data being committed.
+	TSaveHeader hdr;	//!< Header being committed.
+	u32 base;			//!< Slot being written.
+	u32 pos;			//!< Progress in the current state.
+	u32 sumA, sumB;		//!< Running checksum.
+} TSave;
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+extern TSave gSave;
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+uint save_detect(uint fallback);
+BOOL save_init(uint type);
+
+int save_load(void *dst, uint size);
+BOOL save_commit(const void *src, uint size);
+uint save_update(uint budget);
+
+void save_read(uint ofs, void *dst, uint size);
+u32 save_checksum(const void *src, uint size);
+
+INLINE BOOL save_busy(void);
+INLINE uint save_max_size(void);
+
+
+// --------------------------------------------------------------------
+// INLINES
+// --------------------------------------------------------------------
+
+
+//! Check if a commit is still running.
+INLINE BOOL save_busy(void)
+{	return gSave.state != SAVE_IDLE && gSave.state != SAVE_ERROR;	}
+
+//! Largest block that save_commit() accepts.
+INLINE uint save_max_size(void)
+{	return gSave.slotSize ? gSave.slotSize-SAVE_HEADER_SIZE : 0;	}
+
+/*!	\}	*/
+
+#endif // TONC_SAVE
+
+// EOF
@@ -0,0 +1,170 @@
+//
+//  Music player for the DMG tone channels
+//
+//! \file tonc_tracker.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * The hardware does the heavy lifting: envelopes, sweeps and note
+	lengths all run in the tone generators. The player only parses a
+	few bytes per row and writes some registers, so it costs next to
+	nothing per frame.
+  * Doesn't touch the Direct Sound bits, so it can run next to the
+	mixer.
+*/
+
+#ifndef TONC_TRACKER
+#define TONC_TRACKER
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+
+/*! \defgroup grpAudioTracker	Tone generator music
+	\ingroup grpAudio
+	A small pattern-based player for the four DMG channels.
+
+	A song is a list of order positions, each with one pattern per
+	channel. A pattern is a byte stream:
+	- <b>0x00-0x5F</b>: note, see TRK_NOTE(). Plays for one row.
+	- <b>TRK_OFF</b>: silence the channel. One row.
+	- <b>TRK_INSTR</b>, <i>id</i>: switch instrument. Takes no time.
+	- <b>TRK_WAIT(n)</b>: let the channel be for \a n rows (1-128).
+
+	For the noise channel, notes select the noise frequency instead:
+	a note value \a n gives shift <i>n</i>/8 and divider <i>n</i>%8.
+\code
+const u8 bass[]=
+{
+	TRK_INSTR, 1,
+	TRK_NOTE(NOTE_C, 0), TRK_WAIT(3),
+	TRK_NOTE(NOTE_G, 0), TRK_WAIT(3),
+	TRK_NOTE(NOTE_A, 0), TRK_WAIT(3),
+	TRK_NOTE(NOTE_F, 0), TRK_OFF, TRK_WAIT(2),
+};
+\endcode
+*/
+
+/*!	\addtogroup grpAudioTracker	*/
+/*!	\{	*/
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+#define TRK_CHANNELS		4
+
+//! \name Pattern bytes
+//\{
+
+//! Note byte for \a note (NOTE_C - NOTE_B) in octave \a oct (-2 to 5).
+#define TRK_NOTE(note, oct)	( ((oct)+2)*12 + (note) )
+#define TRK_OFF				0x60	//!< Note off.
+#define TRK_INSTR			0x61	//!< Set instrument; next byte is the id.
+//! Wait \a n rows (1-128).
+#define TRK_WAIT(n)			( 0x80 | ((n)-1) )
+
+#define TRK_NONE			0xFF	//!< Order entry for an unused channel.
+
+//\}
+
+//! \name Instrument flags
+//\{
+#define TRKI_TIMED			0x01	//!< Stop after the length in \a cnt.
+//\}
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! Instrument.
+typedef struct TTrackInstr
+{
+	//! Register value for REG_SNDxCNT: envelope, duty and length for
+	//! the squares and noise; length and volume for the wave channel.
+	u16 cnt;
+	//! Channel 1: REG_SND1SWEEP (0 for none). Noise: SNOISE_7BIT or 0.
+	u8 sweep;
+	//! Software pitch slide, in rate units per frame. Any tone channel.
+	s8 slide;
+	u8 flags;		//!< TRKI_xxx flags.
+	u8 _pad[3];
+	//! Channel 3: 32 4bit samples to load into wave ram; or NULL.
+	const u32 *wave;
+} TTrackInstr;
+
+//! Song.
+typedef struct TTrackSong
+{
+	const TTrackInstr *instruments;	//!< Instrument list.
+	const u8 *const *patterns;		//!< Pattern streams.
+	const u8 *order;	//!< TRK_CHANNELS pattern ids per position.
+	u8 length;			//!< Number of order positions.
+	u8 loop;			//!< Position to loop to; TRK_NONE to stop.
+	u8 speed;			//!< Frames per row.
+	u8 rows;			//!< Rows per pattern.
+} TTrackSong;
+
+//! Channel state.
+typedef struct TTrackChannel
+{
+	const u8 *pos;		//!< Position in the pattern; NULL if unused.
+	u16 rate;			//!< Current rate/noise frequency.
+	u8 wait;			//!< Rows left to wait.
+	u8 instr;			//!< Current instrument.
+	u8 sounding;		//!< Note is on.
+	u8 _pad[3];
+} TTrackChannel;
+
+//! Player state.
+typedef struct TTracker
+{
+	const TTrackSong *song;
+	TTrackChannel channels[TRK_CHANNELS];
+	u8 order;			//!< Current order position.
+	u8 row;				//!< Current row.
+	u8 tick;			//!< Frame within the row.
+	u8 playing;			//!< Song is running.
+	const u32 *wave;	//!< Wave currently in wave ram.
+} TTracker;
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+extern TTracker gTracker;
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+void trk_init(void);
+void trk_play(const TTrackSong *song);
+void trk_stop(void);
+void trk_update(void);
+
+INLINE BOOL trk_is_playing(void);
+
+
+// --------------------------------------------------------------------
+// INLINES
+// --------------------------------------------------------------------
+
+
+//! Check if a song is playing.
+INLINE BOOL trk_is_playing(void)
+{	return gTracker.playing;	}
+
+/*!	\}	*/
+
+#endif // TONC_TRACKER
+
+// EOF
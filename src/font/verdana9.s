@@ -1,167 +1,167 @@
-
-@{{BLOCK(verdana9)
-
-@ Verdana 9, ' ' to '', 1bpp
-
-	.section .rodata
-	.align	2
-	.global	verdana9Font
-verdana9Font:
-	.word	verdana9Glyphs, verdana9Widths, 0
-	.hword	32, 224
-	.byte	8, 12
-	.byte	8, 16
-	.hword	16
-	.byte	1, 0
-
-	.section .rodata
-	.align	2
-	.global verdana9Glyphs		@ 3584 unsigned chars
-verdana9Glyphs:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0x01010101,0x00000100,0x00000000
-	.word 0x05050000,0x00000005,0x00000000,0x00000000,0x00000000,0x1F0A1F0A,0x0000000A,0x00000000
-	.word 0x04040000,0x0C06051E,0x04040F14,0x00000000,0x22000000,0x542A1515,0x00002254,0x00000000
-	.word 0x06000000,0x29260909,0x00002E11,0x00000000,0x01010000,0x00000001,0x00000000,0x00000000
-	.word 0x02040000,0x01010101,0x04020101,0x00000000,0x02010000,0x04040404,0x01020404,0x00000000
-	.word 0x0E150400,0x00000415,0x00000000,0x00000000,0x00000000,0x041F0404,0x00000004,0x00000000
-	.word 0x00000000,0x00000000,0x00010202,0x00000000,0x00000000,0x00070000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000202,0x00000000,0x08080000,0x02020404,0x00010102,0x00000000
-
-	.word 0x0E000000,0x11111111,0x00000E11,0x00000000,0x04000000,0x04040406,0x00000E04,0x00000000
-	.word 0x0E000000,0x04081011,0x00001F02,0x00000000,0x0E000000,0x100C1011,0x00000E11,0x00000000
-	.word 0x08000000,0x1F090A0C,0x00000808,0x00000000,0x1F000000,0x10100F01,0x00000E11,0x00000000
-	.word 0x0C000000,0x110F0102,0x00000E11,0x00000000,0x1F000000,0x04080810,0x00000404,0x00000000
-	.word 0x0E000000,0x110E1111,0x00000E11,0x00000000,0x0E000000,0x101E1111,0x00000608,0x00000000
-	.word 0x00000000,0x00020200,0x00000202,0x00000000,0x00000000,0x00020200,0x00010202,0x00000000
-	.word 0x00000000,0x0C030C10,0x00000010,0x00000000,0x00000000,0x1F001F00,0x00000000,0x00000000
-	.word 0x00000000,0x06180601,0x00000001,0x00000000,0x07000000,0x02040808,0x00000200,0x00000000
-
-	.word 0x7C000000,0xA5A5B982,0x007C0259,0x00000000,0x0C000000,0x3F12120C,0x00002121,0x00000000
-	.word 0x07000000,0x110F0909,0x00000F11,0x00000000,0x1C000000,0x01010122,0x00001C22,0x00000000
-	.word 0x0F000000,0x21212111,0x00000F11,0x00000000,0x1F000000,0x010F0101,0x00001F01,0x00000000
-	.word 0x1F000000,0x010F0101,0x00000101,0x00000000,0x1C000000,0x21390122,0x00001C22,0x00000000
-	.word 0x21000000,0x213F2121,0x00002121,0x00000000,0x07000000,0x02020202,0x00000702,0x00000000
-	.word 0x06000000,0x04040404,0x00000304,0x00000000,0x11000000,0x05030509,0x00001109,0x00000000
-	.word 0x01000000,0x01010101,0x00001F01,0x00000000,0x63000000,0x49555563,0x00004149,0x00000000
-	.word 0x21000000,0x31292523,0x00002121,0x00000000,0x1C000000,0x41414122,0x00001C22,0x00000000
-
-	.word 0x0F000000,0x0F111111,0x00000101,0x00000000,0x1C000000,0x41414122,0x60101C22,0x00000000
-	.word 0x0F000000,0x050F1111,0x00001109,0x00000000,0x0E000000,0x100E0111,0x00000E11,0x00000000
-	.word 0x7F000000,0x08080808,0x00000808,0x00000000,0x21000000,0x21212121,0x00001E21,0x00000000
-	.word 0x21000000,0x12122121,0x00000C0C,0x00000000,0x41000000,0x55554949,0x00002222,0x00000000
-	.word 0x11000000,0x0A040A11,0x00001111,0x00000000,0x11000000,0x040A0A11,0x00000404,0x00000000
-	.word 0x1F000000,0x02040810,0x00001F01,0x00000000,0x01030000,0x01010101,0x03010101,0x00000000
-	.word 0x01010000,0x04020202,0x00080804,0x00000000,0x02030000,0x02020202,0x03020202,0x00000000
-	.word 0x04000000,0x0000110A,0x00000000,0x00000000,0x00000000,0x00000000,0x1F000000,0x00000000
-
-	.word 0x04020000,0x00000000,0x00000000,0x00000000,0x00000000,0x0E080600,0x00000E09,0x00000000
-	.word 0x01010000,0x09090701,0x00000709,0x00000000,0x00000000,0x01010E00,0x00000E01,0x00000000
-	.word 0x08080000,0x09090E08,0x00000E09,0x00000000,0x00000000,0x0F090600,0x00000E01,0x00000000
-	.word 0x020C0000,0x02020702,0x00000202,0x00000000,0x00000000,0x09090E00,0x06080E09,0x00000000
-	.word 0x01010000,0x09090701,0x00000909,0x00000000,0x01000000,0x01010100,0x00000101,0x00000000
-	.word 0x04000000,0x04040600,0x03040404,0x00000000,0x01010000,0x03050901,0x00000905,0x00000000
-	.word 0x01010000,0x01010101,0x00000301,0x00000000,0x00000000,0x49493700,0x00004949,0x00000000
-	.word 0x00000000,0x09090700,0x00000909,0x00000000,0x00000000,0x09090600,0x00000609,0x00000000
-
-	.word 0x00000000,0x09090700,0x01010709,0x00000000,0x00000000,0x09090E00,0x08080E09,0x00000000
-	.word 0x00000000,0x01030500,0x00000101,0x00000000,0x00000000,0x06010E00,0x00000708,0x00000000
-	.word 0x00000000,0x02020F02,0x00000C02,0x00000000,0x00000000,0x09090900,0x00000E09,0x00000000
-	.word 0x00000000,0x09090900,0x00000606,0x00000000,0x00000000,0x15151100,0x00000A0A,0x00000000
-	.word 0x00000000,0x06090900,0x00000909,0x00000000,0x00000000,0x09090900,0x02020406,0x00000000
-	.word 0x00000000,0x02040700,0x00000701,0x00000000,0x04180000,0x03040404,0x18040404,0x00000000
-	.word 0x02020000,0x02020202,0x02020202,0x00000000,0x04030000,0x18040404,0x03040404,0x00000000
-	.word 0x00000000,0x0D160000,0x00000000,0x00000000,0x00000000,0x0F0F0F0F,0x00000F0F,0x00000000
-
-	.word 0x1C000000,0x0F020F02,0x00001C02,0x00000000,0x03000000,0x03030303,0x00000303,0x00000000
-	.word 0x00000000,0x00000000,0x00010202,0x00000000,0x30000000,0x041E0808,0x03040404,0x00000000
-	.word 0x00000000,0x00000000,0x00050A0A,0x00000000,0x00000000,0x00000000,0x00001500,0x00000000
-	.word 0x04040000,0x0404041F,0x00000004,0x00000000,0x04040000,0x041F041F,0x00000004,0x00000000
-	.word 0x05020000,0x00000000,0x00000000,0x00000000,0x15250200,0xA952040A,0x000050A8,0x00000000
-	.word 0x1C000814,0x201C0222,0x00001C22,0x00000000,0x00000000,0x02020400,0x00000004,0x00000000
-	.word 0xFE000000,0x11F11111,0x0000FE11,0x00000000,0x03000000,0x03030303,0x00000303,0x00000000
-	.word 0x1F00040A,0x02040810,0x00001F01,0x00000000,0x03000000,0x03030303,0x00000303,0x00000000
-
-	.word 0x03000000,0x03030303,0x00000303,0x00000000,0x01010000,0x00000002,0x00000000,0x00000000
-	.word 0x02020000,0x00000001,0x00000000,0x00000000,0x05050000,0x0000000A,0x00000000,0x00000000
-	.word 0x0A0A0000,0x00000005,0x00000000,0x00000000,0x00000000,0x07070700,0x00000000,0x00000000
-	.word 0x00000000,0x1F000000,0x00000000,0x00000000,0x00000000,0x7F000000,0x00000000,0x00000000
-	.word 0x0D0B0000,0x00000000,0x00000000,0x00000000,0x4F000000,0x00004A7A,0x00000000,0x00000000
-	.word 0x08140000,0x0C021C00,0x00000E10,0x00000000,0x00000000,0x04040200,0x00000002,0x00000000
-	.word 0x00000000,0x79493600,0x00007609,0x00000000,0x03000000,0x03030303,0x00000303,0x00000000
-	.word 0x02050000,0x02040700,0x00000701,0x00000000,0x11001100,0x040A0A11,0x00000404,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0x01010100,0x00000101,0x00000000
-	.word 0x04000000,0x05051E04,0x04041E05,0x00000000,0x1C000000,0x020F0202,0x00001F02,0x00000000
-	.word 0x00000000,0x0E0A0E11,0x00000011,0x00000000,0x11000000,0x1F040A11,0x00000404,0x00000000
-	.word 0x02020000,0x00000202,0x02020202,0x00000000,0x0E000000,0x09090601,0x00070806,0x00000000
-	.word 0x09000000,0x00000000,0x00000000,0x00000000,0x3C000000,0x8585B942,0x003C42B9,0x00000000
-	.word 0x07000000,0x0E090E08,0x00000000,0x00000000,0x00000000,0x0A0A1400,0x00000014,0x00000000
-	.word 0x00000000,0x101F0000,0x00000010,0x00000000,0x00000000,0x000E0000,0x00000000,0x00000000
-	.word 0x3C000000,0x9DA59D42,0x003C42A5,0x00000000,0x003F0000,0x00000000,0x00000000,0x00000000
-
-	.word 0x06000000,0x00060909,0x00000000,0x00000000,0x00000000,0x041F0404,0x0000001F,0x00000000
-	.word 0x07000000,0x00070204,0x00000000,0x00000000,0x07000000,0x00070402,0x00000000,0x00000000
-	.word 0x02040000,0x00000000,0x00000000,0x00000000,0x00000000,0x09090900,0x01010F09,0x00000000
-	.word 0x1E000000,0x14161717,0x00141414,0x00000000,0x00000000,0x02020000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x02040000,0x00000000,0x02000000,0x00070203,0x00000000,0x00000000
-	.word 0x06000000,0x06090909,0x00000000,0x00000000,0x00000000,0x14140A00,0x0000000A,0x00000000
-	.word 0x12230200,0x2932040A,0x00002078,0x00000000,0x12230200,0x4172040A,0x00007020,0x00000000
-	.word 0x14220700,0x2932040B,0x00002078,0x00000000,0x04000000,0x01020400,0x00000E01,0x00000000
-
-	.word 0x0C000804,0x3F12120C,0x00002121,0x00000000,0x0C000404,0x3F12120C,0x00002121,0x00000000
-	.word 0x0C000A04,0x3F12120C,0x00002121,0x00000000,0x0C001A16,0x3F12120C,0x00002121,0x00000000
-	.word 0x0C001200,0x3F12120C,0x00002121,0x00000000,0x24241800,0x24241818,0x0000427E,0x00000000
-	.word 0xF8000000,0x1EF21414,0x0000F111,0x00000000,0x1C000000,0x01010122,0x04081C22,0x00000000
-	.word 0x1F000402,0x010F0101,0x00001F01,0x00000000,0x1F000408,0x010F0101,0x00001F01,0x00000000
-	.word 0x1F000A04,0x010F0101,0x00001F01,0x00000000,0x1F001200,0x010F0101,0x00001F01,0x00000000
-	.word 0x07000201,0x02020202,0x00000702,0x00000000,0x07000204,0x02020202,0x00000702,0x00000000
-	.word 0x0E000A04,0x04040404,0x00000E04,0x00000000,0x0E001100,0x04040404,0x00000E04,0x00000000
-
-	.word 0x1E000000,0x424F4222,0x00001E22,0x00000000,0x21001A16,0x31292523,0x00002121,0x00000000
-	.word 0x1C000804,0x41414122,0x00001C22,0x00000000,0x1C000810,0x41414122,0x00001C22,0x00000000
-	.word 0x1C001408,0x41414122,0x00001C22,0x00000000,0x1C00342C,0x41414122,0x00001C22,0x00000000
-	.word 0x1C002200,0x41414122,0x00001C22,0x00000000,0x00000000,0x040A1100,0x0000110A,0x00000000
-	.word 0x5C000000,0x45495122,0x00001D22,0x00000000,0x21000804,0x21212121,0x00001E21,0x00000000
-	.word 0x21000408,0x21212121,0x00001E21,0x00000000,0x21000A04,0x21212121,0x00001E21,0x00000000
-	.word 0x21001200,0x21212121,0x00001E21,0x00000000,0x11000408,0x040A0A11,0x00000404,0x00000000
-	.word 0x01000000,0x1111110F,0x0000010F,0x00000000,0x09060000,0x09090509,0x00000509,0x00000000
-
-	.word 0x04020000,0x0E080600,0x00000E09,0x00000000,0x04080000,0x0E080600,0x00000E09,0x00000000
-	.word 0x0A040000,0x0E080600,0x00000E09,0x00000000,0x1A160000,0x0E080600,0x00000E09,0x00000000
-	.word 0x0A000000,0x0E080600,0x00000E09,0x00000000,0x0E0A0E00,0x0E080600,0x00000E09,0x00000000
-	.word 0x00000000,0x7E483600,0x00007609,0x00000000,0x00000000,0x01010E00,0x02040E01,0x00000000
-	.word 0x04020000,0x0F090600,0x00000E01,0x00000000,0x04080000,0x0F090600,0x00000E01,0x00000000
-	.word 0x0A040000,0x0F090600,0x00000E01,0x00000000,0x09000000,0x0F090600,0x00000E01,0x00000000
-	.word 0x02010000,0x02020200,0x00000202,0x00000000,0x01020000,0x01010100,0x00000101,0x00000000
-	.word 0x05020000,0x02020200,0x00000202,0x00000000,0x05000000,0x02020200,0x00000202,0x00000000
-
-	.word 0x0C000000,0x111E100A,0x00000E11,0x00000000,0x0D0B0000,0x09090700,0x00000909,0x00000000
-	.word 0x04020000,0x09090600,0x00000609,0x00000000,0x04080000,0x09090600,0x00000609,0x00000000
-	.word 0x0A040000,0x09090600,0x00000609,0x00000000,0x0D0B0000,0x09090600,0x00000609,0x00000000
-	.word 0x09000000,0x09090600,0x00000609,0x00000000,0x00000000,0x001F0004,0x00000004,0x00000000
-	.word 0x00000000,0x12121C20,0x00010E12,0x00000000,0x04020000,0x09090900,0x00000E09,0x00000000
-	.word 0x04080000,0x09090900,0x00000E09,0x00000000,0x0A040000,0x09090900,0x00000E09,0x00000000
-	.word 0x09000000,0x09090900,0x00000E09,0x00000000,0x04080000,0x09090900,0x02020406,0x00000000
-	.word 0x01010000,0x09090701,0x01010709,0x00000000,0x09000000,0x09090900,0x02020406,0x00000000
-
-	.section .rodata
-	.align	2
-	.global verdana9Widths		@ 224 unsigned chars
-verdana9Widths:
-	.byte 0x03,0x02,0x04,0x06,0x06,0x08,0x07,0x02,0x04,0x04,0x06,0x06,0x03,0x04,0x03,0x05
-	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x03,0x03,0x06,0x06,0x06,0x05
-	.byte 0x08,0x07,0x06,0x07,0x07,0x06,0x06,0x07,0x07,0x04,0x04,0x06,0x06,0x08,0x07,0x08
-	.byte 0x06,0x08,0x06,0x06,0x07,0x07,0x07,0x08,0x06,0x06,0x06,0x03,0x05,0x03,0x06,0x06
-	.byte 0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x02,0x04,0x05,0x02,0x08,0x05,0x05
-	.byte 0x05,0x05,0x04,0x05,0x05,0x05,0x05,0x06,0x05,0x05,0x04,0x06,0x04,0x06,0x06,0x05
-	.byte 0x06,0x03,0x03,0x07,0x05,0x06,0x06,0x06,0x04,0x08,0x07,0x04,0x08,0x03,0x06,0x03
-	.byte 0x03,0x03,0x03,0x05,0x05,0x04,0x06,0x08,0x05,0x08,0x06,0x04,0x08,0x03,0x04,0x06
-
-	.byte 0x03,0x02,0x06,0x06,0x06,0x06,0x04,0x05,0x06,0x08,0x05,0x06,0x06,0x05,0x08,0x06
-	.byte 0x05,0x06,0x04,0x04,0x05,0x05,0x06,0x03,0x04,0x04,0x05,0x06,0x08,0x08,0x08,0x05
-	.byte 0x07,0x07,0x07,0x07,0x07,0x08,0x08,0x07,0x06,0x06,0x06,0x06,0x04,0x04,0x05,0x05
-	.byte 0x08,0x07,0x08,0x08,0x08,0x08,0x08,0x06,0x08,0x07,0x07,0x07,0x07,0x06,0x06,0x05
-	.byte 0x05,0x05,0x05,0x05,0x05,0x05,0x08,0x05,0x05,0x05,0x05,0x05,0x03,0x02,0x03,0x03
-	.byte 0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x06,0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x05
-
-@}}BLOCK(verdana9)
+
+@{{BLOCK(verdana9)
+
+@ Verdana 9, ' ' to '', 1bpp
+
+	.section .rodata
+	.align	2
+	.global	verdana9Font
+verdana9Font:
+	.word	verdana9Glyphs, verdana9Widths, 0
+	.hword	32, 224
+	.byte	8, 12
+	.byte	8, 16
+	.hword	16
+	.byte	1, 0
+
+	.section .rodata
+	.align	2
+	.global verdana9Glyphs		@ 3584 unsigned chars
+verdana9Glyphs:
+	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0x01010101,0x00000100,0x00000000
+	.word 0x05050000,0x00000005,0x00000000,0x00000000,0x00000000,0x1F0A1F0A,0x0000000A,0x00000000
+	.word 0x04040000,0x0C06051E,0x04040F14,0x00000000,0x22000000,0x542A1515,0x00002254,0x00000000
+	.word 0x06000000,0x29260909,0x00002E11,0x00000000,0x01010000,0x00000001,0x00000000,0x00000000
+	.word 0x02040000,0x01010101,0x04020101,0x00000000,0x02010000,0x04040404,0x01020404,0x00000000
+	.word 0x0E150400,0x00000415,0x00000000,0x00000000,0x00000000,0x041F0404,0x00000004,0x00000000
+	.word 0x00000000,0x00000000,0x00010202,0x00000000,0x00000000,0x00070000,0x00000000,0x00000000
+	.word 0x00000000,0x00000000,0x00000202,0x00000000,0x08080000,0x02020404,0x00010102,0x00000000
+
+	.word 0x0E000000,0x11111111,0x00000E11,0x00000000,0x04000000,0x04040406,0x00000E04,0x00000000
+	.word 0x0E000000,0x04081011,0x00001F02,0x00000000,0x0E000000,0x100C1011,0x00000E11,0x00000000
+	.word 0x08000000,0x1F090A0C,0x00000808,0x00000000,0x1F000000,0x10100F01,0x00000E11,0x00000000
+	.word 0x0C000000,0x110F0102,0x00000E11,0x00000000,0x1F000000,0x04080810,0x00000404,0x00000000
+	.word 0x0E000000,0x110E1111,0x00000E11,0x00000000,0x0E000000,0x101E1111,0x00000608,0x00000000
+	.word 0x00000000,0x00020200,0x00000202,0x00000000,0x00000000,0x00020200,0x00010202,0x00000000
+	.word 0x00000000,0x0C030C10,0x00000010,0x00000000,0x00000000,0x1F001F00,0x00000000,0x00000000
+	.word 0x00000000,0x06180601,0x00000001,0x00000000,0x07000000,0x02040808,0x00000200,0x00000000
+
+	.word 0x7C000000,0xA5A5B982,0x007C0259,0x00000000,0x0C000000,0x3F12120C,0x00002121,0x00000000
+	.word 0x07000000,0x110F0909,0x00000F11,0x00000000,0x1C000000,0x01010122,0x00001C22,0x00000000
+	.word 0x0F000000,0x21212111,0x00000F11,0x00000000,0x1F000000,0x010F0101,0x00001F01,0x00000000
+	.word 0x1F000000,0x010F0101,0x00000101,0x00000000,0x1C000000,0x21390122,0x00001C22,0x00000000
+	.word 0x21000000,0x213F2121,0x00002121,0x00000000,0x07000000,0x02020202,0x00000702,0x00000000
+	.word 0x06000000,0x04040404,0x00000304,0x00000000,0x11000000,0x05030509,0x00001109,0x00000000
+	.word 0x01000000,0x01010101,0x00001F01,0x00000000,0x63000000,0x49555563,0x00004149,0x00000000
+	.word 0x21000000,0x31292523,0x00002121,0x00000000,0x1C000000,0x41414122,0x00001C22,0x00000000
+
+	.word 0x0F000000,0x0F111111,0x00000101,0x00000000,0x1C000000,0x41414122,0x60101C22,0x00000000
+	.word 0x0F000000,0x050F1111,0x00001109,0x00000000,0x0E000000,0x100E0111,0x00000E11,0x00000000
+	.word 0x7F000000,0x08080808,0x00000808,0x00000000,0x21000000,0x21212121,0x00001E21,0x00000000
+	.word 0x21000000,0x12122121,0x00000C0C,0x00000000,0x41000000,0x55554949,0x00002222,0x00000000
+	.word 0x11000000,0x0A040A11,0x00001111,0x00000000,0x11000000,0x040A0A11,0x00000404,0x00000000
+	.word 0x1F000000,0x02040810,0x00001F01,0x00000000,0x01030000,0x01010101,0x03010101,0x00000000
+	.word 0x01010000,0x04020202,0x00080804,0x00000000,0x02030000,0x02020202,0x03020202,0x00000000
+	.word 0x04000000,0x0000110A,0x00000000,0x00000000,0x00000000,0x00000000,0x1F000000,0x00000000
+
+	.word 0x04020000,0x00000000,0x00000000,0x00000000,0x00000000,0x0E080600,0x00000E09,0x00000000
+	.word 0x01010000,0x09090701,0x00000709,0x00000000,0x00000000,0x01010E00,0x00000E01,0x00000000
+	.word 0x08080000,0x09090E08,0x00000E09,0x00000000,0x00000000,0x0F090600,0x00000E01,0x00000000
+	.word 0x020C0000,0x02020702,0x00000202,0x00000000,0x00000000,0x09090E00,0x06080E09,0x00000000
+	.word 0x01010000,0x09090701,0x00000909,0x00000000,0x01000000,0x01010100,0x00000101,0x00000000
+	.word 0x04000000,0x04040600,0x03040404,0x00000000,0x01010000,0x03050901,0x00000905,0x00000000
+	.word 0x01010000,0x01010101,0x00000301,0x00000000,0x00000000,0x49493700,0x00004949,0x00000000
+	.word 0x00000000,0x09090700,0x00000909,0x00000000,0x00000000,0x09090600,0x00000609,0x00000000
+
+	.word 0x00000000,0x09090700,0x01010709,0x00000000,0x00000000,0x09090E00,0x08080E09,0x00000000
+	.word 0x00000000,0x01030500,0x00000101,0x00000000,0x00000000,0x06010E00,0x00000708,0x00000000
+	.word 0x00000000,0x02020F02,0x00000C02,0x00000000,0x00000000,0x09090900,0x00000E09,0x00000000
+	.word 0x00000000,0x09090900,0x00000606,0x00000000,0x00000000,0x15151100,0x00000A0A,0x00000000
+	.word 0x00000000,0x06090900,0x00000909,0x00000000,0x00000000,0x09090900,0x02020406,0x00000000
+	.word 0x00000000,0x02040700,0x00000701,0x00000000,0x04180000,0x03040404,0x18040404,0x00000000
+	.word 0x02020000,0x02020202,0x02020202,0x00000000,0x04030000,0x18040404,0x03040404,0x00000000
+	.word 0x00000000,0x0D160000,0x00000000,0x00000000,0x00000000,0x0F0F0F0F,0x00000F0F,0x00000000
+
+	.word 0x1C000000,0x0F020F02,0x00001C02,0x00000000,0x03000000,0x03030303,0x00000303,0x00000000
+	.word 0x00000000,0x00000000,0x00010202,0x00000000,0x30000000,0x041E0808,0x03040404,0x00000000
+	.word 0x00000000,0x00000000,0x00050A0A,0x00000000,0x00000000,0x00000000,0x00001500,0x00000000
+	.word 0x04040000,0x0404041F,0x00000004,0x00000000,0x04040000,0x041F041F,0x00000004,0x00000000
+	.word 0x05020000,0x00000000,0x00000000,0x00000000,0x15250200,0xA952040A,0x000050A8,0x00000000
+	.word 0x1C000814,0x201C0222,0x00001C22,0x00000000,0x00000000,0x02020400,0x00000004,0x00000000
+	.word 0xFE000000,0x11F11111,0x0000FE11,0x00000000,0x03000000,0x03030303,0x00000303,0x00000000
+	.word 0x1F00040A,0x02040810,0x00001F01,0x00000000,0x03000000,0x03030303,0x00000303,0x00000000
+
+	.word 0x03000000,0x03030303,0x00000303,0x00000000,0x01010000,0x00000002,0x00000000,0x00000000
+	.word 0x02020000,0x00000001,0x00000000,0x00000000,0x05050000,0x0000000A,0x00000000,0x00000000
+	.word 0x0A0A0000,0x00000005,0x00000000,0x00000000,0x00000000,0x07070700,0x00000000,0x00000000
+	.word 0x00000000,0x1F000000,0x00000000,0x00000000,0x00000000,0x7F000000,0x00000000,0x00000000
+	.word 0x0D0B0000,0x00000000,0x00000000,0x00000000,0x4F000000,0x00004A7A,0x00000000,0x00000000
+	.word 0x08140000,0x0C021C00,0x00000E10,0x00000000,0x00000000,0x04040200,0x00000002,0x00000000
+	.word 0x00000000,0x79493600,0x00007609,0x00000000,0x03000000,0x03030303,0x00000303,0x00000000
+	.word 0x02050000,0x02040700,0x00000701,0x00000000,0x11001100,0x040A0A11,0x00000404,0x00000000
+
+	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0x01010100,0x00000101,0x00000000
+	.word 0x04000000,0x05051E04,0x04041E05,0x00000000,0x1C000000,0x020F0202,0x00001F02,0x00000000
+	.word 0x00000000,0x0E0A0E11,0x00000011,0x00000000,0x11000000,0x1F040A11,0x00000404,0x00000000
+	.word 0x02020000,0x00000202,0x02020202,0x00000000,0x0E000000,0x09090601,0x00070806,0x00000000
+	.word 0x09000000,0x00000000,0x00000000,0x00000000,0x3C000000,0x8585B942,0x003C42B9,0x00000000
+	.word 0x07000000,0x0E090E08,0x00000000,0x00000000,0x00000000,0x0A0A1400,0x00000014,0x00000000
+	.word 0x00000000,0x101F0000,0x00000010,0x00000000,0x00000000,0x000E0000,0x00000000,0x00000000
+	.word 0x3C000000,0x9DA59D42,0x003C42A5,0x00000000,0x003F0000,0x00000000,0x00000000,0x00000000
+
+	.word 0x06000000,0x00060909,0x00000000,0x00000000,0x00000000,0x041F0404,0x0000001F,0x00000000
+	.word 0x07000000,0x00070204,0x00000000,0x00000000,0x07000000,0x00070402,0x00000000,0x00000000
+	.word 0x02040000,0x00000000,0x00000000,0x00000000,0x00000000,0x09090900,0x01010F09,0x00000000
+	.word 0x1E000000,0x14161717,0x00141414,0x00000000,0x00000000,0x02020000,0x00000000,0x00000000
+	.word 0x00000000,0x00000000,0x02040000,0x00000000,0x02000000,0x00070203,0x00000000,0x00000000
+	.word 0x06000000,0x06090909,0x00000000,0x00000000,0x00000000,0x14140A00,0x0000000A,0x00000000
+	.word 0x12230200,0x2932040A,0x00002078,0x00000000,0x12230200,0x4172040A,0x00007020,0x00000000
+	.word 0x14220700,0x2932040B,0x00002078,0x00000000,0x04000000,0x01020400,0x00000E01,0x00000000
+
+	.word 0x0C000804,0x3F12120C,0x00002121,0x00000000,0x0C000404,0x3F12120C,0x00002121,0x00000000
+	.word 0x0C000A04,0x3F12120C,0x00002121,0x00000000,0x0C001A16,0x3F12120C,0x00002121,0x00000000
+	.word 0x0C001200,0x3F12120C,0x00002121,0x00000000,0x24241800,0x24241818,0x0000427E,0x00000000
+	.word 0xF8000000,0x1EF21414,0x0000F111,0x00000000,0x1C000000,0x01010122,0x04081C22,0x00000000
+	.word 0x1F000402,0x010F0101,0x00001F01,0x00000000,0x1F000408,0x010F0101,0x00001F01,0x00000000
+	.word 0x1F000A04,0x010F0101,0x00001F01,0x00000000,0x1F001200,0x010F0101,0x00001F01,0x00000000
+	.word 0x07000201,0x02020202,0x00000702,0x00000000,0x07000204,0x02020202,0x00000702,0x00000000
+	.word 0x0E000A04,0x04040404,0x00000E04,0x00000000,0x0E001100,0x04040404,0x00000E04,0x00000000
+
+	.word 0x1E000000,0x424F4222,0x00001E22,0x00000000,0x21001A16,0x31292523,0x00002121,0x00000000
+	.word 0x1C000804,0x41414122,0x00001C22,0x00000000,0x1C000810,0x41414122,0x00001C22,0x00000000
+	.word 0x1C001408,0x41414122,0x00001C22,0x00000000,0x1C00342C,0x41414122,0x00001C22,0x00000000
+	.word 0x1C002200,0x41414122,0x00001C22,0x00000000,0x00000000,0x040A1100,0x0000110A,0x00000000
+	.word 0x5C000000,0x45495122,0x00001D22,0x00000000,0x21000804,0x21212121,0x00001E21,0x00000000
+	.word 0x21000408,0x21212121,0x00001E21,0x00000000,0x21000A04,0x21212121,0x00001E21,0x00000000
+	.word 0x21001200,0x21212121,0x00001E21,0x00000000,0x11000408,0x040A0A11,0x00000404,0x00000000
+	.word 0x01000000,0x1111110F,0x0000010F,0x00000000,0x09060000,0x09090509,0x00000509,0x00000000
+
+	.word 0x04020000,0x0E080600,0x00000E09,0x00000000,0x04080000,0x0E080600,0x00000E09,0x00000000
+	.word 0x0A040000,0x0E080600,0x00000E09,0x00000000,0x1A160000,0x0E080600,0x00000E09,0x00000000
+	.word 0x0A000000,0x0E080600,0x00000E09,0x00000000,0x0E0A0E00,0x0E080600,0x00000E09,0x00000000
+	.word 0x00000000,0x7E483600,0x00007609,0x00000000,0x00000000,0x01010E00,0x02040E01,0x00000000
+	.word 0x04020000,0x0F090600,0x00000E01,0x00000000,0x04080000,0x0F090600,0x00000E01,0x00000000
+	.word 0x0A040000,0x0F090600,0x00000E01,0x00000000,0x09000000,0x0F090600,0x00000E01,0x00000000
+	.word 0x02010000,0x02020200,0x00000202,0x00000000,0x01020000,0x01010100,0x00000101,0x00000000
+	.word 0x05020000,0x02020200,0x00000202,0x00000000,0x05000000,0x02020200,0x00000202,0x00000000
+
+	.word 0x0C000000,0x111E100A,0x00000E11,0x00000000,0x0D0B0000,0x09090700,0x00000909,0x00000000
+	.word 0x04020000,0x09090600,0x00000609,0x00000000,0x04080000,0x09090600,0x00000609,0x00000000
+	.word 0x0A040000,0x09090600,0x00000609,0x00000000,0x0D0B0000,0x09090600,0x00000609,0x00000000
+	.word 0x09000000,0x09090600,0x00000609,0x00000000,0x00000000,0x001F0004,0x00000004,0x00000000
+	.word 0x00000000,0x12121C20,0x00010E12,0x00000000,0x04020000,0x09090900,0x00000E09,0x00000000
+	.word 0x04080000,0x09090900,0x00000E09,0x00000000,0x0A040000,0x09090900,0x00000E09,0x00000000
+	.word 0x09000000,0x09090900,0x00000E09,0x00000000,0x04080000,0x09090900,0x02020406,0x00000000
+	.word 0x01010000,0x09090701,0x01010709,0x00000000,0x09000000,0x09090900,0x02020406,0x00000000
+
+	.section .rodata
+	.align	2
+	.global verdana9Widths		@ 224 unsigned chars
+verdana9Widths:
+	.byte 0x03,0x02,0x04,0x06,0x06,0x08,0x07,0x02,0x04,0x04,0x06,0x06,0x03,0x04,0x03,0x05
+	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x03,0x03,0x06,0x06,0x06,0x05
+	.byte 0x08,0x07,0x06,0x07,0x07,0x06,0x06,0x07,0x07,0x04,0x04,0x06,0x06,0x08,0x07,0x08
+	.byte 0x06,0x08,0x06,0x06,0x07,0x07,0x07,0x08,0x06,0x06,0x06,0x03,0x05,0x03,0x06,0x06
+	.byte 0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x02,0x04,0x05,0x02,0x08,0x05,0x05
+	.byte 0x05,0x05,0x04,0x05,0x05,0x05,0x05,0x06,0x05,0x05,0x04,0x06,0x04,0x06,0x06,0x05
+	.byte 0x06,0x03,0x03,0x07,0x05,0x06,0x06,0x06,0x04,0x08,0x07,0x04,0x08,0x03,0x06,0x03
+	.byte 0x03,0x03,0x03,0x05,0x05,0x04,0x06,0x08,0x05,0x08,0x06,0x04,0x08,0x03,0x04,0x06
+
+	.byte 0x03,0x02,0x06,0x06,0x06,0x06,0x04,0x05,0x06,0x08,0x05,0x06,0x06,0x05,0x08,0x06
+	.byte 0x05,0x06,0x04,0x04,0x05,0x05,0x06,0x03,0x04,0x04,0x05,0x06,0x08,0x08,0x08,0x05
+	.byte 0x07,0x07,0x07,0x07,0x07,0x08,0x08,0x07,0x06,0x06,0x06,0x06,0x04,0x04,0x05,0x05
+	.byte 0x08,0x07,0x08,0x08,0x08,0x08,0x08,0x06,0x08,0x07,0x07,0x07,0x07,0x06,0x06,0x05
+	.byte 0x05,0x05,0x05,0x05,0x05,0x05,0x08,0x05,0x05,0x05,0x05,0x05,0x03,0x02,0x03,0x03
+	.byte 0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x06,0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x05
+
+@}}BLOCK(verdana9)
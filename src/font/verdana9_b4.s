@@ -1,545 +1,545 @@
-
-@{{BLOCK(verdana9_b4)
-
-@ Verdana 9 from ' ' to ''. 4bpp, with (i,s,p) = (1,2,4)
-
-	.section .rodata
-	.align	2
-	.global	verdana9_b4Font
-verdana9_b4Font:
-	.word	verdana9_b4Glyphs, verdana9_b4Widths, 0
-	.hword	32, 224
-	.byte	8, 12
-	.byte	8, 16
-	.hword	64
-	.byte	4, 0
-
-	.section .rodata
-	.align	2
-	.global verdana9_b4Glyphs		@ 14336 unsigned chars
-verdana9_b4Glyphs:
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214
-	.word 0x00004444,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00002121,0x00002121,0x00002121,0x00004444,0x00004444,0x00004444
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00421214,0x00211111,0x00421214,0x00211111
-	.word 0x00421214,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00442144,0x00442144,0x00211114,0x00442121,0x00442114,0x00421144
-	.word 0x00212144,0x00421111,0x00442144,0x00442144,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x42144214,0x44212121,0x44212121,0x42121214,0x21212144
-	.word 0x21212144,0x42144214,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04444444,0x04444444,0x04444444,0x04442114,0x04421421,0x04421421,0x02142114,0x02121421
-	.word 0x04214421,0x02121114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000214,0x00000214,0x00000214,0x00000444,0x00000444,0x00000444
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00004444,0x00004444,0x00002144,0x00004214,0x00004421,0x00004421,0x00004421,0x00004421
-	.word 0x00004421,0x00004421,0x00004214,0x00002144,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004421,0x00004214,0x00002144,0x00002144,0x00002144,0x00002144
-	.word 0x00002144,0x00002144,0x00004214,0x00004421,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00442144,0x00212121,0x00421114,0x00212121,0x00442144,0x00444444,0x00444444
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00442144,0x00442144,0x00211111,0x00442144
-	.word 0x00442144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444
-	.word 0x00004214,0x00004214,0x00004421,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042111,0x00044444
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444
-	.word 0x00004214,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00021444,0x00021444,0x00042144,0x00042144,0x00044214,0x00044214
-	.word 0x00044214,0x00044421,0x00044421,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214421,0x00214421,0x00214421
-	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00442144,0x00442114,0x00442144,0x00442144,0x00442144
-	.word 0x00442144,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214444,0x00421444,0x00442144
-	.word 0x00444214,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214444,0x00421144,0x00214444
-	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00421444,0x00421144,0x00421214,0x00421421,0x00211111
-	.word 0x00421444,0x00421444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00444421,0x00421111,0x00214444,0x00214444
-	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00421144,0x00444214,0x00444421,0x00421111,0x00214421
-	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00214444,0x00421444,0x00421444,0x00442144
-	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214421,0x00421114,0x00214421
-	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214421,0x00211114,0x00214444
-	.word 0x00421444,0x00442114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004214,0x00004214,0x00004444
-	.word 0x00004214,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004214,0x00004214,0x00004444
-	.word 0x00004214,0x00004214,0x00004421,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00214444,0x00421144,0x00444211,0x00421144
-	.word 0x00214444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00211111,0x00444444,0x00211111
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444421,0x00442114,0x00211444,0x00442114
-	.word 0x00444421,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00042111,0x00021444,0x00021444,0x00042144,0x00044214
-	.word 0x00044444,0x00044214,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444444,0x44444444,0x21111144,0x14444214,0x12111421,0x12142121,0x12142121
-	.word 0x21211421,0x44444214,0x21111144,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04444444,0x04444444,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
-	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00442111,0x00421421,0x00421421,0x00421111,0x00214421
-	.word 0x00214421,0x00421111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04444444,0x04444444,0x04444444,0x04211144,0x02144214,0x04444421,0x04444421,0x04444421
-	.word 0x02144214,0x04211144,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x04444444,0x04444444,0x04444444,0x04421111,0x04214421,0x02144421,0x02144421,0x02144421
-	.word 0x04214421,0x04421111,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
-	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
-	.word 0x00444421,0x00444421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04444444,0x04444444,0x04444444,0x04211144,0x02144214,0x04444421,0x02111421,0x02144421
-	.word 0x02144214,0x04211144,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x04444444,0x04444444,0x04444444,0x02144421,0x02144421,0x02144421,0x02111111,0x02144421
-	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00002111,0x00004214,0x00004214,0x00004214,0x00004214
-	.word 0x00004214,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00002114,0x00002144,0x00002144,0x00002144,0x00002144
-	.word 0x00002144,0x00004211,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00214421,0x00421421,0x00442121,0x00444211,0x00442121
-	.word 0x00421421,0x00214421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00444421,0x00444421,0x00444421,0x00444421,0x00444421
-	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x21144211,0x21144211,0x21212121,0x21212121,0x21421421
-	.word 0x21421421,0x21444421,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04444444,0x04444444,0x04444444,0x02144421,0x02144211,0x02142121,0x02121421,0x02114421
-	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
-	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00421111,0x00214421,0x00214421,0x00214421,0x00421111
-	.word 0x00444421,0x00444421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
-	.word 0x42144214,0x44211144,0x44214444,0x21144444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00421111,0x00214421,0x00214421,0x00421111,0x00442121
-	.word 0x00421421,0x00214421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00444421,0x00421114,0x00214444
-	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444444,0x44444444,0x21111111,0x44421444,0x44421444,0x44421444,0x44421444
-	.word 0x44421444,0x44421444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04444444,0x04444444,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
-	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04444444,0x04444444,0x04444444,0x02144421,0x02144421,0x02144421,0x04214214,0x04214214
-	.word 0x04421144,0x04421144,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x21444421,0x21421421,0x21421421,0x21212121,0x21212121
-	.word 0x42144214,0x42144214,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00214421,0x00214421,0x00421214,0x00442144,0x00421214
-	.word 0x00214421,0x00214421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00214421,0x00214421,0x00421214,0x00421214,0x00442144
-	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00214444,0x00421444,0x00442144,0x00444214
-	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000211,0x00000421,0x00000421,0x00000421,0x00000421,0x00000421
-	.word 0x00000421,0x00000421,0x00000421,0x00000211,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044214,0x00044214,0x00044214,0x00042144
-	.word 0x00042144,0x00021444,0x00021444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000211,0x00000214,0x00000214,0x00000214,0x00000214,0x00000214
-	.word 0x00000214,0x00000214,0x00000214,0x00000211,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00442144,0x00421214,0x00214421,0x00444444,0x00444444
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444
-	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00044444,0x00044444,0x00044444
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042114,0x00021444,0x00021114
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044421,0x00042111,0x00021421,0x00021421
-	.word 0x00021421,0x00042111,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00044421,0x00044421
-	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00021444,0x00021444,0x00021444,0x00021114,0x00021421,0x00021421
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042114,0x00021421,0x00021111
-	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00021144,0x00044214,0x00044214,0x00042111,0x00044214,0x00044214
-	.word 0x00044214,0x00044214,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00021421,0x00021421
-	.word 0x00021421,0x00021114,0x00021444,0x00042114,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044421,0x00042111,0x00021421,0x00021421
-	.word 0x00021421,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000044,0x00000044,0x00000044,0x00000021,0x00000044,0x00000021,0x00000021,0x00000021
-	.word 0x00000021,0x00000021,0x00000044,0x00000044,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00002144,0x00004444,0x00002114,0x00002144,0x00002144
-	.word 0x00002144,0x00002144,0x00002144,0x00004211,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044421,0x00021421,0x00042121,0x00044211
-	.word 0x00042121,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00004444,0x00004444,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214
-	.word 0x00004214,0x00002114,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42112111,0x21421421,0x21421421
-	.word 0x21421421,0x21421421,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042111,0x00021421,0x00021421
-	.word 0x00021421,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042114,0x00021421,0x00021421
-	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042111,0x00021421,0x00021421
-	.word 0x00021421,0x00042111,0x00044421,0x00044421,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00021421,0x00021421
-	.word 0x00021421,0x00021114,0x00021444,0x00021444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00002121,0x00004211,0x00004421
-	.word 0x00004421,0x00004421,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00044421,0x00042114
-	.word 0x00021444,0x00042111,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044214,0x00021111,0x00044214,0x00044214
-	.word 0x00044214,0x00021144,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00042114,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00214421,0x00212121,0x00212121
-	.word 0x00421214,0x00421214,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00042114
-	.word 0x00021421,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00042114,0x00042144,0x00044214,0x00044210,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00002111,0x00002144,0x00004214
-	.word 0x00004421,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00211444,0x00442144,0x00442144,0x00442144,0x00442144,0x00444211
-	.word 0x00442144,0x00442144,0x00442144,0x00211444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00004444,0x00004444,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214
-	.word 0x00004214,0x00004214,0x00004214,0x00004214,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444211,0x00442144,0x00442144,0x00442144,0x00442144,0x00211444
-	.word 0x00442144,0x00442144,0x00442144,0x00444211,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00212114,0x00421121
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00021111,0x00021111,0x00021111,0x00021111
-	.word 0x00021111,0x00021111,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00211144,0x00444214,0x00421111,0x00444214,0x00421111
-	.word 0x00444214,0x00211144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
-	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444
-	.word 0x00000214,0x00000214,0x00000421,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04444444,0x04444444,0x04444444,0x02114444,0x04421444,0x04421444,0x04211114,0x04442144
-	.word 0x04442144,0x04442144,0x04442144,0x04444211,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444
-	.word 0x00021214,0x00021214,0x00042121,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444
-	.word 0x00444444,0x00212121,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00442144,0x00442144,0x00211111,0x00442144,0x00442144,0x00442144
-	.word 0x00442144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00442144,0x00442144,0x00211111,0x00442144,0x00211111,0x00442144
-	.word 0x00442144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00004444,0x00004444,0x00004214,0x00002121,0x00004444,0x00004444,0x00004444,0x00004444
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444214,0x42142121,0x44212121,0x44421214,0x44442144,0x21214214,0x12121421
-	.word 0x12121444,0x21214444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04212144,0x04421444,0x04444444,0x04211144,0x02144214,0x04444214,0x04211144,0x02144444
-	.word 0x02144214,0x04211144,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00002144,0x00004214,0x00004214
-	.word 0x00002144,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444444,0x44444444,0x11111114,0x44214421,0x44214421,0x11114421,0x44214421
-	.word 0x44214421,0x11111114,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
-	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00421214,0x00442144,0x00444444,0x00211111,0x00214444,0x00421444,0x00442144,0x00444214
-	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
-	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
-	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000421,0x00000421,0x00000214,0x00000444,0x00000444,0x00000444
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000214,0x00000214,0x00000421,0x00000444,0x00000444,0x00000444
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00042121,0x00042121,0x00021214,0x00044444,0x00044444,0x00044444
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00021214,0x00021214,0x00042121,0x00044444,0x00044444,0x00044444
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00002111,0x00002111,0x00002111
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00211111
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x21111111
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00021211,0x00021121,0x00044444,0x00044444,0x00044444,0x00044444
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x21421111,0x21111214,0x21421214,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00212144,0x00421444,0x00444444,0x00211144,0x00444214,0x00421144
-	.word 0x00214444,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004214,0x00002144,0x00002144
-	.word 0x00004214,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42112114,0x21421421,0x21111421
-	.word 0x44421421,0x21112114,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
-	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00002121,0x00004214,0x00004444,0x00002111,0x00002144,0x00004214
-	.word 0x00004421,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00214421,0x00444444,0x00214421,0x00214421,0x00421214,0x00421214,0x00442144
-	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000044,0x00000044,0x00000044,0x00000021,0x00000044,0x00000021,0x00000021,0x00000021
-	.word 0x00000021,0x00000021,0x00000044,0x00000044,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00442144,0x00442144,0x00211114,0x00442121,0x00442121
-	.word 0x00442121,0x00211114,0x00442144,0x00442144,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00211144,0x00444214,0x00444214,0x00421111,0x00444214
-	.word 0x00444214,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00214421,0x00421114,0x00421214,0x00421114
-	.word 0x00214421,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00214421,0x00214421,0x00421214,0x00442144,0x00211111
-	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004214,0x00004214,0x00004214,0x00004214,0x00004444,0x00004444
-	.word 0x00004214,0x00004214,0x00004214,0x00004214,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00021114,0x00044421,0x00042114,0x00021421,0x00021421
-	.word 0x00042114,0x00021444,0x00042111,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00421421,0x00444444,0x00444444,0x00444444,0x00444444
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x42111144,0x21444214,0x12111421,0x14442121,0x14442121
-	.word 0x12111421,0x21444214,0x42111144,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00042111,0x00021444,0x00021114,0x00021421,0x00021114
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00212144,0x00421214,0x00421214
-	.word 0x00212144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x04444444,0x04444444,0x04444444,0x04444444,0x04444444,0x04444444,0x02111114,0x02144444
-	.word 0x02144444,0x04444444,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00044444
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x42111144,0x21444214,0x14211121,0x12142121,0x14211121
-	.word 0x12142121,0x21444214,0x42111144,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00211111,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044444,0x00042114,0x00021421,0x00021421,0x00042114,0x00044444
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00442144,0x00442144,0x00211111,0x00442144
-	.word 0x00211111,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00002111,0x00002144,0x00004214,0x00002111,0x00004444
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00002111,0x00004214,0x00002144,0x00002111,0x00004444
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00042144,0x00044214,0x00044444,0x00044444,0x00044444,0x00044444
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00021421,0x00021111,0x00044421,0x00044421,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00211114,0x00212111,0x00212111,0x00212114,0x00212144
-	.word 0x00212144,0x00212144,0x00212144,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000214,0x00000214
-	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444
-	.word 0x00004444,0x00004444,0x00002144,0x00004214,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00004214,0x00004211,0x00004214,0x00002111,0x00004444
-	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00042114,0x00021421,0x00021421,0x00021421,0x00042114
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00421214,0x00212144,0x00212144
-	.word 0x00421214,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444214,0x42144211,0x44214214,0x44421214,0x44442144,0x42114214,0x42121421
-	.word 0x21111444,0x42144444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444214,0x42144211,0x44214214,0x44421214,0x44442144,0x21114214,0x21444421
-	.word 0x42144444,0x21114444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44442111,0x42144214,0x44212144,0x44421211,0x44442144,0x42114214,0x42121421
-	.word 0x21111444,0x42144444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00042144,0x00044444,0x00042144,0x00044214,0x00044421
-	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x04442144,0x04421444,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
-	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04442144,0x04442144,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
-	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04442144,0x04421214,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
-	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04212114,0x04211214,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
-	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x04444444,0x04214214,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
-	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44211444,0x42142144,0x42142144,0x44211444,0x44211444,0x42142144,0x42142144
-	.word 0x21111114,0x21444214,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x11111444,0x44212144,0x44212144,0x11114214,0x44211114
-	.word 0x44214421,0x11114421,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04444444,0x04444444,0x04444444,0x04211142,0x02144214,0x04444421,0x04444421,0x04444421
-	.word 0x02144214,0x04211142,0x04421444,0x04442144,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444214,0x00442144,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
-	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00421444,0x00442144,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
-	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00442144,0x00421214,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
-	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00214214,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
-	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00004421,0x00004214,0x00004444,0x00002111,0x00004214,0x00004214,0x00004214,0x00004214
-	.word 0x00004214,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00002144,0x00004214,0x00004444,0x00002111,0x00004214,0x00004214,0x00004214,0x00004214
-	.word 0x00004214,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00042144,0x00021214,0x00044444,0x00021114,0x00042144,0x00042144,0x00042144,0x00042144
-	.word 0x00042144,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00214421,0x00444444,0x00421114,0x00442144,0x00442144,0x00442144,0x00442144
-	.word 0x00442144,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444444,0x44444444,0x44211114,0x42144214,0x21444214,0x21421111,0x21444214
-	.word 0x42144214,0x44211114,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04212114,0x04211214,0x04444444,0x02144421,0x02144211,0x02142121,0x02121421,0x02114421
-	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44442144,0x44421444,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
-	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44214444,0x44421444,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
-	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44421444,0x44212144,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
-	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x42121144,0x42112144,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
-	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x42144214,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
-	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00214421,0x00421214,0x00442144
-	.word 0x00421214,0x00214421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444444,0x44444444,0x21211144,0x42144214,0x21214421,0x21421421,0x21442121
-	.word 0x42144214,0x44211121,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04442144,0x04421444,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
-	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04421444,0x04442144,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
-	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x04442144,0x04421214,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
-	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x04444444,0x04214214,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
-	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00421444,0x00442144,0x00444444,0x00214421,0x00214421,0x00421214,0x00421214,0x00442144
-	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444421,0x00421111,0x00214421,0x00214421,0x00214421
-	.word 0x00421111,0x00444421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00042114,0x00021421,0x00021421,0x00042121,0x00021421,0x00021421
-	.word 0x00021421,0x00042121,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00042114,0x00021444,0x00021114
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00042114,0x00021444,0x00021114
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00042144,0x00021214,0x00044444,0x00042114,0x00021444,0x00021114
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00212114,0x00211214,0x00444444,0x00442114,0x00421444,0x00421114
-	.word 0x00421421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044444,0x00021214,0x00044444,0x00042114,0x00021444,0x00021114
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00021114,0x00021214,0x00021114,0x00044444,0x00042114,0x00021444,0x00021114
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42112114,0x21421444,0x21111114
-	.word 0x44421421,0x21112114,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00044421,0x00044421
-	.word 0x00044421,0x00021114,0x00042144,0x00044214,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00042114,0x00021421,0x00021111
-	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00042114,0x00021421,0x00021111
-	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00042144,0x00021214,0x00044444,0x00042114,0x00021421,0x00021111
-	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00021421,0x00044444,0x00042114,0x00021421,0x00021111
-	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000444,0x00000444,0x00000421,0x00000214,0x00000444,0x00000214,0x00000214,0x00000214
-	.word 0x00000214,0x00000214,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000444,0x00000444,0x00000214,0x00000421,0x00000444,0x00000421,0x00000421,0x00000421
-	.word 0x00000421,0x00000421,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004214,0x00002121,0x00004444,0x00004214,0x00004214,0x00004214
-	.word 0x00004214,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00004444,0x00004444,0x00004444,0x00002121,0x00004444,0x00004214,0x00004214,0x00004214
-	.word 0x00004214,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00444444,0x00444444,0x00444444,0x00421144,0x00421214,0x00214444,0x00211114,0x00214421
-	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00021211,0x00021121,0x00044444,0x00042111,0x00021421,0x00021421
-	.word 0x00021421,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00042114,0x00021421,0x00021421
-	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00042114,0x00021421,0x00021421
-	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00042144,0x00021214,0x00044444,0x00042114,0x00021421,0x00021421
-	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00021211,0x00021121,0x00044444,0x00042114,0x00021421,0x00021421
-	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00021421,0x00044444,0x00042114,0x00021421,0x00021421
-	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00442144,0x00444444,0x00211111,0x00444444
-	.word 0x00442144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x04444444,0x04444444,0x04444444,0x04444444,0x02144444,0x04211144,0x04214214,0x04214214
-	.word 0x04214214,0x04421114,0x04444421,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00042144,0x00021214,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00044444,0x00044444,0x00044444,0x00021421,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00042114,0x00042144,0x00044214,0x00044214,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044421,0x00042111,0x00021421,0x00021421
-	.word 0x00021421,0x00042111,0x00044421,0x00044421,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044444,0x00044444,0x00044444,0x00021421,0x00044444,0x00021421,0x00021421,0x00021421
-	.word 0x00042114,0x00042144,0x00044214,0x00044214,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.section .rodata
-	.align	2
-	.global verdana9_b4Widths		@ 224 unsigned chars
-verdana9_b4Widths:
-	.byte 0x03,0x04,0x04,0x06,0x06,0x08,0x07,0x03,0x04,0x04,0x06,0x06,0x04,0x05,0x04,0x05
-	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x04,0x04,0x06,0x06,0x06,0x05
-	.byte 0x08,0x07,0x06,0x07,0x07,0x06,0x06,0x07,0x07,0x04,0x04,0x06,0x06,0x08,0x07,0x08
-	.byte 0x06,0x08,0x06,0x06,0x08,0x07,0x07,0x08,0x06,0x06,0x06,0x03,0x05,0x03,0x06,0x06
-	.byte 0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x02,0x04,0x05,0x04,0x08,0x05,0x05
-	.byte 0x05,0x05,0x04,0x05,0x05,0x05,0x05,0x06,0x05,0x05,0x04,0x06,0x04,0x06,0x06,0x05
-	.byte 0x06,0x03,0x03,0x07,0x05,0x06,0x06,0x06,0x04,0x08,0x07,0x04,0x08,0x03,0x06,0x03
-	.byte 0x03,0x03,0x03,0x05,0x05,0x04,0x06,0x08,0x05,0x08,0x06,0x04,0x08,0x03,0x04,0x06
-
-	.byte 0x03,0x02,0x06,0x06,0x06,0x06,0x04,0x05,0x06,0x08,0x05,0x06,0x07,0x05,0x08,0x06
-	.byte 0x05,0x06,0x04,0x04,0x05,0x05,0x06,0x03,0x04,0x04,0x05,0x06,0x08,0x08,0x08,0x05
-	.byte 0x07,0x07,0x07,0x07,0x07,0x08,0x08,0x07,0x06,0x06,0x06,0x06,0x04,0x04,0x05,0x06
-	.byte 0x08,0x07,0x08,0x08,0x08,0x08,0x08,0x06,0x08,0x07,0x07,0x07,0x07,0x06,0x06,0x05
-	.byte 0x05,0x05,0x05,0x06,0x05,0x05,0x08,0x05,0x05,0x05,0x05,0x05,0x03,0x03,0x04,0x04
-	.byte 0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x06,0x07,0x05,0x05,0x05,0x05,0x05,0x05,0x05
-
-@}}BLOCK(verdana9_b4)
+
+@{{BLOCK(verdana9_b4)
+
+@ Verdana 9 from ' ' to ''. 4bpp, with (i,s,p) = (1,2,4)
+
+	.section .rodata
+	.align	2
+	.global	verdana9_b4Font
+verdana9_b4Font:
+	.word	verdana9_b4Glyphs, verdana9_b4Widths, 0
+	.hword	32, 224
+	.byte	8, 12
+	.byte	8, 16
+	.hword	64
+	.byte	4, 0
+
+	.section .rodata
+	.align	2
+	.global verdana9_b4Glyphs		@ 14336 unsigned chars
+verdana9_b4Glyphs:
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214
+	.word 0x00004444,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00002121,0x00002121,0x00002121,0x00004444,0x00004444,0x00004444
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00421214,0x00211111,0x00421214,0x00211111
+	.word 0x00421214,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00442144,0x00442144,0x00211114,0x00442121,0x00442114,0x00421144
+	.word 0x00212144,0x00421111,0x00442144,0x00442144,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x42144214,0x44212121,0x44212121,0x42121214,0x21212144
+	.word 0x21212144,0x42144214,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04444444,0x04444444,0x04444444,0x04442114,0x04421421,0x04421421,0x02142114,0x02121421
+	.word 0x04214421,0x02121114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000214,0x00000214,0x00000214,0x00000444,0x00000444,0x00000444
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00004444,0x00004444,0x00002144,0x00004214,0x00004421,0x00004421,0x00004421,0x00004421
+	.word 0x00004421,0x00004421,0x00004214,0x00002144,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004421,0x00004214,0x00002144,0x00002144,0x00002144,0x00002144
+	.word 0x00002144,0x00002144,0x00004214,0x00004421,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00442144,0x00212121,0x00421114,0x00212121,0x00442144,0x00444444,0x00444444
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00442144,0x00442144,0x00211111,0x00442144
+	.word 0x00442144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444
+	.word 0x00004214,0x00004214,0x00004421,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042111,0x00044444
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444
+	.word 0x00004214,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00021444,0x00021444,0x00042144,0x00042144,0x00044214,0x00044214
+	.word 0x00044214,0x00044421,0x00044421,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214421,0x00214421,0x00214421
+	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00442144,0x00442114,0x00442144,0x00442144,0x00442144
+	.word 0x00442144,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214444,0x00421444,0x00442144
+	.word 0x00444214,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214444,0x00421144,0x00214444
+	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00421444,0x00421144,0x00421214,0x00421421,0x00211111
+	.word 0x00421444,0x00421444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00444421,0x00421111,0x00214444,0x00214444
+	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00421144,0x00444214,0x00444421,0x00421111,0x00214421
+	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00214444,0x00421444,0x00421444,0x00442144
+	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214421,0x00421114,0x00214421
+	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00214421,0x00211114,0x00214444
+	.word 0x00421444,0x00442114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004214,0x00004214,0x00004444
+	.word 0x00004214,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004214,0x00004214,0x00004444
+	.word 0x00004214,0x00004214,0x00004421,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00214444,0x00421144,0x00444211,0x00421144
+	.word 0x00214444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00211111,0x00444444,0x00211111
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444421,0x00442114,0x00211444,0x00442114
+	.word 0x00444421,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00042111,0x00021444,0x00021444,0x00042144,0x00044214
+	.word 0x00044444,0x00044214,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x44444444,0x44444444,0x44444444,0x21111144,0x14444214,0x12111421,0x12142121,0x12142121
+	.word 0x21211421,0x44444214,0x21111144,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04444444,0x04444444,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
+	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00442111,0x00421421,0x00421421,0x00421111,0x00214421
+	.word 0x00214421,0x00421111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04444444,0x04444444,0x04444444,0x04211144,0x02144214,0x04444421,0x04444421,0x04444421
+	.word 0x02144214,0x04211144,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x04444444,0x04444444,0x04444444,0x04421111,0x04214421,0x02144421,0x02144421,0x02144421
+	.word 0x04214421,0x04421111,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
+	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
+	.word 0x00444421,0x00444421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04444444,0x04444444,0x04444444,0x04211144,0x02144214,0x04444421,0x02111421,0x02144421
+	.word 0x02144214,0x04211144,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x04444444,0x04444444,0x04444444,0x02144421,0x02144421,0x02144421,0x02111111,0x02144421
+	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00002111,0x00004214,0x00004214,0x00004214,0x00004214
+	.word 0x00004214,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00002114,0x00002144,0x00002144,0x00002144,0x00002144
+	.word 0x00002144,0x00004211,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00214421,0x00421421,0x00442121,0x00444211,0x00442121
+	.word 0x00421421,0x00214421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00444421,0x00444421,0x00444421,0x00444421,0x00444421
+	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x21144211,0x21144211,0x21212121,0x21212121,0x21421421
+	.word 0x21421421,0x21444421,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04444444,0x04444444,0x04444444,0x02144421,0x02144211,0x02142121,0x02121421,0x02114421
+	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
+	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00421111,0x00214421,0x00214421,0x00214421,0x00421111
+	.word 0x00444421,0x00444421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
+	.word 0x42144214,0x44211144,0x44214444,0x21144444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00421111,0x00214421,0x00214421,0x00421111,0x00442121
+	.word 0x00421421,0x00214421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00421114,0x00214421,0x00444421,0x00421114,0x00214444
+	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x44444444,0x44444444,0x44444444,0x21111111,0x44421444,0x44421444,0x44421444,0x44421444
+	.word 0x44421444,0x44421444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04444444,0x04444444,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
+	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04444444,0x04444444,0x04444444,0x02144421,0x02144421,0x02144421,0x04214214,0x04214214
+	.word 0x04421144,0x04421144,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x21444421,0x21421421,0x21421421,0x21212121,0x21212121
+	.word 0x42144214,0x42144214,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00214421,0x00214421,0x00421214,0x00442144,0x00421214
+	.word 0x00214421,0x00214421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00214421,0x00214421,0x00421214,0x00421214,0x00442144
+	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00214444,0x00421444,0x00442144,0x00444214
+	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000211,0x00000421,0x00000421,0x00000421,0x00000421,0x00000421
+	.word 0x00000421,0x00000421,0x00000421,0x00000211,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044214,0x00044214,0x00044214,0x00042144
+	.word 0x00042144,0x00021444,0x00021444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000211,0x00000214,0x00000214,0x00000214,0x00000214,0x00000214
+	.word 0x00000214,0x00000214,0x00000214,0x00000211,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00442144,0x00421214,0x00214421,0x00444444,0x00444444
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444
+	.word 0x00444444,0x00444444,0x00444444,0x00211111,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00044444,0x00044444,0x00044444
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042114,0x00021444,0x00021114
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044421,0x00042111,0x00021421,0x00021421
+	.word 0x00021421,0x00042111,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00044421,0x00044421
+	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00021444,0x00021444,0x00021444,0x00021114,0x00021421,0x00021421
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042114,0x00021421,0x00021111
+	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00021144,0x00044214,0x00044214,0x00042111,0x00044214,0x00044214
+	.word 0x00044214,0x00044214,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00021421,0x00021421
+	.word 0x00021421,0x00021114,0x00021444,0x00042114,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044421,0x00042111,0x00021421,0x00021421
+	.word 0x00021421,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000044,0x00000044,0x00000044,0x00000021,0x00000044,0x00000021,0x00000021,0x00000021
+	.word 0x00000021,0x00000021,0x00000044,0x00000044,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00002144,0x00004444,0x00002114,0x00002144,0x00002144
+	.word 0x00002144,0x00002144,0x00002144,0x00004211,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044421,0x00021421,0x00042121,0x00044211
+	.word 0x00042121,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00004444,0x00004444,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214
+	.word 0x00004214,0x00002114,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42112111,0x21421421,0x21421421
+	.word 0x21421421,0x21421421,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042111,0x00021421,0x00021421
+	.word 0x00021421,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042114,0x00021421,0x00021421
+	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00042111,0x00021421,0x00021421
+	.word 0x00021421,0x00042111,0x00044421,0x00044421,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00021421,0x00021421
+	.word 0x00021421,0x00021114,0x00021444,0x00021444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00002121,0x00004211,0x00004421
+	.word 0x00004421,0x00004421,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00044421,0x00042114
+	.word 0x00021444,0x00042111,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044214,0x00021111,0x00044214,0x00044214
+	.word 0x00044214,0x00021144,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00042114,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00214421,0x00212121,0x00212121
+	.word 0x00421214,0x00421214,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00042114
+	.word 0x00021421,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00042114,0x00042144,0x00044214,0x00044210,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00002111,0x00002144,0x00004214
+	.word 0x00004421,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00211444,0x00442144,0x00442144,0x00442144,0x00442144,0x00444211
+	.word 0x00442144,0x00442144,0x00442144,0x00211444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00004444,0x00004444,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214,0x00004214
+	.word 0x00004214,0x00004214,0x00004214,0x00004214,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444211,0x00442144,0x00442144,0x00442144,0x00442144,0x00211444
+	.word 0x00442144,0x00442144,0x00442144,0x00444211,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00212114,0x00421121
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00021111,0x00021111,0x00021111,0x00021111
+	.word 0x00021111,0x00021111,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00211144,0x00444214,0x00421111,0x00444214,0x00421111
+	.word 0x00444214,0x00211144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
+	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444
+	.word 0x00000214,0x00000214,0x00000421,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04444444,0x04444444,0x04444444,0x02114444,0x04421444,0x04421444,0x04211114,0x04442144
+	.word 0x04442144,0x04442144,0x04442144,0x04444211,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444
+	.word 0x00021214,0x00021214,0x00042121,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444
+	.word 0x00444444,0x00212121,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00442144,0x00442144,0x00211111,0x00442144,0x00442144,0x00442144
+	.word 0x00442144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00442144,0x00442144,0x00211111,0x00442144,0x00211111,0x00442144
+	.word 0x00442144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00004444,0x00004444,0x00004214,0x00002121,0x00004444,0x00004444,0x00004444,0x00004444
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444214,0x42142121,0x44212121,0x44421214,0x44442144,0x21214214,0x12121421
+	.word 0x12121444,0x21214444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04212144,0x04421444,0x04444444,0x04211144,0x02144214,0x04444214,0x04211144,0x02144444
+	.word 0x02144214,0x04211144,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00002144,0x00004214,0x00004214
+	.word 0x00002144,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x44444444,0x44444444,0x44444444,0x11111114,0x44214421,0x44214421,0x11114421,0x44214421
+	.word 0x44214421,0x11111114,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
+	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00421214,0x00442144,0x00444444,0x00211111,0x00214444,0x00421444,0x00442144,0x00444214
+	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
+	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
+	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000421,0x00000421,0x00000214,0x00000444,0x00000444,0x00000444
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000214,0x00000214,0x00000421,0x00000444,0x00000444,0x00000444
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00042121,0x00042121,0x00021214,0x00044444,0x00044444,0x00044444
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00021214,0x00021214,0x00042121,0x00044444,0x00044444,0x00044444
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00002111,0x00002111,0x00002111
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00211111
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x21111111
+	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00021211,0x00021121,0x00044444,0x00044444,0x00044444,0x00044444
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x21421111,0x21111214,0x21421214,0x44444444,0x44444444
+	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00212144,0x00421444,0x00444444,0x00211144,0x00444214,0x00421144
+	.word 0x00214444,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004214,0x00002144,0x00002144
+	.word 0x00004214,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42112114,0x21421421,0x21111421
+	.word 0x44421421,0x21112114,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000444,0x00000211,0x00000211,0x00000211,0x00000211,0x00000211
+	.word 0x00000211,0x00000211,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00002121,0x00004214,0x00004444,0x00002111,0x00002144,0x00004214
+	.word 0x00004421,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00214421,0x00444444,0x00214421,0x00214421,0x00421214,0x00421214,0x00442144
+	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000044,0x00000044,0x00000044,0x00000021,0x00000044,0x00000021,0x00000021,0x00000021
+	.word 0x00000021,0x00000021,0x00000044,0x00000044,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00442144,0x00442144,0x00211114,0x00442121,0x00442121
+	.word 0x00442121,0x00211114,0x00442144,0x00442144,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00211144,0x00444214,0x00444214,0x00421111,0x00444214
+	.word 0x00444214,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00214421,0x00421114,0x00421214,0x00421114
+	.word 0x00214421,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00214421,0x00214421,0x00421214,0x00442144,0x00211111
+	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004214,0x00004214,0x00004214,0x00004214,0x00004444,0x00004444
+	.word 0x00004214,0x00004214,0x00004214,0x00004214,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00021114,0x00044421,0x00042114,0x00021421,0x00021421
+	.word 0x00042114,0x00021444,0x00042111,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00421421,0x00444444,0x00444444,0x00444444,0x00444444
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x42111144,0x21444214,0x12111421,0x14442121,0x14442121
+	.word 0x12111421,0x21444214,0x42111144,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00042111,0x00021444,0x00021114,0x00021421,0x00021114
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00212144,0x00421214,0x00421214
+	.word 0x00212144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x04444444,0x04444444,0x04444444,0x04444444,0x04444444,0x04444444,0x02111114,0x02144444
+	.word 0x02144444,0x04444444,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00044444
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x42111144,0x21444214,0x14211121,0x12142121,0x14211121
+	.word 0x12142121,0x21444214,0x42111144,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00211111,0x00444444,0x00444444,0x00444444,0x00444444,0x00444444
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044444,0x00042114,0x00021421,0x00021421,0x00042114,0x00044444
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00442144,0x00442144,0x00211111,0x00442144
+	.word 0x00211111,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00002111,0x00002144,0x00004214,0x00002111,0x00004444
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00002111,0x00004214,0x00002144,0x00002111,0x00004444
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00042144,0x00044214,0x00044444,0x00044444,0x00044444,0x00044444
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00021421,0x00021111,0x00044421,0x00044421,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00211114,0x00212111,0x00212111,0x00212114,0x00212144
+	.word 0x00212144,0x00212144,0x00212144,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000444,0x00000214,0x00000214
+	.word 0x00000444,0x00000444,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444,0x00004444
+	.word 0x00004444,0x00004444,0x00002144,0x00004214,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00004214,0x00004211,0x00004214,0x00002111,0x00004444
+	.word 0x00004444,0x00004444,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00042114,0x00021421,0x00021421,0x00021421,0x00042114
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00421214,0x00212144,0x00212144
+	.word 0x00421214,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x44444444,0x44444214,0x42144211,0x44214214,0x44421214,0x44442144,0x42114214,0x42121421
+	.word 0x21111444,0x42144444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444214,0x42144211,0x44214214,0x44421214,0x44442144,0x21114214,0x21444421
+	.word 0x42144444,0x21114444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44442111,0x42144214,0x44212144,0x44421211,0x44442144,0x42114214,0x42121421
+	.word 0x21111444,0x42144444,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00042144,0x00044444,0x00042144,0x00044214,0x00044421
+	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x04442144,0x04421444,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
+	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04442144,0x04442144,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
+	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04442144,0x04421214,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
+	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04212114,0x04211214,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
+	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x04444444,0x04214214,0x04444444,0x04421144,0x04421144,0x04214214,0x04214214,0x02111111
+	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44211444,0x42142144,0x42142144,0x44211444,0x44211444,0x42142144,0x42142144
+	.word 0x21111114,0x21444214,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x11111444,0x44212144,0x44212144,0x11114214,0x44211114
+	.word 0x44214421,0x11114421,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04444444,0x04444444,0x04444444,0x04211142,0x02144214,0x04444421,0x04444421,0x04444421
+	.word 0x02144214,0x04211142,0x04421444,0x04442144,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444214,0x00442144,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
+	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00421444,0x00442144,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
+	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00442144,0x00421214,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
+	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00214214,0x00444444,0x00211111,0x00444421,0x00444421,0x00421111,0x00444421
+	.word 0x00444421,0x00211111,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00004421,0x00004214,0x00004444,0x00002111,0x00004214,0x00004214,0x00004214,0x00004214
+	.word 0x00004214,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00002144,0x00004214,0x00004444,0x00002111,0x00004214,0x00004214,0x00004214,0x00004214
+	.word 0x00004214,0x00002111,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00042144,0x00021214,0x00044444,0x00021114,0x00042144,0x00042144,0x00042144,0x00042144
+	.word 0x00042144,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00214421,0x00444444,0x00421114,0x00442144,0x00442144,0x00442144,0x00442144
+	.word 0x00442144,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x44444444,0x44444444,0x44444444,0x44211114,0x42144214,0x21444214,0x21421111,0x21444214
+	.word 0x42144214,0x44211114,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04212114,0x04211214,0x04444444,0x02144421,0x02144211,0x02142121,0x02121421,0x02114421
+	.word 0x02144421,0x02144421,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44442144,0x44421444,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
+	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44214444,0x44421444,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
+	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x44421444,0x44212144,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
+	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x42121144,0x42112144,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
+	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x42144214,0x44444444,0x44211144,0x42144214,0x21444421,0x21444421,0x21444421
+	.word 0x42144214,0x44211144,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00444444,0x00214421,0x00421214,0x00442144
+	.word 0x00421214,0x00214421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x44444444,0x44444444,0x44444444,0x21211144,0x42144214,0x21214421,0x21421421,0x21442121
+	.word 0x42144214,0x44211121,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04442144,0x04421444,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
+	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04421444,0x04442144,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
+	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x04442144,0x04421214,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
+	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x04444444,0x04214214,0x04444444,0x02144421,0x02144421,0x02144421,0x02144421,0x02144421
+	.word 0x02144421,0x04211114,0x04444444,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00421444,0x00442144,0x00444444,0x00214421,0x00214421,0x00421214,0x00421214,0x00442144
+	.word 0x00442144,0x00442144,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444421,0x00421111,0x00214421,0x00214421,0x00214421
+	.word 0x00421111,0x00444421,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00042114,0x00021421,0x00021421,0x00042121,0x00021421,0x00021421
+	.word 0x00021421,0x00042121,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00042114,0x00021444,0x00021114
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00042114,0x00021444,0x00021114
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00042144,0x00021214,0x00044444,0x00042114,0x00021444,0x00021114
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00212114,0x00211214,0x00444444,0x00442114,0x00421444,0x00421114
+	.word 0x00421421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044444,0x00021214,0x00044444,0x00042114,0x00021444,0x00021114
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00021114,0x00021214,0x00021114,0x00044444,0x00042114,0x00021444,0x00021114
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x42112114,0x21421444,0x21111114
+	.word 0x44421421,0x21112114,0x44444444,0x44444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00044444,0x00044444,0x00021114,0x00044421,0x00044421
+	.word 0x00044421,0x00021114,0x00042144,0x00044214,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00042114,0x00021421,0x00021111
+	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00042114,0x00021421,0x00021111
+	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00042144,0x00021214,0x00044444,0x00042114,0x00021421,0x00021111
+	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00021421,0x00044444,0x00042114,0x00021421,0x00021111
+	.word 0x00044421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00000444,0x00000444,0x00000421,0x00000214,0x00000444,0x00000214,0x00000214,0x00000214
+	.word 0x00000214,0x00000214,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00000444,0x00000444,0x00000214,0x00000421,0x00000444,0x00000421,0x00000421,0x00000421
+	.word 0x00000421,0x00000421,0x00000444,0x00000444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004214,0x00002121,0x00004444,0x00004214,0x00004214,0x00004214
+	.word 0x00004214,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00004444,0x00004444,0x00004444,0x00002121,0x00004444,0x00004214,0x00004214,0x00004214
+	.word 0x00004214,0x00004214,0x00004444,0x00004444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00444444,0x00444444,0x00444444,0x00421144,0x00421214,0x00214444,0x00211114,0x00214421
+	.word 0x00214421,0x00421114,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00021211,0x00021121,0x00044444,0x00042111,0x00021421,0x00021421
+	.word 0x00021421,0x00021421,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00042114,0x00021421,0x00021421
+	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00042114,0x00021421,0x00021421
+	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00042144,0x00021214,0x00044444,0x00042114,0x00021421,0x00021421
+	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00021211,0x00021121,0x00044444,0x00042114,0x00021421,0x00021421
+	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00021421,0x00044444,0x00042114,0x00021421,0x00021421
+	.word 0x00021421,0x00042114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00444444,0x00444444,0x00444444,0x00444444,0x00442144,0x00444444,0x00211111,0x00444444
+	.word 0x00442144,0x00444444,0x00444444,0x00444444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x04444444,0x04444444,0x04444444,0x04444444,0x02144444,0x04211144,0x04214214,0x04214214
+	.word 0x04214214,0x04421114,0x04444421,0x04444444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044214,0x00042144,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00042144,0x00021214,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.word 0x00044444,0x00044444,0x00044444,0x00021421,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00021421,0x00021114,0x00044444,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00021444,0x00042144,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00042114,0x00042144,0x00044214,0x00044214,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044421,0x00044421,0x00044421,0x00042111,0x00021421,0x00021421
+	.word 0x00021421,0x00042111,0x00044421,0x00044421,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00044444,0x00044444,0x00044444,0x00021421,0x00044444,0x00021421,0x00021421,0x00021421
+	.word 0x00042114,0x00042144,0x00044214,0x00044214,0x00000000,0x00000000,0x00000000,0x00000000
+
+	.section .rodata
+	.align	2
+	.global verdana9_b4Widths		@ 224 unsigned chars
+verdana9_b4Widths:
+	.byte 0x03,0x04,0x04,0x06,0x06,0x08,0x07,0x03,0x04,0x04,0x06,0x06,0x04,0x05,0x04,0x05
+	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x04,0x04,0x06,0x06,0x06,0x05
+	.byte 0x08,0x07,0x06,0x07,0x07,0x06,0x06,0x07,0x07,0x04,0x04,0x06,0x06,0x08,0x07,0x08
+	.byte 0x06,0x08,0x06,0x06,0x08,0x07,0x07,0x08,0x06,0x06,0x06,0x03,0x05,0x03,0x06,0x06
+	.byte 0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x05,0x02,0x04,0x05,0x04,0x08,0x05,0x05
+	.byte 0x05,0x05,0x04,0x05,0x05,0x05,0x05,0x06,0x05,0x05,0x04,0x06,0x04,0x06,0x06,0x05
+	.byte 0x06,0x03,0x03,0x07,0x05,0x06,0x06,0x06,0x04,0x08,0x07,0x04,0x08,0x03,0x06,0x03
+	.byte 0x03,0x03,0x03,0x05,0x05,0x04,0x06,0x08,0x05,0x08,0x06,0x04,0x08,0x03,0x04,0x06
+
+	.byte 0x03,0x02,0x06,0x06,0x06,0x06,0x04,0x05,0x06,0x08,0x05,0x06,0x07,0x05,0x08,0x06
+	.byte 0x05,0x06,0x04,0x04,0x05,0x05,0x06,0x03,0x04,0x04,0x05,0x06,0x08,0x08,0x08,0x05
+	.byte 0x07,0x07,0x07,0x07,0x07,0x08,0x08,0x07,0x06,0x06,0x06,0x06,0x04,0x04,0x05,0x06
+	.byte 0x08,0x07,0x08,0x08,0x08,0x08,0x08,0x06,0x08,0x07,0x07,0x07,0x07,0x06,0x06,0x05
+	.byte 0x05,0x05,0x05,0x06,0x05,0x05,0x08,0x05,0x05,0x05,0x05,0x05,0x03,0x03,0x04,0x04
+	.byte 0x06,0x05,0x05,0x05,0x05,0x05,0x05,0x06,0x07,0x05,0x05,0x05,0x05,0x05,0x05,0x05
+
+@}}BLOCK(verdana9_b4)
@@ -1,167 +1,167 @@
-
-@{{BLOCK(verdana9b)
-
-@ Verdana 9 bold, ' ' to ''
-
-	.section .rodata
-	.align	2
-	.global	verdana9bFont
-verdana9bFont:
-	.word	verdana9bGlyphs, verdana9bWidths, 0
-	.hword	32, 224
-	.byte	8, 12
-	.byte	8, 16
-	.hword	16
-	.byte	1, 0
-
-	.section .rodata
-	.align	2
-	.global verdana9bGlyphs		@ 3584 unsigned chars
-verdana9bGlyphs:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x06000000,0x06060606,0x00000600,0x00000000
-	.word 0x1B1B0000,0x0000001B,0x00000000,0x00000000,0x28000000,0x3F147E28,0x00000A0A,0x00000000
-	.word 0x04040000,0x1C07170E,0x04040E1D,0x00000000,0x22000000,0xA84A1515,0x000044A8,0x00000000
-	.word 0x0E000000,0x3B6E1B1B,0x00006E33,0x00000000,0x03030000,0x00000003,0x00000000,0x00000000
-	.word 0x060C0000,0x03030303,0x0C060303,0x00000000,0x06030000,0x0C0C0C0C,0x03060C0C,0x00000000
-	.word 0x15040000,0x0004150E,0x00000000,0x00000000,0x00000000,0x083E0808,0x00000008,0x00000000
-	.word 0x00000000,0x00000000,0x00010303,0x00000000,0x00000000,0x00070000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000303,0x00000000,0x10100000,0x02040808,0x00010102,0x00000000
-
-	.word 0x0E000000,0x1B1B1B1B,0x00000E1B,0x00000000,0x0C000000,0x0C0C0C0E,0x00001E0C,0x00000000
-	.word 0x0E000000,0x060C1819,0x00001F03,0x00000000,0x0E000000,0x180E1819,0x00000E19,0x00000000
-	.word 0x18000000,0x3F191A1C,0x00001818,0x00000000,0x1F000000,0x18180F03,0x00000E19,0x00000000
-	.word 0x0E000000,0x1B1B0F03,0x00000E1B,0x00000000,0x1F000000,0x060C0C18,0x00000306,0x00000000
-	.word 0x0E000000,0x1B0E1B1B,0x00000E1B,0x00000000,0x0E000000,0x1E1B1B1B,0x00000E18,0x00000000
-	.word 0x00000000,0x00060600,0x00000606,0x00000000,0x00000000,0x00060600,0x00020606,0x00000000
-	.word 0x00000000,0x06061820,0x00002018,0x00000000,0x00000000,0x3E003E00,0x00000000,0x00000000
-	.word 0x00000000,0x30300C02,0x0000020C,0x00000000,0x0F000000,0x060C1818,0x00000600,0x00000000
-
-	.word 0x3C000000,0xA5A5B942,0x003C0279,0x00000000,0x1C000000,0x3E36361C,0x00006363,0x00000000
-	.word 0x1F000000,0x331F3333,0x00001F33,0x00000000,0x0E000000,0x03030313,0x00000E13,0x00000000
-	.word 0x1F000000,0x33333333,0x00001F33,0x00000000,0x1F000000,0x031F0303,0x00001F03,0x00000000
-	.word 0x1F000000,0x031F0303,0x00000303,0x00000000,0x1E000000,0x3B030323,0x00003E33,0x00000000
-	.word 0x33000000,0x333F3333,0x00003333,0x00000000,0x0F000000,0x06060606,0x00000F06,0x00000000
-	.word 0x0E000000,0x0C0C0C0C,0x0000070C,0x00000000,0x33000000,0x0F070F1B,0x0000331B,0x00000000
-	.word 0x03000000,0x03030303,0x00001F03,0x00000000,0x41000000,0x6D6D7763,0x00006161,0x00000000
-	.word 0x21000000,0x392D2723,0x00002131,0x00000000,0x3E000000,0x63636363,0x00003E63,0x00000000
-
-	.word 0x1F000000,0x1F333333,0x00000303,0x00000000,0x3E000000,0x63636363,0x70183E63,0x00000000
-	.word 0x1F000000,0x1B1F3333,0x00006333,0x00000000,0x0E000000,0x180E0313,0x00000E19,0x00000000
-	.word 0x3F000000,0x0C0C0C0C,0x00000C0C,0x00000000,0x33000000,0x33333333,0x00001E33,0x00000000
-	.word 0x33000000,0x1E1E1E33,0x00000C0C,0x00000000,0xDB000000,0xE7DBDBDB,0x00006666,0x00000000
-	.word 0x33000000,0x1E0C1E33,0x00003333,0x00000000,0x33000000,0x0C0C1E33,0x00000C0C,0x00000000
-	.word 0x1F000000,0x03060C18,0x00001F03,0x00000000,0x060E0000,0x06060606,0x0E060606,0x00000000
-	.word 0x01010000,0x08040202,0x00101008,0x00000000,0x0C0E0000,0x0C0C0C0C,0x0E0C0C0C,0x00000000
-	.word 0x18000000,0x0000663C,0x00000000,0x00000000,0x00000000,0x00000000,0x3F000000,0x00000000
-
-	.word 0x180C0000,0x00000000,0x00000000,0x00000000,0x00000000,0x1E180E00,0x00001E1B,0x00000000
-	.word 0x03030000,0x1B1B0F03,0x00000F1B,0x00000000,0x00000000,0x03030E00,0x00000E03,0x00000000
-	.word 0x18180000,0x1B1B1E18,0x00001E1B,0x00000000,0x00000000,0x1F1B0E00,0x00001E03,0x00000000
-	.word 0x061C0000,0x06061F06,0x00000606,0x00000000,0x00000000,0x1B1B1E00,0x0E181E1B,0x00000000
-	.word 0x03030000,0x1B1B0F03,0x00001B1B,0x00000000,0x03000000,0x03030300,0x00000303,0x00000000
-	.word 0x06000000,0x06060700,0x03060606,0x00000000,0x03030000,0x0F1B1B03,0x00001B1B,0x00000000
-	.word 0x03030000,0x03030303,0x00000303,0x00000000,0x00000000,0xDBDB6F00,0x0000DBDB,0x00000000
-	.word 0x00000000,0x1B1B0F00,0x00001B1B,0x00000000,0x00000000,0x1B1B0E00,0x00000E1B,0x00000000
-
-	.word 0x00000000,0x1B1B0F00,0x03030F1B,0x00000000,0x00000000,0x1B1B1E00,0x18181E1B,0x00000000
-	.word 0x00000000,0x03070B00,0x00000303,0x00000000,0x00000000,0x0F030E00,0x0000070C,0x00000000
-	.word 0x06000000,0x06061F06,0x00001C06,0x00000000,0x00000000,0x1B1B1B00,0x00001E1B,0x00000000
-	.word 0x00000000,0x1B1B1B00,0x00000E0E,0x00000000,0x00000000,0xDBDBDB00,0x00006666,0x00000000
-	.word 0x00000000,0x0E1B1B00,0x00001B1B,0x00000000,0x00000000,0x1B1B1B00,0x060C0E0E,0x00000000
-	.word 0x00000000,0x060C0F00,0x00000F03,0x00000000,0x0C180000,0x0C070C0C,0x180C0C0C,0x00000000
-	.word 0x04040000,0x04040404,0x04040404,0x00000000,0x06030000,0x061C0606,0x03060606,0x00000000
-	.word 0x00000000,0x49460000,0x00000031,0x00000000,0x00000000,0x1B1B1B1F,0x00001F1B,0x00000000
-
-	.word 0x0E000000,0x07030713,0x00000E13,0x00000000,0x07000000,0x03030303,0x00000703,0x00000000
-	.word 0x00000000,0x00000000,0x00010303,0x00000000,0x18000000,0x0C1E0C0C,0x0003060C,0x00000000
-	.word 0x00000000,0x00000000,0x00091B1B,0x00000000,0x00000000,0x00000000,0x0000DBDB,0x00000000
-	.word 0x04040000,0x0404041F,0x00000004,0x00000000,0x04040000,0x041F041F,0x00000004,0x00000000
-	.word 0x120C0000,0x00000000,0x00000000,0x00000000,0x15250200,0xA952040A,0x000050A8,0x00000000
-	.word 0x0E000C12,0x180E0313,0x00000E19,0x00000000,0x00000000,0x06030604,0x00000004,0x00000000
-	.word 0xFE000000,0x1BFB1B1B,0x0000FE1B,0x00000000,0x07000000,0x03030303,0x00000703,0x00000000
-	.word 0x1F000C12,0x03060C18,0x00001F03,0x00000000,0x07000000,0x03030303,0x00000703,0x00000000
-
-	.word 0x07000000,0x03030303,0x00000703,0x00000000,0x03030000,0x00000002,0x00000000,0x00000000
-	.word 0x03030000,0x00000001,0x00000000,0x00000000,0x1B1B0000,0x00000012,0x00000000,0x00000000
-	.word 0x1B1B0000,0x00000009,0x00000000,0x00000000,0x00000000,0x1E1E0C00,0x0000000C,0x00000000
-	.word 0x00000000,0x001F0000,0x00000000,0x00000000,0x00000000,0x00FF0000,0x00000000,0x00000000
-	.word 0x1A160000,0x00000000,0x00000000,0x00000000,0xF7000000,0x00009292,0x00000000,0x00000000
-	.word 0x06090000,0x0F030E00,0x0000070C,0x00000000,0x00000000,0x060C0602,0x00000002,0x00000000
-	.word 0x00000000,0xFBDB7600,0x0000EE1B,0x00000000,0x07000000,0x03030303,0x00000703,0x00000000
-	.word 0x06090000,0x060C0F00,0x00000F03,0x00000000,0x33001200,0x0C0C1E33,0x00000C0C,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x06000000,0x06060600,0x00000606,0x00000000
-	.word 0x00000000,0x0B0B1E08,0x00081E0B,0x00000000,0x1C000000,0x060F0606,0x00001F06,0x00000000
-	.word 0x00000000,0x0E0A0E11,0x00000011,0x00000000,0x33000000,0x1E0C1E33,0x00000C0C,0x00000000
-	.word 0x04040000,0x00000404,0x04040404,0x00000000,0x0E000000,0x1B0F0313,0x0E19181E,0x00000000
-	.word 0x0A000000,0x00000000,0x00000000,0x00000000,0x3C000000,0x8585B942,0x003C42B9,0x00000000
-	.word 0x07000000,0x000F0F08,0x00000000,0x00000000,0x00000000,0x361B3624,0x00000024,0x00000000
-	.word 0x00000000,0x203E0000,0x00000020,0x00000000,0x00000000,0x00070000,0x00000000,0x00000000
-	.word 0x3C000000,0x9DA59D42,0x003C42A5,0x00000000,0x003F0000,0x00000000,0x00000000,0x00000000
-
-	.word 0x06000000,0x00060909,0x00000000,0x00000000,0x00000000,0x083E0808,0x00003E08,0x00000000
-	.word 0x07000000,0x00070204,0x00000000,0x00000000,0x07000000,0x00070402,0x00000000,0x00000000
-	.word 0x0C180000,0x00000000,0x00000000,0x00000000,0x00000000,0x1B1B1B00,0x03031F1B,0x00000000
-	.word 0x1E000000,0x14161717,0x14141414,0x00000000,0x00000000,0x03030000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x0C100000,0x00000000,0x02000000,0x00070203,0x00000000,0x00000000
-	.word 0x06000000,0x00060909,0x00000000,0x00000000,0x00000000,0x366C3612,0x00000012,0x00000000
-	.word 0x12230200,0x2932040A,0x00002078,0x00000000,0x12230200,0x4172040A,0x00007020,0x00000000
-	.word 0x14220700,0x2932040B,0x00002078,0x00000000,0x0C000000,0x03060C00,0x00000E13,0x00000000
-
-	.word 0x1C00180C,0x3E36361C,0x00006363,0x00000000,0x1C001830,0x3E36361C,0x00006363,0x00000000
-	.word 0x1C002418,0x3E36361C,0x00006363,0x00000000,0x1C00342C,0x3E36361C,0x00006363,0x00000000
-	.word 0x1C001400,0x3E36361C,0x00006363,0x00000000,0x1C140800,0x3E36361C,0x00006363,0x00000000
-	.word 0xFC000000,0x3EF6363C,0x0000F333,0x00000000,0x0E000000,0x03030313,0x04080E13,0x00000000
-	.word 0x1F000C06,0x031F0303,0x00001F03,0x00000000,0x1F00060C,0x031F0303,0x00001F03,0x00000000
-	.word 0x1F00120C,0x031F0303,0x00001F03,0x00000000,0x1F000A00,0x031F0303,0x00001F03,0x00000000
-	.word 0x0F000603,0x06060606,0x00000F06,0x00000000,0x0F00060C,0x06060606,0x00000F06,0x00000000
-	.word 0x0F000906,0x06060606,0x00000F06,0x00000000,0x0F000900,0x06060606,0x00000F06,0x00000000
-
-	.word 0x3E000000,0x666F6666,0x00003E66,0x00000000,0x21001A16,0x392D2723,0x00002131,0x00000000
-	.word 0x3E00180C,0x63636363,0x00003E63,0x00000000,0x3E000C18,0x63636363,0x00003E63,0x00000000
-	.word 0x3E002418,0x63636363,0x00003E63,0x00000000,0x3E00342C,0x63636363,0x00003E63,0x00000000
-	.word 0x3E001400,0x63636363,0x00003E63,0x00000000,0x00000000,0x14081422,0x00000022,0x00000000
-	.word 0x3E400000,0x676B7363,0x00013E63,0x00000000,0x33000C06,0x33333333,0x00001E33,0x00000000
-	.word 0x33000C18,0x33333333,0x00001E33,0x00000000,0x3300120C,0x33333333,0x00001E33,0x00000000
-	.word 0x33001200,0x33333333,0x00001E33,0x00000000,0x33000C18,0x0C0C1E33,0x00000C0C,0x00000000
-	.word 0x03000000,0x3333331F,0x0000031F,0x00000000,0x1B0E0000,0x1B1B0F1B,0x00000F1B,0x00000000
-
-	.word 0x0C060000,0x1E180E00,0x00001E1B,0x00000000,0x0C180000,0x1E180E00,0x00001E1B,0x00000000
-	.word 0x120C0000,0x1E180E00,0x00001E1B,0x00000000,0x1A160000,0x1E180E00,0x00001E1B,0x00000000
-	.word 0x0A000000,0x1E180E00,0x00001E1B,0x00000000,0x0A040000,0x1E180E04,0x00001E1B,0x00000000
-	.word 0x00000000,0xFED86E00,0x0000F61B,0x00000000,0x00000000,0x03030E00,0x03040E03,0x00000000
-	.word 0x0C060000,0x1F1B0E00,0x00001E03,0x00000000,0x060C0000,0x1F1B0E00,0x00001E03,0x00000000
-	.word 0x120C0000,0x1F1B0E00,0x00001E03,0x00000000,0x0A000000,0x1F1B0E00,0x00001E03,0x00000000
-	.word 0x06030000,0x06060600,0x00000606,0x00000000,0x03060000,0x03030300,0x00000303,0x00000000
-	.word 0x09060000,0x06060600,0x00000606,0x00000000,0x09000000,0x06060600,0x00000606,0x00000000
-
-	.word 0x0E0C0000,0x1B1B1E18,0x00000E1B,0x00000000,0x0D0B0000,0x1B1B0F00,0x00001B1B,0x00000000
-	.word 0x0C060000,0x1B1B0E00,0x00000E1B,0x00000000,0x060C0000,0x1B1B0E00,0x00000E1B,0x00000000
-	.word 0x0A040000,0x1B1B0E00,0x00000E1B,0x00000000,0x1A160000,0x1B1B0E00,0x00000E1B,0x00000000
-	.word 0x0A000000,0x1B1B0E00,0x00000E1B,0x00000000,0x00000000,0x003F000C,0x0000000C,0x00000000
-	.word 0x00000000,0x1F1B0E10,0x00010E1B,0x00000000,0x0C060000,0x1B1B1B00,0x00001E1B,0x00000000
-	.word 0x060C0000,0x1B1B1B00,0x00001E1B,0x00000000,0x120C0000,0x1B1B1B00,0x00001E1B,0x00000000
-	.word 0x0A000000,0x1B1B1B00,0x00001E1B,0x00000000,0x060C0000,0x1B1B1B00,0x060C0E0E,0x00000000
-	.word 0x03030000,0x1B1B0F03,0x03030F1B,0x00000000,0x0A000000,0x1B1B1B00,0x060C0E0E,0x00000000
-
-	.section .rodata
-	.align	2
-	.global verdana9bWidths		@ 224 unsigned chars
-verdana9bWidths:
-	.byte 0x03,0x04,0x05,0x08,0x06,0x08,0x08,0x03,0x05,0x05,0x06,0x08,0x03,0x04,0x03,0x06
-	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x04,0x04,0x08,0x08,0x08,0x06
-	.byte 0x08,0x08,0x07,0x06,0x07,0x06,0x06,0x07,0x07,0x05,0x05,0x07,0x06,0x08,0x07,0x08
-	.byte 0x07,0x08,0x07,0x06,0x06,0x07,0x07,0x08,0x07,0x07,0x06,0x05,0x06,0x05,0x08,0x06
-	.byte 0x06,0x06,0x06,0x05,0x06,0x06,0x05,0x06,0x06,0x03,0x04,0x06,0x03,0x08,0x06,0x06
-	.byte 0x06,0x06,0x04,0x05,0x05,0x06,0x06,0x08,0x06,0x06,0x05,0x06,0x05,0x06,0x08,0x06
-	.byte 0x06,0x04,0x03,0x06,0x06,0x08,0x06,0x06,0x06,0x08,0x06,0x05,0x08,0x04,0x06,0x04
-	.byte 0x04,0x03,0x03,0x06,0x06,0x06,0x06,0x08,0x06,0x08,0x05,0x05,0x08,0x04,0x05,0x07
-
-	.byte 0x03,0x04,0x06,0x06,0x06,0x06,0x05,0x06,0x06,0x08,0x05,0x08,0x08,0x04,0x08,0x06
-	.byte 0x05,0x08,0x04,0x04,0x06,0x06,0x06,0x03,0x06,0x04,0x05,0x08,0x08,0x08,0x08,0x06
-	.byte 0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x06,0x06,0x06,0x06,0x06,0x05,0x05,0x05,0x05
-	.byte 0x08,0x07,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x07,0x07,0x07,0x07,0x07,0x07,0x06
-	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x08,0x05,0x06,0x06,0x06,0x06,0x04,0x03,0x04,0x04
-	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x07,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06
-
-@}}BLOCK(verdana9b)
+
+@{{BLOCK(verdana9b)
+
+@ Verdana 9 bold, ' ' to ''
+
+	.section .rodata
+	.align	2
+	.global	verdana9bFont
+verdana9bFont:
+	.word	verdana9bGlyphs, verdana9bWidths, 0
+	.hword	32, 224
+	.byte	8, 12
+	.byte	8, 16
+	.hword	16
+	.byte	1, 0
+
+	.section .rodata
+	.align	2
+	.global verdana9bGlyphs		@ 3584 unsigned chars
+verdana9bGlyphs:
+	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x06000000,0x06060606,0x00000600,0x00000000
+	.word 0x1B1B0000,0x0000001B,0x00000000,0x00000000,0x28000000,0x3F147E28,0x00000A0A,0x00000000
+	.word 0x04040000,0x1C07170E,0x04040E1D,0x00000000,0x22000000,0xA84A1515,0x000044A8,0x00000000
+	.word 0x0E000000,0x3B6E1B1B,0x00006E33,0x00000000,0x03030000,0x00000003,0x00000000,0x00000000
+	.word 0x060C0000,0x03030303,0x0C060303,0x00000000,0x06030000,0x0C0C0C0C,0x03060C0C,0x00000000
+	.word 0x15040000,0x0004150E,0x00000000,0x00000000,0x00000000,0x083E0808,0x00000008,0x00000000
+	.word 0x00000000,0x00000000,0x00010303,0x00000000,0x00000000,0x00070000,0x00000000,0x00000000
+	.word 0x00000000,0x00000000,0x00000303,0x00000000,0x10100000,0x02040808,0x00010102,0x00000000
+
+	.word 0x0E000000,0x1B1B1B1B,0x00000E1B,0x00000000,0x0C000000,0x0C0C0C0E,0x00001E0C,0x00000000
+	.word 0x0E000000,0x060C1819,0x00001F03,0x00000000,0x0E000000,0x180E1819,0x00000E19,0x00000000
+	.word 0x18000000,0x3F191A1C,0x00001818,0x00000000,0x1F000000,0x18180F03,0x00000E19,0x00000000
+	.word 0x0E000000,0x1B1B0F03,0x00000E1B,0x00000000,0x1F000000,0x060C0C18,0x00000306,0x00000000
+	.word 0x0E000000,0x1B0E1B1B,0x00000E1B,0x00000000,0x0E000000,0x1E1B1B1B,0x00000E18,0x00000000
+	.word 0x00000000,0x00060600,0x00000606,0x00000000,0x00000000,0x00060600,0x00020606,0x00000000
+	.word 0x00000000,0x06061820,0x00002018,0x00000000,0x00000000,0x3E003E00,0x00000000,0x00000000
+	.word 0x00000000,0x30300C02,0x0000020C,0x00000000,0x0F000000,0x060C1818,0x00000600,0x00000000
+
+	.word 0x3C000000,0xA5A5B942,0x003C0279,0x00000000,0x1C000000,0x3E36361C,0x00006363,0x00000000
+	.word 0x1F000000,0x331F3333,0x00001F33,0x00000000,0x0E000000,0x03030313,0x00000E13,0x00000000
+	.word 0x1F000000,0x33333333,0x00001F33,0x00000000,0x1F000000,0x031F0303,0x00001F03,0x00000000
+	.word 0x1F000000,0x031F0303,0x00000303,0x00000000,0x1E000000,0x3B030323,0x00003E33,0x00000000
+	.word 0x33000000,0x333F3333,0x00003333,0x00000000,0x0F000000,0x06060606,0x00000F06,0x00000000
+	.word 0x0E000000,0x0C0C0C0C,0x0000070C,0x00000000,0x33000000,0x0F070F1B,0x0000331B,0x00000000
+	.word 0x03000000,0x03030303,0x00001F03,0x00000000,0x41000000,0x6D6D7763,0x00006161,0x00000000
+	.word 0x21000000,0x392D2723,0x00002131,0x00000000,0x3E000000,0x63636363,0x00003E63,0x00000000
+
+	.word 0x1F000000,0x1F333333,0x00000303,0x00000000,0x3E000000,0x63636363,0x70183E63,0x00000000
+	.word 0x1F000000,0x1B1F3333,0x00006333,0x00000000,0x0E000000,0x180E0313,0x00000E19,0x00000000
+	.word 0x3F000000,0x0C0C0C0C,0x00000C0C,0x00000000,0x33000000,0x33333333,0x00001E33,0x00000000
+	.word 0x33000000,0x1E1E1E33,0x00000C0C,0x00000000,0xDB000000,0xE7DBDBDB,0x00006666,0x00000000
+	.word 0x33000000,0x1E0C1E33,0x00003333,0x00000000,0x33000000,0x0C0C1E33,0x00000C0C,0x00000000
+	.word 0x1F000000,0x03060C18,0x00001F03,0x00000000,0x060E0000,0x06060606,0x0E060606,0x00000000
+	.word 0x01010000,0x08040202,0x00101008,0x00000000,0x0C0E0000,0x0C0C0C0C,0x0E0C0C0C,0x00000000
+	.word 0x18000000,0x0000663C,0x00000000,0x00000000,0x00000000,0x00000000,0x3F000000,0x00000000
+
+	.word 0x180C0000,0x00000000,0x00000000,0x00000000,0x00000000,0x1E180E00,0x00001E1B,0x00000000
+	.word 0x03030000,0x1B1B0F03,0x00000F1B,0x00000000,0x00000000,0x03030E00,0x00000E03,0x00000000
+	.word 0x18180000,0x1B1B1E18,0x00001E1B,0x00000000,0x00000000,0x1F1B0E00,0x00001E03,0x00000000
+	.word 0x061C0000,0x06061F06,0x00000606,0x00000000,0x00000000,0x1B1B1E00,0x0E181E1B,0x00000000
+	.word 0x03030000,0x1B1B0F03,0x00001B1B,0x00000000,0x03000000,0x03030300,0x00000303,0x00000000
+	.word 0x06000000,0x06060700,0x03060606,0x00000000,0x03030000,0x0F1B1B03,0x00001B1B,0x00000000
+	.word 0x03030000,0x03030303,0x00000303,0x00000000,0x00000000,0xDBDB6F00,0x0000DBDB,0x00000000
+	.word 0x00000000,0x1B1B0F00,0x00001B1B,0x00000000,0x00000000,0x1B1B0E00,0x00000E1B,0x00000000
+
+	.word 0x00000000,0x1B1B0F00,0x03030F1B,0x00000000,0x00000000,0x1B1B1E00,0x18181E1B,0x00000000
+	.word 0x00000000,0x03070B00,0x00000303,0x00000000,0x00000000,0x0F030E00,0x0000070C,0x00000000
+	.word 0x06000000,0x06061F06,0x00001C06,0x00000000,0x00000000,0x1B1B1B00,0x00001E1B,0x00000000
+	.word 0x00000000,0x1B1B1B00,0x00000E0E,0x00000000,0x00000000,0xDBDBDB00,0x00006666,0x00000000
+	.word 0x00000000,0x0E1B1B00,0x00001B1B,0x00000000,0x00000000,0x1B1B1B00,0x060C0E0E,0x00000000
+	.word 0x00000000,0x060C0F00,0x00000F03,0x00000000,0x0C180000,0x0C070C0C,0x180C0C0C,0x00000000
+	.word 0x04040000,0x04040404,0x04040404,0x00000000,0x06030000,0x061C0606,0x03060606,0x00000000
+	.word 0x00000000,0x49460000,0x00000031,0x00000000,0x00000000,0x1B1B1B1F,0x00001F1B,0x00000000
+
+	.word 0x0E000000,0x07030713,0x00000E13,0x00000000,0x07000000,0x03030303,0x00000703,0x00000000
+	.word 0x00000000,0x00000000,0x00010303,0x00000000,0x18000000,0x0C1E0C0C,0x0003060C,0x00000000
+	.word 0x00000000,0x00000000,0x00091B1B,0x00000000,0x00000000,0x00000000,0x0000DBDB,0x00000000
+	.word 0x04040000,0x0404041F,0x00000004,0x00000000,0x04040000,0x041F041F,0x00000004,0x00000000
+	.word 0x120C0000,0x00000000,0x00000000,0x00000000,0x15250200,0xA952040A,0x000050A8,0x00000000
+	.word 0x0E000C12,0x180E0313,0x00000E19,0x00000000,0x00000000,0x06030604,0x00000004,0x00000000
+	.word 0xFE000000,0x1BFB1B1B,0x0000FE1B,0x00000000,0x07000000,0x03030303,0x00000703,0x00000000
+	.word 0x1F000C12,0x03060C18,0x00001F03,0x00000000,0x07000000,0x03030303,0x00000703,0x00000000
+
+	.word 0x07000000,0x03030303,0x00000703,0x00000000,0x03030000,0x00000002,0x00000000,0x00000000
+	.word 0x03030000,0x00000001,0x00000000,0x00000000,0x1B1B0000,0x00000012,0x00000000,0x00000000
+	.word 0x1B1B0000,0x00000009,0x00000000,0x00000000,0x00000000,0x1E1E0C00,0x0000000C,0x00000000
+	.word 0x00000000,0x001F0000,0x00000000,0x00000000,0x00000000,0x00FF0000,0x00000000,0x00000000
+	.word 0x1A160000,0x00000000,0x00000000,0x00000000,0xF7000000,0x00009292,0x00000000,0x00000000
+	.word 0x06090000,0x0F030E00,0x0000070C,0x00000000,0x00000000,0x060C0602,0x00000002,0x00000000
+	.word 0x00000000,0xFBDB7600,0x0000EE1B,0x00000000,0x07000000,0x03030303,0x00000703,0x00000000
+	.word 0x06090000,0x060C0F00,0x00000F03,0x00000000,0x33001200,0x0C0C1E33,0x00000C0C,0x00000000
+
+	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x06000000,0x06060600,0x00000606,0x00000000
+	.word 0x00000000,0x0B0B1E08,0x00081E0B,0x00000000,0x1C000000,0x060F0606,0x00001F06,0x00000000
+	.word 0x00000000,0x0E0A0E11,0x00000011,0x00000000,0x33000000,0x1E0C1E33,0x00000C0C,0x00000000
+	.word 0x04040000,0x00000404,0x04040404,0x00000000,0x0E000000,0x1B0F0313,0x0E19181E,0x00000000
+	.word 0x0A000000,0x00000000,0x00000000,0x00000000,0x3C000000,0x8585B942,0x003C42B9,0x00000000
+	.word 0x07000000,0x000F0F08,0x00000000,0x00000000,0x00000000,0x361B3624,0x00000024,0x00000000
+	.word 0x00000000,0x203E0000,0x00000020,0x00000000,0x00000000,0x00070000,0x00000000,0x00000000
+	.word 0x3C000000,0x9DA59D42,0x003C42A5,0x00000000,0x003F0000,0x00000000,0x00000000,0x00000000
+
+	.word 0x06000000,0x00060909,0x00000000,0x00000000,0x00000000,0x083E0808,0x00003E08,0x00000000
+	.word 0x07000000,0x00070204,0x00000000,0x00000000,0x07000000,0x00070402,0x00000000,0x00000000
+	.word 0x0C180000,0x00000000,0x00000000,0x00000000,0x00000000,0x1B1B1B00,0x03031F1B,0x00000000
+	.word 0x1E000000,0x14161717,0x14141414,0x00000000,0x00000000,0x03030000,0x00000000,0x00000000
+	.word 0x00000000,0x00000000,0x0C100000,0x00000000,0x02000000,0x00070203,0x00000000,0x00000000
+	.word 0x06000000,0x00060909,0x00000000,0x00000000,0x00000000,0x366C3612,0x00000012,0x00000000
+	.word 0x12230200,0x2932040A,0x00002078,0x00000000,0x12230200,0x4172040A,0x00007020,0x00000000
+	.word 0x14220700,0x2932040B,0x00002078,0x00000000,0x0C000000,0x03060C00,0x00000E13,0x00000000
+
+	.word 0x1C00180C,0x3E36361C,0x00006363,0x00000000,0x1C001830,0x3E36361C,0x00006363,0x00000000
+	.word 0x1C002418,0x3E36361C,0x00006363,0x00000000,0x1C00342C,0x3E36361C,0x00006363,0x00000000
+	.word 0x1C001400,0x3E36361C,0x00006363,0x00000000,0x1C140800,0x3E36361C,0x00006363,0x00000000
+	.word 0xFC000000,0x3EF6363C,0x0000F333,0x00000000,0x0E000000,0x03030313,0x04080E13,0x00000000
+	.word 0x1F000C06,0x031F0303,0x00001F03,0x00000000,0x1F00060C,0x031F0303,0x00001F03,0x00000000
+	.word 0x1F00120C,0x031F0303,0x00001F03,0x00000000,0x1F000A00,0x031F0303,0x00001F03,0x00000000
+	.word 0x0F000603,0x06060606,0x00000F06,0x00000000,0x0F00060C,0x06060606,0x00000F06,0x00000000
+	.word 0x0F000906,0x06060606,0x00000F06,0x00000000,0x0F000900,0x06060606,0x00000F06,0x00000000
+
+	.word 0x3E000000,0x666F6666,0x00003E66,0x00000000,0x21001A16,0x392D2723,0x00002131,0x00000000
+	.word 0x3E00180C,0x63636363,0x00003E63,0x00000000,0x3E000C18,0x63636363,0x00003E63,0x00000000
+	.word 0x3E002418,0x63636363,0x00003E63,0x00000000,0x3E00342C,0x63636363,0x00003E63,0x00000000
+	.word 0x3E001400,0x63636363,0x00003E63,0x00000000,0x00000000,0x14081422,0x00000022,0x00000000
+	.word 0x3E400000,0x676B7363,0x00013E63,0x00000000,0x33000C06,0x33333333,0x00001E33,0x00000000
+	.word 0x33000C18,0x33333333,0x00001E33,0x00000000,0x3300120C,0x33333333,0x00001E33,0x00000000
+	.word 0x33001200,0x33333333,0x00001E33,0x00000000,0x33000C18,0x0C0C1E33,0x00000C0C,0x00000000
+	.word 0x03000000,0x3333331F,0x0000031F,0x00000000,0x1B0E0000,0x1B1B0F1B,0x00000F1B,0x00000000
+
+	.word 0x0C060000,0x1E180E00,0x00001E1B,0x00000000,0x0C180000,0x1E180E00,0x00001E1B,0x00000000
+	.word 0x120C0000,0x1E180E00,0x00001E1B,0x00000000,0x1A160000,0x1E180E00,0x00001E1B,0x00000000
+	.word 0x0A000000,0x1E180E00,0x00001E1B,0x00000000,0x0A040000,0x1E180E04,0x00001E1B,0x00000000
+	.word 0x00000000,0xFED86E00,0x0000F61B,0x00000000,0x00000000,0x03030E00,0x03040E03,0x00000000
+	.word 0x0C060000,0x1F1B0E00,0x00001E03,0x00000000,0x060C0000,0x1F1B0E00,0x00001E03,0x00000000
+	.word 0x120C0000,0x1F1B0E00,0x00001E03,0x00000000,0x0A000000,0x1F1B0E00,0x00001E03,0x00000000
+	.word 0x06030000,0x06060600,0x00000606,0x00000000,0x03060000,0x03030300,0x00000303,0x00000000
+	.word 0x09060000,0x06060600,0x00000606,0x00000000,0x09000000,0x06060600,0x00000606,0x00000000
+
+	.word 0x0E0C0000,0x1B1B1E18,0x00000E1B,0x00000000,0x0D0B0000,0x1B1B0F00,0x00001B1B,0x00000000
+	.word 0x0C060000,0x1B1B0E00,0x00000E1B,0x00000000,0x060C0000,0x1B1B0E00,0x00000E1B,0x00000000
+	.word 0x0A040000,0x1B1B0E00,0x00000E1B,0x00000000,0x1A160000,0x1B1B0E00,0x00000E1B,0x00000000
+	.word 0x0A000000,0x1B1B0E00,0x00000E1B,0x00000000,0x00000000,0x003F000C,0x0000000C,0x00000000
+	.word 0x00000000,0x1F1B0E10,0x00010E1B,0x00000000,0x0C060000,0x1B1B1B00,0x00001E1B,0x00000000
+	.word 0x060C0000,0x1B1B1B00,0x00001E1B,0x00000000,0x120C0000,0x1B1B1B00,0x00001E1B,0x00000000
+	.word 0x0A000000,0x1B1B1B00,0x00001E1B,0x00000000,0x060C0000,0x1B1B1B00,0x060C0E0E,0x00000000
+	.word 0x03030000,0x1B1B0F03,0x03030F1B,0x00000000,0x0A000000,0x1B1B1B00,0x060C0E0E,0x00000000
+
+	.section .rodata
+	.align	2
+	.global verdana9bWidths		@ 224 unsigned chars
+verdana9bWidths:
+	.byte 0x03,0x04,0x05,0x08,0x06,0x08,0x08,0x03,0x05,0x05,0x06,0x08,0x03,0x04,0x03,0x06
+	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x04,0x04,0x08,0x08,0x08,0x06
+	.byte 0x08,0x08,0x07,0x06,0x07,0x06,0x06,0x07,0x07,0x05,0x05,0x07,0x06,0x08,0x07,0x08
+	.byte 0x07,0x08,0x07,0x06,0x06,0x07,0x07,0x08,0x07,0x07,0x06,0x05,0x06,0x05,0x08,0x06
+	.byte 0x06,0x06,0x06,0x05,0x06,0x06,0x05,0x06,0x06,0x03,0x04,0x06,0x03,0x08,0x06,0x06
+	.byte 0x06,0x06,0x04,0x05,0x05,0x06,0x06,0x08,0x06,0x06,0x05,0x06,0x05,0x06,0x08,0x06
+	.byte 0x06,0x04,0x03,0x06,0x06,0x08,0x06,0x06,0x06,0x08,0x06,0x05,0x08,0x04,0x06,0x04
+	.byte 0x04,0x03,0x03,0x06,0x06,0x06,0x06,0x08,0x06,0x08,0x05,0x05,0x08,0x04,0x05,0x07
+
+	.byte 0x03,0x04,0x06,0x06,0x06,0x06,0x05,0x06,0x06,0x08,0x05,0x08,0x08,0x04,0x08,0x06
+	.byte 0x05,0x08,0x04,0x04,0x06,0x06,0x06,0x03,0x06,0x04,0x05,0x08,0x08,0x08,0x08,0x06
+	.byte 0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x06,0x06,0x06,0x06,0x06,0x05,0x05,0x05,0x05
+	.byte 0x08,0x07,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x07,0x07,0x07,0x07,0x07,0x07,0x06
+	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x08,0x05,0x06,0x06,0x06,0x06,0x04,0x03,0x04,0x04
+	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x07,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06
+
+@}}BLOCK(verdana9b)
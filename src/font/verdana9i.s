@@ -1,167 +1,167 @@
-
-@{{BLOCK(verdana9i)
-
-@ Verdana 9 italic, ' ' to ''
-
-	.section .rodata
-	.align	2
-	.global	verdana9iFont
-verdana9iFont:
-	.word	verdana9iGlyphs, verdana9iWidths, 0
-	.hword	32, 224
-	.byte	8, 12
-	.byte	8, 16
-	.hword	16
-	.byte	1, 0
-
-	.section .rodata
-	.align	2
-	.global verdana9iGlyphs		@ 3584 unsigned chars
-verdana9iGlyphs:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x04000000,0x02020204,0x00000200,0x00000000
-	.word 0x0A0A0000,0x0000000A,0x00000000,0x00000000,0x28000000,0x3F147E28,0x00000A0A,0x00000000
-	.word 0x08080000,0x140A0A1C,0x02020F14,0x00000000,0x46000000,0xA8CB1525,0x000062A4,0x00000000
-	.word 0x0C000000,0x19260A12,0x00002E11,0x00000000,0x02020000,0x00000002,0x00000000,0x00000000
-	.word 0x04080000,0x01010202,0x02010101,0x00000000,0x08040000,0x08080808,0x01020404,0x00000000
-	.word 0x15040000,0x0004150E,0x00000000,0x00000000,0x00000000,0x083E0808,0x00000008,0x00000000
-	.word 0x00000000,0x00000000,0x01020200,0x00000000,0x00000000,0x07000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000200,0x00000000,0x10100000,0x02040808,0x00010102,0x00000000
-
-	.word 0x0C000000,0x11111112,0x00000609,0x00000000,0x10000000,0x0808081C,0x00000E04,0x00000000
-	.word 0x0E000000,0x06081010,0x00000F01,0x00000000,0x0E000000,0x080C1010,0x00000708,0x00000000
-	.word 0x18000000,0x1F090A14,0x00000404,0x00000000,0x1C000000,0x08060204,0x00000708,0x00000000
-	.word 0x1C000000,0x110F0102,0x00000E11,0x00000000,0x1E000000,0x04080810,0x00000204,0x00000000
-	.word 0x0C000000,0x110E1212,0x00000E11,0x00000000,0x0E000000,0x101E1111,0x00000708,0x00000000
-	.word 0x00000000,0x00000400,0x00000200,0x00000000,0x00000000,0x00000400,0x01020200,0x00000000
-	.word 0x00000000,0x18061820,0x00000020,0x00000000,0x00000000,0x003E0000,0x0000003E,0x00000000
-	.word 0x00000000,0x0C300C02,0x00000002,0x00000000,0x0E000000,0x020C1010,0x00000200,0x00000000
-
-	.word 0x78000000,0x95A5BA86,0x001E017D,0x00000000,0x18000000,0x1E121414,0x00001111,0x00000000
-	.word 0x0C000000,0x120E1214,0x00000F11,0x00000000,0x1C000000,0x01010122,0x00000E11,0x00000000
-	.word 0x1C000000,0x22222224,0x00000F11,0x00000000,0x3C000000,0x021E0204,0x00000F01,0x00000000
-	.word 0x3C000000,0x021E0204,0x00000101,0x00000000,0x1C000000,0x31010122,0x00001E21,0x00000000
-	.word 0x44000000,0x223E2244,0x00001111,0x00000000,0x1C000000,0x04040408,0x00000702,0x00000000
-	.word 0x18000000,0x08080810,0x00000304,0x00000000,0x24000000,0x0A060A14,0x00001109,0x00000000
-	.word 0x04000000,0x02020204,0x00000F01,0x00000000,0x84000000,0x4A5A6AC4,0x00002121,0x00000000
-	.word 0x44000000,0x2A2A2A44,0x00001111,0x00000000,0x1C000000,0x21212122,0x00000E11,0x00000000
-
-	.word 0x0C000000,0x020E1214,0x00000101,0x00000000,0x1C000000,0x21212122,0x30080E11,0x00000000
-	.word 0x1C000000,0x0A1E2224,0x00002111,0x00000000,0x0C000000,0x100C0212,0x00000E11,0x00000000
-	.word 0x3E000000,0x04040408,0x00000202,0x00000000,0x42000000,0x21212242,0x00000E11,0x00000000
-	.word 0x22000000,0x0A0A1222,0x00000206,0x00000000,0xA2000000,0x666AAAB2,0x00002266,0x00000000
-	.word 0x22000000,0x0C0C0C12,0x00001112,0x00000000,0x22000000,0x04040C12,0x00000202,0x00000000
-	.word 0x3E000000,0x02040810,0x00001F01,0x00000000,0x08380000,0x02040404,0x07010202,0x00000000
-	.word 0x01010000,0x02020201,0x80040404,0x00000000,0x101C0000,0x04080808,0x03020404,0x00000000
-	.word 0x18000000,0x00004224,0x00000000,0x00000000,0x00000000,0x00000000,0x3F000000,0x00000000
-
-	.word 0x08040000,0x00000000,0x00000000,0x00000000,0x00000000,0x0E080600,0x00000705,0x00000000
-	.word 0x04040000,0x12120E04,0x00000709,0x00000000,0x00000000,0x01021C00,0x00000E01,0x00000000
-	.word 0x20200000,0x11121C20,0x00000E09,0x00000000,0x00000000,0x0F090600,0x00000E01,0x00000000
-	.word 0x04180000,0x02020F04,0x00000101,0x00000000,0x00000000,0x11121C00,0x07080E09,0x00000000
-	.word 0x04040000,0x12120E04,0x00000909,0x00000000,0x04000000,0x02020200,0x00000101,0x00000000
-	.word 0x10000000,0x08080C00,0x03040404,0x00000000,0x04040000,0x060A1204,0x00000905,0x00000000
-	.word 0x04040000,0x02020204,0x00000101,0x00000000,0x00000000,0x92926E00,0x00004949,0x00000000
-	.word 0x00000000,0x12120E00,0x00000909,0x00000000,0x00000000,0x09090600,0x00000609,0x00000000
-
-	.word 0x00000000,0x22241C00,0x01010E12,0x00000000,0x00000000,0x11121C00,0x04040E09,0x00000000
-	.word 0x00000000,0x02060A00,0x00000101,0x00000000,0x00000000,0x04021C00,0x00000708,0x00000000
-	.word 0x00000000,0x01020F02,0x00000601,0x00000000,0x00000000,0x11121200,0x00000E09,0x00000000
-	.word 0x00000000,0x0A0A1200,0x00000206,0x00000000,0x00000000,0x5A529200,0x00002226,0x00000000
-	.word 0x00000000,0x040C1200,0x00000906,0x00000000,0x00000000,0x0A0A1200,0x01020206,0x00000000
-	.word 0x00000000,0x04081E00,0x00000F02,0x00000000,0x08300000,0x02040808,0x18040404,0x00000000
-	.word 0x04040000,0x04040404,0x04040404,0x00000000,0x08060000,0x08100808,0x03040404,0x00000000
-	.word 0x00000000,0x19260000,0x00000000,0x00000000,0x00000000,0x1212243C,0x00000F12,0x00000000
-
-	.word 0x1C000000,0x03010722,0x00000E11,0x00000000,0x1C000000,0x0A0A0A14,0x00000705,0x00000000
-	.word 0x00000000,0x00000000,0x00010200,0x00000000,0x30000000,0x081C0808,0x00030404,0x00000000
-	.word 0x00000000,0x00000000,0x00050A00,0x00000000,0x00000000,0x00000000,0x00001500,0x00000000
-	.word 0x08080000,0x0204041E,0x00000002,0x00000000,0x08080000,0x020F041E,0x00000002,0x00000000
-	.word 0x14080000,0x00000000,0x00000000,0x00000000,0x15250600,0x557A040B,0x00003C54,0x00000000
-	.word 0x0C000814,0x100C0212,0x00000E11,0x00000000,0x00000000,0x01020400,0x00000002,0x00000000
-	.word 0xFC000000,0x09711112,0x00007E09,0x00000000,0x1C000000,0x0A0A0A14,0x00000705,0x00000000
-	.word 0x3E001028,0x02040810,0x00001F01,0x00000000,0x1C000000,0x0A0A0A14,0x00000705,0x00000000
-
-	.word 0x1C000000,0x0A0A0A14,0x00000705,0x00000000,0x02010000,0x00000000,0x00000000,0x00000000
-	.word 0x01020000,0x00000000,0x00000000,0x00000000,0x0A050000,0x00000000,0x00000000,0x00000000
-	.word 0x050A0000,0x00000000,0x00000000,0x00000000,0x00000000,0x0E0E0E00,0x00000000,0x00000000
-	.word 0x00000000,0x3E000000,0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x00000000
-	.word 0x342C0000,0x00000000,0x00000000,0x00000000,0x97000000,0x000092F2,0x00000000,0x00000000
-	.word 0x08140000,0x04021C00,0x00000708,0x00000000,0x00000000,0x02040200,0x00000001,0x00000000
-	.word 0x00000000,0xF1926C00,0x0000E619,0x00000000,0x1C000000,0x0A0A0A14,0x00000705,0x00000000
-	.word 0x08140000,0x04081E00,0x00000F02,0x00000000,0x22001400,0x04040C12,0x00000202,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x04000000,0x02040400,0x00000202,0x00000000
-	.word 0x08000000,0x05051E08,0x04041E05,0x00000000,0x30000000,0x041E0408,0x00001F02,0x00000000
-	.word 0x00000000,0x0A0E1100,0x0000110E,0x00000000,0x22000000,0x1E081414,0x00000404,0x00000000
-	.word 0x04040000,0x00000404,0x04040404,0x00000000,0x3C000000,0x120A0602,0x0F101814,0x00000000
-	.word 0x14000000,0x00000000,0x00000000,0x00000000,0x3C000000,0x8585B942,0x003C42B9,0x00000000
-	.word 0x06000000,0x00070F08,0x00000000,0x00000000,0x00000000,0x050A1400,0x0000000A,0x00000000
-	.word 0x00000000,0x3E000000,0x00002020,0x00000000,0x00000000,0x07000000,0x00000000,0x00000000
-	.word 0x3C000000,0x9DA59D42,0x003C42A5,0x00000000,0x007E0000,0x00000000,0x00000000,0x00000000
-
-	.word 0x0C000000,0x000C1212,0x00000000,0x00000000,0x00000000,0x083E0808,0x0000003E,0x00000000
-	.word 0x0E000000,0x000F0608,0x00000000,0x00000000,0x1C000000,0x000E100C,0x00000000,0x00000000
-	.word 0x08100000,0x00000000,0x00000000,0x00000000,0x00000000,0x12242400,0x01011E12,0x00000000
-	.word 0x3C000000,0x14162E2E,0x0A0A0A14,0x00000000,0x00000000,0x02000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x06080000,0x00000000,0x0C000000,0x000E0408,0x00000000,0x00000000
-	.word 0x06000000,0x00060909,0x00000000,0x00000000,0x00000000,0x0A140A00,0x00000005,0x00000000
-	.word 0x12230000,0x51620509,0x00002078,0x00000000,0x12230000,0x41720509,0x00007830,0x00000000
-	.word 0x14220700,0x5162040B,0x00002078,0x00000000,0x08000000,0x01060800,0x00000E01,0x00000000
-
-	.word 0x18001008,0x1E121414,0x00001111,0x00000000,0x18001020,0x1E121414,0x00001111,0x00000000
-	.word 0x18002810,0x1E121414,0x00001111,0x00000000,0x1800342C,0x1E121414,0x00001111,0x00000000
-	.word 0x18002800,0x1E121414,0x00001111,0x00000000,0x18242418,0x1E121414,0x00001111,0x00000000
-	.word 0xF8000000,0x1E721428,0x00007909,0x00000000,0x1C000000,0x01010122,0x03040E11,0x00000000
-	.word 0x3C001008,0x021E0204,0x00000F01,0x00000000,0x3C001020,0x021E0204,0x00000F01,0x00000000
-	.word 0x3C002810,0x021E0204,0x00000F01,0x00000000,0x3C002800,0x021E0204,0x00000F01,0x00000000
-	.word 0x1C001008,0x04040408,0x00000702,0x00000000,0x1C000810,0x04040408,0x00000702,0x00000000
-	.word 0x1C001408,0x04040408,0x00000702,0x00000000,0x1C001400,0x04040408,0x00000702,0x00000000
-
-	.word 0x1C000000,0x22272224,0x00000F11,0x00000000,0x44006858,0x2A2A2A44,0x00001111,0x00000000
-	.word 0x1C001008,0x21212122,0x00000E11,0x00000000,0x1C000810,0x21212122,0x00000E11,0x00000000
-	.word 0x1C001408,0x21212122,0x00000E11,0x00000000,0x1C00342C,0x21212122,0x00000E11,0x00000000
-	.word 0x1C001400,0x21212122,0x00000E11,0x00000000,0x00000000,0x14081422,0x00000022,0x00000000
-	.word 0x1C200000,0x25252932,0x00010E13,0x00000000,0x42001008,0x21212242,0x00000E11,0x00000000
-	.word 0x42001020,0x21212242,0x00000E11,0x00000000,0x42002810,0x21212242,0x00000E11,0x00000000
-	.word 0x42002800,0x21212242,0x00000E11,0x00000000,0x22000810,0x04040C12,0x00000202,0x00000000
-	.word 0x04000000,0x0E12120C,0x00000101,0x00000000,0x24180000,0x12121A24,0x00000D11,0x00000000
-
-	.word 0x08040000,0x0E080600,0x00000705,0x00000000,0x04080000,0x0E080600,0x00000705,0x00000000
-	.word 0x0A040000,0x0E080600,0x00000705,0x00000000,0x1A160000,0x0E080600,0x00000705,0x00000000
-	.word 0x0A000000,0x0E080600,0x00000705,0x00000000,0x0A040000,0x0E080604,0x00000705,0x00000000
-	.word 0x00000000,0xFE906E00,0x0000F709,0x00000000,0x00000000,0x01021C00,0x03040E01,0x00000000
-	.word 0x04020000,0x0F090600,0x00000E01,0x00000000,0x04080000,0x0F090600,0x00000E01,0x00000000
-	.word 0x0A040000,0x0F090600,0x00000E01,0x00000000,0x0A000000,0x0F090600,0x00000E01,0x00000000
-	.word 0x04020000,0x02020200,0x00000101,0x00000000,0x04080000,0x02020200,0x00000101,0x00000000
-	.word 0x05020000,0x02020200,0x00000101,0x00000000,0x05000000,0x02020200,0x00000101,0x00000000
-
-	.word 0x08140000,0x111E1014,0x00000709,0x00000000,0x1A160000,0x12120E00,0x00000909,0x00000000
-	.word 0x08040000,0x09090600,0x00000609,0x00000000,0x04080000,0x09090600,0x00000609,0x00000000
-	.word 0x0A040000,0x09090600,0x00000609,0x00000000,0x1A160000,0x09090600,0x00000609,0x00000000
-	.word 0x0A000000,0x09090600,0x00000609,0x00000000,0x00000000,0x003E0008,0x00000008,0x00000000
-	.word 0x00000000,0x0B0D0E08,0x0001070B,0x00000000,0x08040000,0x11121200,0x00000E09,0x00000000
-	.word 0x08100000,0x11121200,0x00000E09,0x00000000,0x14080000,0x11121200,0x00000E09,0x00000000
-	.word 0x14000000,0x11121200,0x00000E09,0x00000000,0x08100000,0x0A0A1200,0x01020206,0x00000000
-	.word 0x04080000,0x22241C04,0x01010E12,0x00000000,0x14000000,0x0A0A1200,0x01020206,0x00000000
-
-	.section .rodata
-	.align	2
-	.global verdana9iWidths		@ 224 unsigned chars
-verdana9iWidths:
-	.byte 0x03,0x04,0x04,0x07,0x06,0x08,0x07,0x02,0x04,0x05,0x06,0x07,0x03,0x04,0x03,0x05
-	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x04,0x04,0x07,0x07,0x07,0x05
-	.byte 0x08,0x06,0x06,0x06,0x07,0x06,0x06,0x07,0x07,0x05,0x05,0x07,0x05,0x08,0x07,0x07
-	.byte 0x05,0x07,0x06,0x06,0x06,0x07,0x06,0x08,0x06,0x06,0x06,0x06,0x04,0x05,0x07,0x07
-	.byte 0x06,0x05,0x06,0x05,0x06,0x05,0x05,0x06,0x06,0x03,0x05,0x05,0x03,0x08,0x06,0x05
-	.byte 0x07,0x06,0x04,0x06,0x04,0x06,0x06,0x08,0x05,0x06,0x05,0x06,0x04,0x06,0x07,0x06
-	.byte 0x06,0x05,0x02,0x06,0x05,0x07,0x06,0x06,0x06,0x08,0x06,0x04,0x08,0x05,0x06,0x05
-	.byte 0x05,0x02,0x02,0x04,0x04,0x05,0x06,0x08,0x06,0x08,0x06,0x04,0x08,0x05,0x05,0x06
-
-	.byte 0x03,0x04,0x06,0x06,0x06,0x06,0x04,0x06,0x06,0x08,0x05,0x06,0x07,0x04,0x08,0x07
-	.byte 0x05,0x07,0x05,0x05,0x06,0x07,0x06,0x03,0x06,0x05,0x05,0x06,0x08,0x08,0x08,0x05
-	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x08,0x06,0x06,0x06,0x06,0x06,0x05,0x05,0x05,0x05
-	.byte 0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x06,0x05,0x06
-	.byte 0x05,0x05,0x05,0x05,0x05,0x05,0x08,0x05,0x05,0x05,0x05,0x05,0x03,0x04,0x03,0x03
-	.byte 0x06,0x06,0x05,0x05,0x05,0x05,0x05,0x07,0x05,0x06,0x06,0x06,0x06,0x06,0x07,0x06
-
-@}}BLOCK(verdana9i)
+
+@{{BLOCK(verdana9i)
+
+@ Verdana 9 italic, ' ' to ''
+
+	.section .rodata
+	.align	2
+	.global	verdana9iFont
+verdana9iFont:
+	.word	verdana9iGlyphs, verdana9iWidths, 0
+	.hword	32, 224
+	.byte	8, 12
+	.byte	8, 16
+	.hword	16
+	.byte	1, 0
+
+	.section .rodata
+	.align	2
+	.global verdana9iGlyphs		@ 3584 unsigned chars
+verdana9iGlyphs:
+	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x04000000,0x02020204,0x00000200,0x00000000
+	.word 0x0A0A0000,0x0000000A,0x00000000,0x00000000,0x28000000,0x3F147E28,0x00000A0A,0x00000000
+	.word 0x08080000,0x140A0A1C,0x02020F14,0x00000000,0x46000000,0xA8CB1525,0x000062A4,0x00000000
+	.word 0x0C000000,0x19260A12,0x00002E11,0x00000000,0x02020000,0x00000002,0x00000000,0x00000000
+	.word 0x04080000,0x01010202,0x02010101,0x00000000,0x08040000,0x08080808,0x01020404,0x00000000
+	.word 0x15040000,0x0004150E,0x00000000,0x00000000,0x00000000,0x083E0808,0x00000008,0x00000000
+	.word 0x00000000,0x00000000,0x01020200,0x00000000,0x00000000,0x07000000,0x00000000,0x00000000
+	.word 0x00000000,0x00000000,0x00000200,0x00000000,0x10100000,0x02040808,0x00010102,0x00000000
+
+	.word 0x0C000000,0x11111112,0x00000609,0x00000000,0x10000000,0x0808081C,0x00000E04,0x00000000
+	.word 0x0E000000,0x06081010,0x00000F01,0x00000000,0x0E000000,0x080C1010,0x00000708,0x00000000
+	.word 0x18000000,0x1F090A14,0x00000404,0x00000000,0x1C000000,0x08060204,0x00000708,0x00000000
+	.word 0x1C000000,0x110F0102,0x00000E11,0x00000000,0x1E000000,0x04080810,0x00000204,0x00000000
+	.word 0x0C000000,0x110E1212,0x00000E11,0x00000000,0x0E000000,0x101E1111,0x00000708,0x00000000
+	.word 0x00000000,0x00000400,0x00000200,0x00000000,0x00000000,0x00000400,0x01020200,0x00000000
+	.word 0x00000000,0x18061820,0x00000020,0x00000000,0x00000000,0x003E0000,0x0000003E,0x00000000
+	.word 0x00000000,0x0C300C02,0x00000002,0x00000000,0x0E000000,0x020C1010,0x00000200,0x00000000
+
+	.word 0x78000000,0x95A5BA86,0x001E017D,0x00000000,0x18000000,0x1E121414,0x00001111,0x00000000
+	.word 0x0C000000,0x120E1214,0x00000F11,0x00000000,0x1C000000,0x01010122,0x00000E11,0x00000000
+	.word 0x1C000000,0x22222224,0x00000F11,0x00000000,0x3C000000,0x021E0204,0x00000F01,0x00000000
+	.word 0x3C000000,0x021E0204,0x00000101,0x00000000,0x1C000000,0x31010122,0x00001E21,0x00000000
+	.word 0x44000000,0x223E2244,0x00001111,0x00000000,0x1C000000,0x04040408,0x00000702,0x00000000
+	.word 0x18000000,0x08080810,0x00000304,0x00000000,0x24000000,0x0A060A14,0x00001109,0x00000000
+	.word 0x04000000,0x02020204,0x00000F01,0x00000000,0x84000000,0x4A5A6AC4,0x00002121,0x00000000
+	.word 0x44000000,0x2A2A2A44,0x00001111,0x00000000,0x1C000000,0x21212122,0x00000E11,0x00000000
+
+	.word 0x0C000000,0x020E1214,0x00000101,0x00000000,0x1C000000,0x21212122,0x30080E11,0x00000000
+	.word 0x1C000000,0x0A1E2224,0x00002111,0x00000000,0x0C000000,0x100C0212,0x00000E11,0x00000000
+	.word 0x3E000000,0x04040408,0x00000202,0x00000000,0x42000000,0x21212242,0x00000E11,0x00000000
+	.word 0x22000000,0x0A0A1222,0x00000206,0x00000000,0xA2000000,0x666AAAB2,0x00002266,0x00000000
+	.word 0x22000000,0x0C0C0C12,0x00001112,0x00000000,0x22000000,0x04040C12,0x00000202,0x00000000
+	.word 0x3E000000,0x02040810,0x00001F01,0x00000000,0x08380000,0x02040404,0x07010202,0x00000000
+	.word 0x01010000,0x02020201,0x80040404,0x00000000,0x101C0000,0x04080808,0x03020404,0x00000000
+	.word 0x18000000,0x00004224,0x00000000,0x00000000,0x00000000,0x00000000,0x3F000000,0x00000000
+
+	.word 0x08040000,0x00000000,0x00000000,0x00000000,0x00000000,0x0E080600,0x00000705,0x00000000
+	.word 0x04040000,0x12120E04,0x00000709,0x00000000,0x00000000,0x01021C00,0x00000E01,0x00000000
+	.word 0x20200000,0x11121C20,0x00000E09,0x00000000,0x00000000,0x0F090600,0x00000E01,0x00000000
+	.word 0x04180000,0x02020F04,0x00000101,0x00000000,0x00000000,0x11121C00,0x07080E09,0x00000000
+	.word 0x04040000,0x12120E04,0x00000909,0x00000000,0x04000000,0x02020200,0x00000101,0x00000000
+	.word 0x10000000,0x08080C00,0x03040404,0x00000000,0x04040000,0x060A1204,0x00000905,0x00000000
+	.word 0x04040000,0x02020204,0x00000101,0x00000000,0x00000000,0x92926E00,0x00004949,0x00000000
+	.word 0x00000000,0x12120E00,0x00000909,0x00000000,0x00000000,0x09090600,0x00000609,0x00000000
+
+	.word 0x00000000,0x22241C00,0x01010E12,0x00000000,0x00000000,0x11121C00,0x04040E09,0x00000000
+	.word 0x00000000,0x02060A00,0x00000101,0x00000000,0x00000000,0x04021C00,0x00000708,0x00000000
+	.word 0x00000000,0x01020F02,0x00000601,0x00000000,0x00000000,0x11121200,0x00000E09,0x00000000
+	.word 0x00000000,0x0A0A1200,0x00000206,0x00000000,0x00000000,0x5A529200,0x00002226,0x00000000
+	.word 0x00000000,0x040C1200,0x00000906,0x00000000,0x00000000,0x0A0A1200,0x01020206,0x00000000
+	.word 0x00000000,0x04081E00,0x00000F02,0x00000000,0x08300000,0x02040808,0x18040404,0x00000000
+	.word 0x04040000,0x04040404,0x04040404,0x00000000,0x08060000,0x08100808,0x03040404,0x00000000
+	.word 0x00000000,0x19260000,0x00000000,0x00000000,0x00000000,0x1212243C,0x00000F12,0x00000000
+
+	.word 0x1C000000,0x03010722,0x00000E11,0x00000000,0x1C000000,0x0A0A0A14,0x00000705,0x00000000
+	.word 0x00000000,0x00000000,0x00010200,0x00000000,0x30000000,0x081C0808,0x00030404,0x00000000
+	.word 0x00000000,0x00000000,0x00050A00,0x00000000,0x00000000,0x00000000,0x00001500,0x00000000
+	.word 0x08080000,0x0204041E,0x00000002,0x00000000,0x08080000,0x020F041E,0x00000002,0x00000000
+	.word 0x14080000,0x00000000,0x00000000,0x00000000,0x15250600,0x557A040B,0x00003C54,0x00000000
+	.word 0x0C000814,0x100C0212,0x00000E11,0x00000000,0x00000000,0x01020400,0x00000002,0x00000000
+	.word 0xFC000000,0x09711112,0x00007E09,0x00000000,0x1C000000,0x0A0A0A14,0x00000705,0x00000000
+	.word 0x3E001028,0x02040810,0x00001F01,0x00000000,0x1C000000,0x0A0A0A14,0x00000705,0x00000000
+
+	.word 0x1C000000,0x0A0A0A14,0x00000705,0x00000000,0x02010000,0x00000000,0x00000000,0x00000000
+	.word 0x01020000,0x00000000,0x00000000,0x00000000,0x0A050000,0x00000000,0x00000000,0x00000000
+	.word 0x050A0000,0x00000000,0x00000000,0x00000000,0x00000000,0x0E0E0E00,0x00000000,0x00000000
+	.word 0x00000000,0x3E000000,0x00000000,0x00000000,0x00000000,0xFE000000,0x00000000,0x00000000
+	.word 0x342C0000,0x00000000,0x00000000,0x00000000,0x97000000,0x000092F2,0x00000000,0x00000000
+	.word 0x08140000,0x04021C00,0x00000708,0x00000000,0x00000000,0x02040200,0x00000001,0x00000000
+	.word 0x00000000,0xF1926C00,0x0000E619,0x00000000,0x1C000000,0x0A0A0A14,0x00000705,0x00000000
+	.word 0x08140000,0x04081E00,0x00000F02,0x00000000,0x22001400,0x04040C12,0x00000202,0x00000000
+
+	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x04000000,0x02040400,0x00000202,0x00000000
+	.word 0x08000000,0x05051E08,0x04041E05,0x00000000,0x30000000,0x041E0408,0x00001F02,0x00000000
+	.word 0x00000000,0x0A0E1100,0x0000110E,0x00000000,0x22000000,0x1E081414,0x00000404,0x00000000
+	.word 0x04040000,0x00000404,0x04040404,0x00000000,0x3C000000,0x120A0602,0x0F101814,0x00000000
+	.word 0x14000000,0x00000000,0x00000000,0x00000000,0x3C000000,0x8585B942,0x003C42B9,0x00000000
+	.word 0x06000000,0x00070F08,0x00000000,0x00000000,0x00000000,0x050A1400,0x0000000A,0x00000000
+	.word 0x00000000,0x3E000000,0x00002020,0x00000000,0x00000000,0x07000000,0x00000000,0x00000000
+	.word 0x3C000000,0x9DA59D42,0x003C42A5,0x00000000,0x007E0000,0x00000000,0x00000000,0x00000000
+
+	.word 0x0C000000,0x000C1212,0x00000000,0x00000000,0x00000000,0x083E0808,0x0000003E,0x00000000
+	.word 0x0E000000,0x000F0608,0x00000000,0x00000000,0x1C000000,0x000E100C,0x00000000,0x00000000
+	.word 0x08100000,0x00000000,0x00000000,0x00000000,0x00000000,0x12242400,0x01011E12,0x00000000
+	.word 0x3C000000,0x14162E2E,0x0A0A0A14,0x00000000,0x00000000,0x02000000,0x00000000,0x00000000
+	.word 0x00000000,0x00000000,0x06080000,0x00000000,0x0C000000,0x000E0408,0x00000000,0x00000000
+	.word 0x06000000,0x00060909,0x00000000,0x00000000,0x00000000,0x0A140A00,0x00000005,0x00000000
+	.word 0x12230000,0x51620509,0x00002078,0x00000000,0x12230000,0x41720509,0x00007830,0x00000000
+	.word 0x14220700,0x5162040B,0x00002078,0x00000000,0x08000000,0x01060800,0x00000E01,0x00000000
+
+	.word 0x18001008,0x1E121414,0x00001111,0x00000000,0x18001020,0x1E121414,0x00001111,0x00000000
+	.word 0x18002810,0x1E121414,0x00001111,0x00000000,0x1800342C,0x1E121414,0x00001111,0x00000000
+	.word 0x18002800,0x1E121414,0x00001111,0x00000000,0x18242418,0x1E121414,0x00001111,0x00000000
+	.word 0xF8000000,0x1E721428,0x00007909,0x00000000,0x1C000000,0x01010122,0x03040E11,0x00000000
+	.word 0x3C001008,0x021E0204,0x00000F01,0x00000000,0x3C001020,0x021E0204,0x00000F01,0x00000000
+	.word 0x3C002810,0x021E0204,0x00000F01,0x00000000,0x3C002800,0x021E0204,0x00000F01,0x00000000
+	.word 0x1C001008,0x04040408,0x00000702,0x00000000,0x1C000810,0x04040408,0x00000702,0x00000000
+	.word 0x1C001408,0x04040408,0x00000702,0x00000000,0x1C001400,0x04040408,0x00000702,0x00000000
+
+	.word 0x1C000000,0x22272224,0x00000F11,0x00000000,0x44006858,0x2A2A2A44,0x00001111,0x00000000
+	.word 0x1C001008,0x21212122,0x00000E11,0x00000000,0x1C000810,0x21212122,0x00000E11,0x00000000
+	.word 0x1C001408,0x21212122,0x00000E11,0x00000000,0x1C00342C,0x21212122,0x00000E11,0x00000000
+	.word 0x1C001400,0x21212122,0x00000E11,0x00000000,0x00000000,0x14081422,0x00000022,0x00000000
+	.word 0x1C200000,0x25252932,0x00010E13,0x00000000,0x42001008,0x21212242,0x00000E11,0x00000000
+	.word 0x42001020,0x21212242,0x00000E11,0x00000000,0x42002810,0x21212242,0x00000E11,0x00000000
+	.word 0x42002800,0x21212242,0x00000E11,0x00000000,0x22000810,0x04040C12,0x00000202,0x00000000
+	.word 0x04000000,0x0E12120C,0x00000101,0x00000000,0x24180000,0x12121A24,0x00000D11,0x00000000
+
+	.word 0x08040000,0x0E080600,0x00000705,0x00000000,0x04080000,0x0E080600,0x00000705,0x00000000
+	.word 0x0A040000,0x0E080600,0x00000705,0x00000000,0x1A160000,0x0E080600,0x00000705,0x00000000
+	.word 0x0A000000,0x0E080600,0x00000705,0x00000000,0x0A040000,0x0E080604,0x00000705,0x00000000
+	.word 0x00000000,0xFE906E00,0x0000F709,0x00000000,0x00000000,0x01021C00,0x03040E01,0x00000000
+	.word 0x04020000,0x0F090600,0x00000E01,0x00000000,0x04080000,0x0F090600,0x00000E01,0x00000000
+	.word 0x0A040000,0x0F090600,0x00000E01,0x00000000,0x0A000000,0x0F090600,0x00000E01,0x00000000
+	.word 0x04020000,0x02020200,0x00000101,0x00000000,0x04080000,0x02020200,0x00000101,0x00000000
+	.word 0x05020000,0x02020200,0x00000101,0x00000000,0x05000000,0x02020200,0x00000101,0x00000000
+
+	.word 0x08140000,0x111E1014,0x00000709,0x00000000,0x1A160000,0x12120E00,0x00000909,0x00000000
+	.word 0x08040000,0x09090600,0x00000609,0x00000000,0x04080000,0x09090600,0x00000609,0x00000000
+	.word 0x0A040000,0x09090600,0x00000609,0x00000000,0x1A160000,0x09090600,0x00000609,0x00000000
+	.word 0x0A000000,0x09090600,0x00000609,0x00000000,0x00000000,0x003E0008,0x00000008,0x00000000
+	.word 0x00000000,0x0B0D0E08,0x0001070B,0x00000000,0x08040000,0x11121200,0x00000E09,0x00000000
+	.word 0x08100000,0x11121200,0x00000E09,0x00000000,0x14080000,0x11121200,0x00000E09,0x00000000
+	.word 0x14000000,0x11121200,0x00000E09,0x00000000,0x08100000,0x0A0A1200,0x01020206,0x00000000
+	.word 0x04080000,0x22241C04,0x01010E12,0x00000000,0x14000000,0x0A0A1200,0x01020206,0x00000000
+
+	.section .rodata
+	.align	2
+	.global verdana9iWidths		@ 224 unsigned chars
+verdana9iWidths:
+	.byte 0x03,0x04,0x04,0x07,0x06,0x08,0x07,0x02,0x04,0x05,0x06,0x07,0x03,0x04,0x03,0x05
+	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x04,0x04,0x07,0x07,0x07,0x05
+	.byte 0x08,0x06,0x06,0x06,0x07,0x06,0x06,0x07,0x07,0x05,0x05,0x07,0x05,0x08,0x07,0x07
+	.byte 0x05,0x07,0x06,0x06,0x06,0x07,0x06,0x08,0x06,0x06,0x06,0x06,0x04,0x05,0x07,0x07
+	.byte 0x06,0x05,0x06,0x05,0x06,0x05,0x05,0x06,0x06,0x03,0x05,0x05,0x03,0x08,0x06,0x05
+	.byte 0x07,0x06,0x04,0x06,0x04,0x06,0x06,0x08,0x05,0x06,0x05,0x06,0x04,0x06,0x07,0x06
+	.byte 0x06,0x05,0x02,0x06,0x05,0x07,0x06,0x06,0x06,0x08,0x06,0x04,0x08,0x05,0x06,0x05
+	.byte 0x05,0x02,0x02,0x04,0x04,0x05,0x06,0x08,0x06,0x08,0x06,0x04,0x08,0x05,0x05,0x06
+
+	.byte 0x03,0x04,0x06,0x06,0x06,0x06,0x04,0x06,0x06,0x08,0x05,0x06,0x07,0x04,0x08,0x07
+	.byte 0x05,0x07,0x05,0x05,0x06,0x07,0x06,0x03,0x06,0x05,0x05,0x06,0x08,0x08,0x08,0x05
+	.byte 0x06,0x06,0x06,0x06,0x06,0x06,0x08,0x06,0x06,0x06,0x06,0x06,0x05,0x05,0x05,0x05
+	.byte 0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x06,0x05,0x06
+	.byte 0x05,0x05,0x05,0x05,0x05,0x05,0x08,0x05,0x05,0x05,0x05,0x05,0x03,0x04,0x03,0x03
+	.byte 0x06,0x06,0x05,0x05,0x05,0x05,0x05,0x07,0x05,0x06,0x06,0x06,0x06,0x06,0x07,0x06
+
+@}}BLOCK(verdana9i)
@@ -0,0 +1,176 @@
+//
+//  Nearest palette color matching and quantization
+//
+//! \file tonc_clrmatch.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Distance is the weighted squared RGB difference, with weights
+	2:4:3. Not perceptually exact, but a good deal better than plain
+	RGB distance and still all integer math.
+  * The cache is filled lazily instead of all at once: a full build
+	against a 256 color palette is 8M distance checks, which takes
+	seconds. Most images only use a few thousand distinct colors.
+*/
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+#include "tonc_video.hpp"
+#include "tonc_surface.hpp"
+#include "tonc_math.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Find the palette index nearest to \a clr.
+/*!	Brute force search; use a TPalCache if you need lots of these.
+	\param clr	Color to match.
+	\param pal	Palette to search.
+	\param nclrs	Number of palette entries.
+	\return	Index of the closest color in \a pal. Exact matches end
+		the search early.
+*/
+uint clr_nearest(COLOR clr, const COLOR *pal, uint nclrs)
+{
+	int rr= clr&31, gg= clr>>5&31, bb= clr>>10&31;
+	int dr, dg, db;
+	uint ii, best=0;
+	u32 dist, bestDist= 0xFFFFFFFF;
+
+	for(ii=0; ii<nclrs; ii++)
+	{
+		u32 pc= pal[ii];
+		dr= (int)(pc    &31) - rr;
+		dg= (int)(pc>>5 &31) - gg;
+		db= (int)(pc>>10&31) - bb;
+
+		dist= 2*dr*dr + 4*dg*dg + 3*db*db;
+		if(dist < bestDist)
+		{
+			if(dist == 0)
+				return ii;
+			bestDist= dist;
+			best= ii;
+		}
+	}
+	return best;
+}
+
+//! Initialize a nearest-color cache.
+/*!	\param pc	Cache to initialize.
+	\param pal	Palette to match against. Only the pointer is kept, so
+		the palette must stay put (pal_bg_mem is fine).
+	\param first	First palette index that may be returned. Use 1 to
+		skip the transparent color.
+	\param count	Number of colors from \a first on.
+*/
+void pcache_init(TPalCache *pc, const COLOR *pal, uint first, uint count)
+{
+	pc->pal= pal;
+	pc->first= first;
+	pc->count= count;
+	pcache_clear(pc);
+}
+
+//! Invalidate all entries; call after the palette has changed.
+void pcache_clear(TPalCache *pc)
+{
+	memset32(pc->valid, 0, sizeof(pc->valid)/4);
+}
+
+//! Fill in all 32K entries at once.
+/*!	\note	Slow: 32K searches through the palette. Only for when
+		a load screen is hiding it anyway.
+*/
+void pcache_build(TPalCache *pc)
+{
+	uint ii;
+	for(ii=0; ii<32768; ii++)
+		if(~pc->valid[ii>>5] & BIT(ii&31))
+			pcache_fill(pc, ii);
+}
+
+//! Look up \a clr in the palette and store it in the cache.
+/*!	This is the cache-miss path of pcache_get().
+*/
+uint pcache_fill(TPalCache *pc, COLOR clr)
+{
+	clr &= 0x7FFF;
+	uint index= pc->first + clr_nearest(clr, &pc->pal[pc->first], pc->count);
+
+	pc->map[clr]= index;
+	pc->valid[clr>>5] |= BIT(clr&31);
+
+	return index;
+}
+
+//! Quantize a 16bpp surface into an 8bpp or 4bpp surface.
+/*!	Converts the overlapping area of \a src and \a dst, starting at
+	the top-left of both.
+	\param dst	Destination surface: SRF_BMP8, SRF_CHR4C or SRF_CHR4R.
+	\param src	Source surface; must be SRF_BMP16.
+	\param pc	Cache for the destination palette. For 4bpp
+		surfaces it must not give indices over 15.
+	\note	Pixels are written a word at a time: 4 for bmp8, a
+		tile-row of 8 for chr4, so VRAM destinations are fine.
+*/
+void srf_quantize(const TSurface *dst, const TSurface *src, TPalCache *pc)
+{
+	if(src->bpp != 16)
+		return;
+
+	uint width= min(dst->width, src->width);
+	uint height= min(dst->height, src->height);
+	uint ix, iy, ii;
+
+	for(iy=0; iy<height; iy++)
+	{
+		const u16 *srcL= (const u16*)&src->data[iy*src->pitch];
+
+		switch(dst->type &~ SRF_ALLOCATED)
+		{
+		case SRF_BMP8:
+		{
+			u32 *dstL= (u32*)&dst->data[iy*dst->pitch];
+			for(ix=0; ix<width; ix += 4)
+			{
+				u32 px= 0, nn= min(4, width-ix);
+				for(ii=0; ii<nn; ii++)
+					px |= pcache_get(pc, srcL[ix+ii])<<(ii*8);
+				if(nn < 4)
+				{
+					u32 mask= BIT_MASK(nn*8);
+					px |= *dstL &~ mask;
+				}
+				*dstL++= px;
+			}
+			break;
+		}
+		case SRF_CHR4C:
+		case SRF_CHR4R:
+			for(ix=0; ix<width; ix += 8)
+			{
+				u32 *dstD= (u32*)srf_get_ptr(dst, ix, iy);
+				u32 px= 0, nn= min(8, width-ix);
+				for(ii=0; ii<nn; ii++)
+					px |= (pcache_get(pc, srcL[ix+ii])&15)<<(ii*4);
+				if(nn < 8)
+				{
+					u32 mask= BIT_MASK(nn*4);
+					px |= *dstD &~ mask;
+				}
+				*dstD= px;
+			}
+			break;
+
+		default:
+			return;
+		}
+	}
+}
+
+// EOF
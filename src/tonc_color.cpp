@@ -1,370 +1,574 @@
-//
-//  Some interesting color routines
-//
-//! \file tonc_color.c
-//! \author J Vijn
-//! \date 20070823 - 20070907
-//
-// === NOTES ===
-
-#include "tonc_memmap.hpp"
-#include "tonc_video.hpp"
-#include "tonc_bios.hpp"
-#include "tonc_math.hpp"
-
-
-// --------------------------------------------------------------------
-// FUNCTIONS 
-// --------------------------------------------------------------------
-
-
-//! Rotate \a nclrs colors at \a clrs to the right by \a ror.
-/*!	\note I can't help but think there's a faster way ... I just can't 
-		see it atm.
-*/
-void clr_rotate(COLOR *clrs, uint nclrs, int ror)
-{
-	if(ror == 0)		// Nothing to do
-		return;
-
-	uint ii;
-	uint jj;
-	uint rot;
-	u32 tmp;
-
-	// NOTE: 
-	// Yes, this is O(n^2)
-	// Two optimisations are possible for |ror|>1
-	// 1) Extra buffer (simply write at an offset) O(n)
-	// 2) Double loops (ror and nclrs/ror) steps), run recursively 
-	//	  with nclrs=nclrs-nclrs%ror, ror=nclrs-nclrs%ror. O(n)*log(n) ?
-
-	if(ror > 0)			// Rotate right
-	{
-		rot= ror;
-		if(rot > nclrs)
-			rot= Mod(rot, nclrs);
-		for(ii=0; ii<rot; ii++)
-		{
-			tmp= clrs[nclrs-1];
-			for(jj=nclrs-1; jj>0; jj--)
-				clrs[jj]= clrs[jj-1];
-			clrs[0]= tmp;
-		}	
-	}
-	else				// Rotate left
-	{
-		rot= nclrs-ror;
-		if(rot > nclrs)
-			rot= Mod(rot, nclrs);
-		for(ii=0; ii<rot; ii++)
-		{
-			tmp= clrs[0];
-			for(jj=0; jj<nclrs-1; jj++)
-				clrs[jj]= clrs[jj+1];
-			clrs[nclrs-1]= tmp;
-		}
-	}	
-}
-
-
-//!	Blends color arrays \a srca and \a srcb into \a dst.
-/*!	Specific transitional blending effects can be created by making 
-	a 'target' color array with other routines, then using \a alpha 
-	to morph into it.
-	\param srca	Source array A.
-	\param srcb	Source array B
-	\param dst	Destination array.
-	\param nclrs	Number of colors.
-	\param alpha	Blend weight (range: 0-32). 0 Means full \a srca
-*/
-void clr_blend(const COLOR *srca, const COLOR *srcb, COLOR *dst, 
-		uint nclrs, u32 alpha)
-{
-	if(!nclrs)
-		return;
-
-	uint ii;
-	u32 clra, clrb, clr;
-	u32 parta, partb, part;
-	const u32 rbmask= (RED_MASK|BLUE_MASK), gmask= GREEN_MASK;
-	const u32 rbhalf= 0x4010, ghalf= 0x0200;
-
-	for(ii=0; ii<nclrs; ii++)
-	{
-		clra= srca[ii];
-		clrb= srcb[ii];
-		
-		// Red and blue
-		parta= clra & rbmask;
-		partb= clrb & rbmask;
-		part = (partb-parta)*alpha + parta*32 + rbhalf;
-		clr  = (part/32 ) & rbmask;
-
-		// Green
-		parta= clra & gmask;
-		partb= clrb & gmask;
-		part = (partb-parta)*alpha + parta*32 + ghalf;
-		clr |= (part/32 ) & gmask;
-
-		dst[ii]= clr;
-	}
-}
-
-//!	Fades color arrays \a srca to \a clr into \a dst.
-/*!
-	\param src	Source array.
-	\param clr	Final color (at alpha=32).
-	\param dst	Destination array.
-	\param nclrs	Number of colors.
-	\param alpha	Blend weight (range: 0-32). 0 Means full \a srca
-*/
-void clr_fade(const COLOR *src, COLOR clr, COLOR *dst, 
-		uint nclrs, u32 alpha)
-{
-	if(!nclrs)
-		return;
-
-	uint ii;
-	u32 clra, parta, part;
-	const u32 rbmask= (RED_MASK|BLUE_MASK), gmask= GREEN_MASK;
-	const u32 rbhalf= 0x4010, ghalf= 0x0200;
-
-	// precalc color B parts
-	u32 partb_rb= clr & rbmask, partb_g= clr & gmask;
-
-	for(ii=0; ii<nclrs; ii++)
-	{
-		clra= src[ii];
-
-		// Red and blue
-		parta= clra & rbmask;
-		part = (partb_rb-parta)*alpha + parta*32 + rbhalf;
-		clr  = (part/32) & rbmask;
-
-		// Green
-		parta= clra & gmask;
-		part = (partb_g-parta)*alpha + parta*32 + ghalf;
-		clr |= (part/32) & gmask;
-
-		dst[ii]= clr;
-	}
-}
-
-
-//! Transform colors to grayscale.
-/*!
-	\param dst	Destination color array
-	\param src	Source color array.
-	\param nclrs	Number of colors.
-*/
-void clr_grayscale(COLOR *dst, const COLOR *src, uint nclrs)
-{
-	u32 ii;
-	u32 clr, gray, rr, gg, bb;
-
-	for(ii=0; ii<nclrs; ii++)
-	{
-		clr= *src++;
-
-		// Do RGB conversion in .8 fixed point
-		rr= ((clr    )&31)*0x4C;	// 29.7%
-		gg= ((clr>> 5)&31)*0x96;	// 58.6%
-		bb= ((clr>>10)&31)*0x1E;	// 11.7%
-		gray= (rr+gg+bb+0x80)>>8;
-
-		*dst++= RGB15(gray, gray, gray);
-	}
-}
-
-//! Transform colors to an rgb-scale.
-/*!	\a clr indicates a color vector in RGB-space. Each source color is 
-	converted to a brightness value (i.e., grayscale) and then mapped 
-	onto that color vector. A grayscale is a special case of this, 
-	using a color with R=G=B.
-	\param dst	Destination color array
-	\param src	Source color array.
-	\param nclrs	Number of colors.
-	\param clr	Destination color vector.
-*/
-void clr_rgbscale(COLOR *dst, const COLOR *src, uint nclrs, COLOR clr)
-{
-	uint ii;
-	u32 rr, gg, bb, scale, gray;
-
-	// Normalize target color
-	rr= (clr    )&31;
-	gg= (clr>> 5)&31;
-	bb= (clr>>10)&31;
-
-	scale= max(max(rr, gg), bb);
-	if(scale == 0)	// Can't scale to black : use gray instead
-	{
-		clr_grayscale(dst, src, nclrs);
-		return;
-	}
-
-	scale= lu_div(scale);
-	rr *= scale;		// rr, gg, bb -> 0.16f
-	gg *= scale;
-	bb *= scale;
-
-	for(ii=0; ii<nclrs; ii++)
-	{	
-		clr= *src++;
-
-		// Grayscaly in 5.8f
-		gray  = ((clr    )&31)*0x4C;	// 29.7%
-		gray += ((clr>> 5)&31)*0x96;	// 58.6%
-		gray += ((clr>>10)&31)*0x1E;	// 11.7%
-		
-		// Match onto color vector
-		dst[ii]= RGB15(rr*gray>>24, gg*gray>>24, bb*gray>>24);
-	}
-}
-
-
-//! Create a gradient between pal[first] and pal[last].
-/*!
-	\param pal		Palette to work on.
-	\param first	First index of gradient.
-	\param last		Last index of gradient.
-*/
-void pal_gradient(COLOR *pal, int first, int last)
-{
-	// Normalize
-	if(first > last)
-		SWAP(first, last);
-
-	// 2 entries means nothing to do
-	if(last-first < 2)
-		return;
-
-	int ii;
-	COLOR clra= pal[first], clrb= pal[last];
-
-	int r= (clra    )&31, dr= ((clrb    )&31) - r;
-	int g= (clra>> 5)&31, dg= ((clrb>> 5)&31) - g;
-	int b= (clra>>10)&31, db= ((clrb>>10)&31) - b;
-
-	// r,g,b will be .20 fixeds. Note rounding
-	const u32 SCALE= 1<<16;
-	r= r*SCALE + SCALE/2;	dr= (int)(dr*SCALE)/(last-first);
-	g= g*SCALE + SCALE/2;	dg= (int)(dg*SCALE)/(last-first);
-	b= b*SCALE + SCALE/2;	db= (int)(db*SCALE)/(last-first);
-
-	for(ii=first+1; ii<last; ii++)
-	{
-		r += dr;
-		g += dg;
-		b += db;
-
-		pal[ii]= RGB15(r/SCALE, g/SCALE, b/SCALE);
-	}
-}
-
-//! Create a gradient between pal[first] and pal[last].
-/*!
-	\param pal		Palette to work on.
-	\param first	First index of gradient.
-	\param last		Last index of gradient.
-	\param clr_first	Color of first index.
-	\param clr_last		Color of last index.
-*/
-void pal_gradient_ex(COLOR *pal, int first, int last, 
-	COLOR clr_first, COLOR clr_last)
-{
-	pal[first]= clr_first;
-	pal[last]= clr_last;
-	pal_gradient(pal, first, last);
-}
-
-
-// --------------------------------------------------------------------
-// Color adjustments
-// --------------------------------------------------------------------
-
-
-//! Adjust brightness by \a bright
-/*!	Operation: color= color+dB;
-	\param dst	Destination color array
-	\param src	Source color array.
-	\param nclrs	Number of colors.
-	\param bright	Brightness difference, dB (in .8f)
-	\note	Might be faster if preformed via lut.
-*/
-void clr_adj_brightness(COLOR *dst, const COLOR *src, uint nclrs, FIXED bright)
-{
-	u32 ii, clr;
-	int rr, gg, bb;
-
-	bright >>= 3;
-	for(ii=0; ii<nclrs; ii++)
-	{
-		clr= src[ii];
-
-		rr= ((clr    )&31) + bright;
-		gg= ((clr>>5 )&31) + bright;
-		bb= ((clr>>10)&31) + bright;
-
-		dst[ii]= RGB15(bf_clamp(rr,5), bf_clamp(gg,5), bf_clamp(bb,5));
-	}
-}
-
-
-//! Adjust contrast by \a contrast
-/*!	Operation: color = color*(1+dC) - MAX*dC/2
-	\param dst	Destination color array
-	\param src	Source color array.
-	\param nclrs	Number of colors.
-	\param contrast	Contrast differencem dC (in .8f)
-	\note	Might be faster if preformed via lut.
-*/
-void clr_adj_contrast(COLOR *dst, const COLOR *src, uint nclrs, FIXED contrast)
-{
-	u32 ii, clr;
-	int rr, gg, bb;
-	FIXED ca= contrast+FIX_ONE, cb= (-contrast>>1)*32;
-
-	for(ii=0; ii<nclrs; ii++)
-	{
-		clr= src[ii];
-
-		rr= ca*((clr    )&31) + cb;
-		gg= ca*((clr>>5 )&31) + cb;
-		bb= ca*((clr>>10)&31) + cb;
-
-		// Shift here, because it'd be unsigned-shift otherwise
-		dst[ii]= RGB15(bf_clamp(rr>>8,5), bf_clamp(gg>>8,5), bf_clamp(bb>>8,5));
-	}
-}
-
-//! Adjust intensity by \a intensity. 
-/*!	Operation: color = (1+dI)*color.
-	\param dst	Destination color array
-	\param src	Source color array.
-	\param nclrs	Number of colors.
-	\param intensity	Intensity difference, dI (in .8f)
-	\note	Might be faster if preformed via lut.
-*/
-void clr_adj_intensity(COLOR *dst, const COLOR *src, uint nclrs, FIXED intensity)
-{
-	u32 ii, clr;
-	int rr, gg, bb;
-	FIXED ia= intensity+FIX_ONE;
-
-	for(ii=0; ii<nclrs; ii++)
-	{
-		clr= *src++;
-
-		rr= ia*((clr    )&31);
-		gg= ia*((clr>>5 )&31);
-		bb= ia*((clr>>10)&31);
-
-		// Shift here, because it'd be unsigned-shift otherwise
-		*dst++= RGB15(bf_clamp(rr>>8,5), bf_clamp(gg>>8,5), bf_clamp(bb>>8,5));
-	}
-}
-
-
-// EOF
+//
+//  Some interesting color routines
+//
+//! \file tonc_color.c
+//! \author J Vijn
+//! \date 20070823 - 20070907
+//
+// === NOTES ===
+
+#include "tonc_memmap.hpp"
+#include "tonc_video.hpp"
+#include "tonc_bios.hpp"
+#include "tonc_math.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS 
+// --------------------------------------------------------------------
+
+
+//! Rotate \a nclrs colors at \a clrs to the right by \a ror.
+/*!	\note I can't help but think there's a faster way ... I just can't 
+		see it atm.
+*/
+void clr_rotate(COLOR *clrs, uint nclrs, int ror)
+{
+	if(ror == 0)		// Nothing to do
+		return;
+
+	uint ii;
+	uint jj;
+	uint rot;
+	u32 tmp;
+
+	// NOTE: 
+	// Yes, this is O(n^2)
+	// Two optimisations are possible for |ror|>1
+	// 1) Extra buffer (simply write at an offset) O(n)
+	// 2) Double loops (ror and nclrs/ror) steps), run recursively 
+	//	  with nclrs=nclrs-nclrs%ror, ror=nclrs-nclrs%ror. O(n)*log(n) ?
+
+	if(ror > 0)			// Rotate right
+	{
+		rot= ror;
+		if(rot > nclrs)
+			rot= Mod(rot, nclrs);
+		for(ii=0; ii<rot; ii++)
+		{
+			tmp= clrs[nclrs-1];
+			for(jj=nclrs-1; jj>0; jj--)
+				clrs[jj]= clrs[jj-1];
+			clrs[0]= tmp;
+		}	
+	}
+	else				// Rotate left
+	{
+		rot= nclrs-ror;
+		if(rot > nclrs)
+			rot= Mod(rot, nclrs);
+		for(ii=0; ii<rot; ii++)
+		{
+			tmp= clrs[0];
+			for(jj=0; jj<nclrs-1; jj++)
+				clrs[jj]= clrs[jj+1];
+			clrs[nclrs-1]= tmp;
+		}
+	}	
+}
+
+
+//!	Blends color arrays \a srca and \a srcb into \a dst.
+/*!	Specific transitional blending effects can be created by making 
+	a 'target' color array with other routines, then using \a alpha 
+	to morph into it.
+	\param srca	Source array A.
+	\param srcb	Source array B
+	\param dst	Destination array.
+	\param nclrs	Number of colors.
+	\param alpha	Blend weight (range: 0-32). 0 Means full \a srca
+*/
+void clr_blend(const COLOR *srca, const COLOR *srcb, COLOR *dst, 
+		uint nclrs, u32 alpha)
+{
+	if(!nclrs)
+		return;
+
+	uint ii;
+	u32 clra, clrb, clr;
+	u32 parta, partb, part;
+	const u32 rbmask= (RED_MASK|BLUE_MASK), gmask= GREEN_MASK;
+	const u32 rbhalf= 0x4010, ghalf= 0x0200;
+
+	for(ii=0; ii<nclrs; ii++)
+	{
+		clra= srca[ii];
+		clrb= srcb[ii];
+		
+		// Red and blue
+		parta= clra & rbmask;
+		partb= clrb & rbmask;
+		part = (partb-parta)*alpha + parta*32 + rbhalf;
+		clr  = (part/32 ) & rbmask;
+
+		// Green
+		parta= clra & gmask;
+		partb= clrb & gmask;
+		part = (partb-parta)*alpha + parta*32 + ghalf;
+		clr |= (part/32 ) & gmask;
+
+		dst[ii]= clr;
+	}
+}
+
+//!	Fades color arrays \a srca to \a clr into \a dst.
+/*!
+	\param src	Source array.
+	\param clr	Final color (at alpha=32).
+	\param dst	Destination array.
+	\param nclrs	Number of colors.
+	\param alpha	Blend weight (range: 0-32). 0 Means full \a srca
+*/
+void clr_fade(const COLOR *src, COLOR clr, COLOR *dst, 
+		uint nclrs, u32 alpha)
+{
+	if(!nclrs)
+		return;
+
+	uint ii;
+	u32 clra, parta, part;
+	const u32 rbmask= (RED_MASK|BLUE_MASK), gmask= GREEN_MASK;
+	const u32 rbhalf= 0x4010, ghalf= 0x0200;
+
+	// precalc color B parts
+	u32 partb_rb= clr & rbmask, partb_g= clr & gmask;
+
+	for(ii=0; ii<nclrs; ii++)
+	{
+		clra= src[ii];
+
+		// Red and blue
+		parta= clra & rbmask;
+		part = (partb_rb-parta)*alpha + parta*32 + rbhalf;
+		clr  = (part/32) & rbmask;
+
+		// Green
+		parta= clra & gmask;
+		part = (partb_g-parta)*alpha + parta*32 + ghalf;
+		clr |= (part/32) & gmask;
+
+		dst[ii]= clr;
+	}
+}
+
+
+//! Transform colors to grayscale.
+/*!
+	\param dst	Destination color array
+	\param src	Source color array.
+	\param nclrs	Number of colors.
+*/
+void clr_grayscale(COLOR *dst, const COLOR *src, uint nclrs)
+{
+	u32 ii;
+	u32 clr, gray, rr, gg, bb;
+
+	for(ii=0; ii<nclrs; ii++)
+	{
+		clr= *src++;
+
+		// Do RGB conversion in .8 fixed point
+		rr= ((clr    )&31)*0x4C;	// 29.7%
+		gg= ((clr>> 5)&31)*0x96;	// 58.6%
+		bb= ((clr>>10)&31)*0x1E;	// 11.7%
+		gray= (rr+gg+bb+0x80)>>8;
+
+		*dst++= RGB15(gray, gray, gray);
+	}
+}
+
+//! Transform colors to an rgb-scale.
+/*!	\a clr indicates a color vector in RGB-space. Each source color is 
+	converted to a brightness value (i.e., grayscale) and then mapped 
+	onto that color vector. A grayscale is a special case of this, 
+	using a color with R=G=B.
+	\param dst	Destination color array
+	\param src	Source color array.
+	\param nclrs	Number of colors.
+	\param clr	Destination color vector.
+*/
+void clr_rgbscale(COLOR *dst, const COLOR *src, uint nclrs, COLOR clr)
+{
+	uint ii;
+	u32 rr, gg, bb, scale, gray;
+
+	// Normalize target color
+	rr= (clr    )&31;
+	gg= (clr>> 5)&31;
+	bb= (clr>>10)&31;
+
+	scale= max(max(rr, gg), bb);
+	if(scale == 0)	// Can't scale to black : use gray instead
+	{
+		clr_grayscale(dst, src, nclrs);
+		return;
+	}
+
+	scale= lu_div(scale);
+	rr *= scale;		// rr, gg, bb -> 0.16f
+	gg *= scale;
+	bb *= scale;
+
+	for(ii=0; ii<nclrs; ii++)
+	{	
+		clr= *src++;
+
+		// Grayscaly in 5.8f
+		gray  = ((clr    )&31)*0x4C;	// 29.7%
+		gray += ((clr>> 5)&31)*0x96;	// 58.6%
+		gray += ((clr>>10)&31)*0x1E;	// 11.7%
+		
+		// Match onto color vector
+		dst[ii]= RGB15(rr*gray>>24, gg*gray>>24, bb*gray>>24);
+	}
+}
+
+
+//! Create a gradient between pal[first] and pal[last].
+/*!
+	\param pal		Palette to work on.
+	\param first	First index of gradient.
+	\param last		Last index of gradient.
+*/
+void pal_gradient(COLOR *pal, int first, int last)
+{
+	// Normalize
+	if(first > last)
+		SWAP(first, last);
+
+	// 2 entries means nothing to do
+	if(last-first < 2)
+		return;
+
+	int ii;
+	COLOR clra= pal[first], clrb= pal[last];
+
+	int r= (clra    )&31, dr= ((clrb    )&31) - r;
+	int g= (clra>> 5)&31, dg= ((clrb>> 5)&31) - g;
+	int b= (clra>>10)&31, db= ((clrb>>10)&31) - b;
+
+	// r,g,b will be .20 fixeds. Note rounding
+	const u32 SCALE= 1<<16;
+	r= r*SCALE + SCALE/2;	dr= (int)(dr*SCALE)/(last-first);
+	g= g*SCALE + SCALE/2;	dg= (int)(dg*SCALE)/(last-first);
+	b= b*SCALE + SCALE/2;	db= (int)(db*SCALE)/(last-first);
+
+	for(ii=first+1; ii<last; ii++)
+	{
+		r += dr;
+		g += dg;
+		b += db;
+
+		pal[ii]= RGB15(r/SCALE, g/SCALE, b/SCALE);
+	}
+}
+
+//! Create a gradient between pal[first] and pal[last].
+/*!
+	\param pal		Palette to work on.
+	\param first	First index of gradient.
+	\param last		Last index of gradient.
+	\param clr_first	Color of first index.
+	\param clr_last		Color of last index.
+*/
+void pal_gradient_ex(COLOR *pal, int first, int last, 
+	COLOR clr_first, COLOR clr_last)
+{
+	pal[first]= clr_first;
+	pal[last]= clr_last;
+	pal_gradient(pal, first, last);
+}
+
+
+// --------------------------------------------------------------------
+// Color adjustments
+// --------------------------------------------------------------------
+
+
+//! Adjust brightness by \a bright
+/*!	Operation: color= color+dB;
+	\param dst	Destination color array
+	\param src	Source color array.
+	\param nclrs	Number of colors.
+	\param bright	Brightness difference, dB (in .8f)
+	\note	Might be faster if preformed via lut.
+*/
+void clr_adj_brightness(COLOR *dst, const COLOR *src, uint nclrs, FIXED bright)
+{
+	u32 ii, clr;
+	int rr, gg, bb;
+
+	bright >>= 3;
+	for(ii=0; ii<nclrs; ii++)
+	{
+		clr= src[ii];
+
+		rr= ((clr    )&31) + bright;
+		gg= ((clr>>5 )&31) + bright;
+		bb= ((clr>>10)&31) + bright;
+
+		dst[ii]= RGB15(bf_clamp(rr,5), bf_clamp(gg,5), bf_clamp(bb,5));
+	}
+}
+
+
+//! Adjust contrast by \a contrast
+/*!	Operation: color = color*(1+dC) - MAX*dC/2
+	\param dst	Destination color array
+	\param src	Source color array.
+	\param nclrs	Number of colors.
+	\param contrast	Contrast differencem dC (in .8f)
+	\note	Might be faster if preformed via lut.
+*/
+void clr_adj_contrast(COLOR *dst, const COLOR *src, uint nclrs, FIXED contrast)
+{
+	u32 ii, clr;
+	int rr, gg, bb;
+	FIXED ca= contrast+FIX_ONE, cb= (-contrast>>1)*32;
+
+	for(ii=0; ii<nclrs; ii++)
+	{
+		clr= src[ii];
+
+		rr= ca*((clr    )&31) + cb;
+		gg= ca*((clr>>5 )&31) + cb;
+		bb= ca*((clr>>10)&31) + cb;
+
+		// Shift here, because it'd be unsigned-shift otherwise
+		dst[ii]= RGB15(bf_clamp(rr>>8,5), bf_clamp(gg>>8,5), bf_clamp(bb>>8,5));
+	}
+}
+
+//! Adjust intensity by \a intensity. 
+/*!	Operation: color = (1+dI)*color.
+	\param dst	Destination color array
+	\param src	Source color array.
+	\param nclrs	Number of colors.
+	\param intensity	Intensity difference, dI (in .8f)
+	\note	Might be faster if preformed via lut.
+*/
+void clr_adj_intensity(COLOR *dst, const COLOR *src, uint nclrs, FIXED intensity)
+{
+	u32 ii, clr;
+	int rr, gg, bb;
+	FIXED ia= intensity+FIX_ONE;
+
+	for(ii=0; ii<nclrs; ii++)
+	{
+		clr= *src++;
+
+		rr= ia*((clr    )&31);
+		gg= ia*((clr>>5 )&31);
+		bb= ia*((clr>>10)&31);
+
+		// Shift here, because it'd be unsigned-shift otherwise
+		*dst++= RGB15(bf_clamp(rr>>8,5), bf_clamp(gg>>8,5), bf_clamp(bb>>8,5));
+	}
+}
+
+//! Adjust colors through a component look-up table.
+/*!	Operation: color = lut[color], for each component.
+	Any of the adjustments above can be baked into a table, at
+	compile time with lut_brightness(), lut_contrast() or lut_gamma()
+	from tonc_lut.hpp, or at runtime. Multiple adjustments can be
+	chained into the same table.
+	\param dst	Destination color array
+	\param src	Source color array.
+	\param nclrs	Number of colors.
+	\param lut	32-entry table for 5bit components.
+*/
+void clr_adj_lut(COLOR *dst, const COLOR *src, uint nclrs, const u8 lut[32])
+{
+	u32 ii, clr;
+
+	for(ii=0; ii<nclrs; ii++)
+	{
+		clr= src[ii];
+		dst[ii]= RGB15(lut[clr&31], lut[(clr>>5)&31], lut[(clr>>10)&31]);
+	}
+}
+
+
+
+// --------------------------------------------------------------------
+// Color spaces
+// --------------------------------------------------------------------
+
+
+//! Convert a 15bit color to HSV.
+/*!	Hue is in the usual tonc angle units (0x10000 for a full circle,
+	0 = red, 0x5555 = green, 0xAAAA = blue); saturation and value
+	are 0-255. Divisions are done with div_lut.
+	\note	Grays have hue 0.
+*/
+HSV clr_to_hsv(COLOR clr)
+{
+	int rr= clr&31, gg= clr>>5&31, bb= clr>>10&31;
+	int max, min, delta, hue;
+	HSV hsv;
+
+	max= rr > gg ? rr : gg;		max= max > bb ? max : bb;
+	min= rr < gg ? rr : gg;		min= min < bb ? min : bb;
+	delta= max-min;
+
+	hsv.v= max*255/31;
+	if(delta == 0)
+	{
+		hsv.h= 0;
+		hsv.s= 0;
+		return hsv;
+	}
+	hsv.s= (delta*255*div_lut[max] + 0x8000)>>16;
+
+	// Sector start plus (diff/delta)/6 of a circle
+	if(max == rr)
+		hue= 0x0000 + (((gg-bb)*div_lut[delta]*0x2AAB + 0x8000)>>16);
+	else if(max == gg)
+		hue= 0x5555 + (((bb-rr)*div_lut[delta]*0x2AAB + 0x8000)>>16);
+	else
+		hue= 0xAAAB + (((rr-gg)*div_lut[delta]*0x2AAB + 0x8000)>>16);
+
+	hsv.h= hue;
+	return hsv;
+}
+
+//! Convert an HSV color to 15bit RGB.
+/*!	\sa clr_to_hsv() for the ranges.
+*/
+COLOR hsv_to_clr(HSV hsv)
+{
+	int max= (hsv.v*31 + 127)/255;
+	int delta= (hsv.s*max + 127)/255;
+	int min= max-delta;
+
+	u32 h6= hsv.h*6;
+	int ofs= (delta*(h6&0xFFFF) + 0x8000)>>16;
+	int rise= min+ofs, fall= max-ofs;
+
+	switch(h6>>16)
+	{
+	case 0:		return RGB15(max,  rise, min );
+	case 1:		return RGB15(fall, max,  min );
+	case 2:		return RGB15(min,  max,  rise);
+	case 3:		return RGB15(min,  fall, max );
+	case 4:		return RGB15(rise, min,  max );
+	default:	return RGB15(max,  min,  fall);
+	}
+}
+
+//! Convert a 15bit color to full-range YCbCr (JFIF).
+/*!	All components are 0-255; Cb and Cr are centered on 128.
+*/
+YCC clr_to_ycc(COLOR clr)
+{
+	// Expand to 8bit components
+	int rr= clr&31, gg= clr>>5&31, bb= clr>>10&31;
+	rr= rr<<3 | rr>>2;
+	gg= gg<<3 | gg>>2;
+	bb= bb<<3 | bb>>2;
+
+	// Cb/Cr can hit 256 for pure blue/red; hence the clamps.
+	YCC ycc;
+	ycc.y = (  77*rr + 150*gg +  29*bb + 128)>>8;
+	ycc.cb= clamp(( -43*rr -  85*gg + 128*bb + 128 + (128<<8))>>8, 0, 256);
+	ycc.cr= clamp(( 128*rr - 107*gg -  21*bb + 128 + (128<<8))>>8, 0, 256);
+	ycc.pad= 0;
+	return ycc;
+}
+
+//! Convert a full-range YCbCr color to 15bit RGB.
+COLOR ycc_to_clr(YCC ycc)
+{
+	int yy= ycc.y<<8, cb= ycc.cb-128, cr= ycc.cr-128;
+	int rr, gg, bb;
+
+	rr= (yy           + 359*cr + 128)>>8;
+	gg= (yy -  88*cb  - 183*cr + 128)>>8;
+	bb= (yy + 454*cb           + 128)>>8;
+
+	rr= clamp(rr, 0, 256);
+	gg= clamp(gg, 0, 256);
+	bb= clamp(bb, 0, 256);
+
+	return RGB15((rr*31+127)/255, (gg*31+127)/255, (bb*31+127)/255);
+}
+
+//! Convert \a nclrs colors to HSV.
+void pal_to_hsv(HSV *dst, const COLOR *src, uint nclrs)
+{
+	uint ii;
+	for(ii=0; ii<nclrs; ii++)
+		dst[ii]= clr_to_hsv(src[ii]);
+}
+
+//! Convert \a nclrs HSV colors back to 15bit colors.
+void pal_from_hsv(COLOR *dst, const HSV *src, uint nclrs)
+{
+	uint ii;
+	for(ii=0; ii<nclrs; ii++)
+		dst[ii]= hsv_to_clr(src[ii]);
+}
+
+//! Convert \a nclrs colors to YCbCr.
+void pal_to_ycc(YCC *dst, const COLOR *src, uint nclrs)
+{
+	uint ii;
+	for(ii=0; ii<nclrs; ii++)
+		dst[ii]= clr_to_ycc(src[ii]);
+}
+
+//! Convert \a nclrs YCbCr colors back to 15bit colors.
+void pal_from_ycc(COLOR *dst, const YCC *src, uint nclrs)
+{
+	uint ii;
+	for(ii=0; ii<nclrs; ii++)
+		dst[ii]= ycc_to_clr(src[ii]);
+}
+
+//! Rotate the hue of \a nclrs colors by \a dhue.
+/*!	\param dst	Destination color array
+	\param src	Source color array.
+	\param nclrs	Number of colors.
+	\param dhue	Hue difference (0x10000 for a full circle).
+	\note	For hue cycling over time, convert the palette to HSV once
+		with pal_to_hsv() and work from that, so that rounding
+		errors don't add up.
+*/
+void clr_adj_hue(COLOR *dst, const COLOR *src, uint nclrs, int dhue)
+{
+	uint ii;
+	HSV hsv;
+
+	for(ii=0; ii<nclrs; ii++)
+	{
+		hsv= clr_to_hsv(src[ii]);
+		hsv.h += dhue;
+		dst[ii]= hsv_to_clr(hsv);
+	}
+}
+
+//! Adjust saturation by \a sat.
+/*!	Operation: saturation = saturation*(1+dS).
+	\param dst	Destination color array
+	\param src	Source color array.
+	\param nclrs	Number of colors.
+	\param sat	Saturation difference, dS (in .8f)
+*/
+void clr_adj_saturation(COLOR *dst, const COLOR *src, uint nclrs, FIXED sat)
+{
+	uint ii;
+	int ss;
+	FIXED sa= sat+FIX_ONE;
+	HSV hsv;
+
+	for(ii=0; ii<nclrs; ii++)
+	{
+		hsv= clr_to_hsv(src[ii]);
+		ss= (hsv.s*sa)>>8;
+		hsv.s= clamp(ss, 0, 256);
+		dst[ii]= hsv_to_clr(hsv);
+	}
+}
+
+
+// EOF
@@ -0,0 +1,165 @@
+//
+//  Scanline compositor for bitmap modes
+//
+//! \file tonc_compose.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Layers are clipped per line to the destination width; a layer
+	only costs anything on the lines it's on.
+  * The line is copied out by words, so the destination pitch and
+	line size should be multiples of 4. That's true for all the
+	bitmap modes.
+*/
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+#include "tonc_math.hpp"
+#include "tonc_compose.hpp"
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+//! Line buffer; big enough for a 16bpp line.
+IWRAM_DATA static u32 __cmp_line[CMP_WIDTH_MAX/2];
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Initialize a compositor.
+/*!	\param cmp	Compositor.
+	\param dst	Destination surface; bmp16 or bmp8, at most
+		CMP_WIDTH_MAX wide.
+	\param clear	Color (or index) for parts without a layer.
+*/
+void cmp_init(TCompositor *cmp, const TSurface *dst, u32 clear)
+{
+	cmp->dst= dst;
+	cmp->clear= clear;
+	cmp->count= 0;
+}
+
+//! Add a layer on top of the others.
+/*!	\param cmp	Compositor.
+	\param srf	Layer image, with the same bpp as the destination.
+	\param x	Position x.
+	\param y	Position y.
+	\param flags	CMP_xxx flags. The key is 0 and alpha 16 to start
+		with; change them via cmp_layer().
+	\return	Layer id, or -1 if there's no room.
+*/
+int cmp_add(TCompositor *cmp, const TSurface *srf, int x, int y, u32 flags)
+{
+	if(cmp->count >= CMP_LAYERS)
+		return -1;
+
+	TCompLayer *cl= &cmp->layers[cmp->count];
+	cl->srf= srf;
+	cl->x= x;
+	cl->y= y;
+	cl->flags= flags;
+	cl->key= 0;
+	cl->alpha= 16;
+
+	return cmp->count++;
+}
+
+//! Check if layer \a cl hides everything below it on line \a y.
+INLINE bool cmp_covers(const TCompLayer *cl, int y, int width)
+{
+	return !(cl->flags & (CMP_HIDE|CMP_KEY|CMP_BLEND)) &&
+		(uint)(y - cl->y) < cl->srf->height &&
+		cl->x <= 0 && cl->x + cl->srf->width >= width;
+}
+
+//! Compose all lines.
+void cmp_render(TCompositor *cmp)
+{
+	cmp_render_lines(cmp, 0, cmp->dst->height);
+}
+
+//! Compose lines [\a top, \a bottom).
+/*!	Handy for racing the beam: do the top half after VCount 80, the
+	bottom half in VBlank.
+*/
+void cmp_render_lines(TCompositor *cmp, int top, int bottom)
+{
+	const TSurface *dst= cmp->dst;
+	const TCompLayer *cl;
+	int width= min(dst->width, CMP_WIDTH_MAX);
+	uint bpp16= dst->bpp == 16;
+	uint lineSize= bpp16 ? width*2 : width;
+	u32 fill= bpp16 ? dup16(cmp->clear) : quad8(cmp->clear);
+	int iy, ii, first, x0, x1;
+
+	top= max(top, 0);
+	bottom= min(bottom, dst->height);
+
+	for(iy=top; iy<bottom; iy++)
+	{
+		// Start from the topmost layer that covers the whole line.
+		for(first=cmp->count-1; first >= 0; first--)
+			if(cmp_covers(&cmp->layers[first], iy, width))
+				break;
+
+		if(first < 0)
+		{
+			memset32(__cmp_line, fill, (lineSize+3)/4);
+			first= 0;
+		}
+
+		for(ii=first; ii<(int)cmp->count; ii++)
+		{
+			cl= &cmp->layers[ii];
+			if(cl->flags & CMP_HIDE)
+				continue;
+
+			const TSurface *srf= cl->srf;
+			uint sy= iy - cl->y;
+			if(sy >= srf->height)
+				continue;
+
+			x0= max(cl->x, 0);
+			x1= min(cl->x + srf->width, width);
+			if(x0 >= x1)
+				continue;
+
+			u32 key= (cl->flags & CMP_KEY) ? cl->key : 0xFFFFFFFF;
+			const u8 *src= &srf->data[sy*srf->pitch];
+
+			if(bpp16)
+			{
+				u16 *line= &((u16*)__cmp_line)[x0];
+				src += (x0 - cl->x)*2;
+
+				if(cl->flags & CMP_BLEND)
+					cmp_span16_blend(line, (const u16*)src, x1-x0, key, cl->alpha);
+				else if(cl->flags & CMP_KEY)
+					cmp_span16_key(line, (const u16*)src, x1-x0, key);
+				else
+					memcpy16(line, src, x1-x0);
+			}
+			else
+			{
+				u8 *line= &((u8*)__cmp_line)[x0];
+				src += x0 - cl->x;
+
+				if(cl->flags & CMP_KEY)
+					cmp_span8_key(line, src, x1-x0, key);
+				else
+					tonccpy(line, src, x1-x0);
+			}
+		}
+
+		memcpy32(&dst->data[iy*dst->pitch], __cmp_line, lineSize/4);
+	}
+}
+
+// EOF
@@ -1,237 +1,401 @@
-//
-//  Core stuff: keys, interrupts and misc
-//
-//! \file tonc_core.c
-//! \author J Vijn
-//! \date 20060508 - 20060508
-//
-// === NOTES ===
-
-#include "tonc_memmap.hpp"
-#include "tonc_core.hpp"
-
-
-// --------------------------------------------------------------------
-// CONSTANTS
-// --------------------------------------------------------------------
-
-
-const u8 oam_sizes[3][4][2]=
-{
-	{ { 8, 8}, {16,16}, {32,32}, {64,64} }, 
-	{ {16, 8}, {32, 8}, {32,16}, {64,32} },
-	{ { 8,16}, { 8,32}, {16,32}, {32,64} },
-};
-
-const BG_AFFINE bg_aff_default= { 256, 0, 0, 256, 0, 0 };
-
-const uint __snd_rates[12]=
-{
-	8013, 7566, 7144, 6742, // C , C#, D , D#
-	6362, 6005, 5666, 5346, // E , F , F#, G
-	5048, 4766, 4499, 4246  // G#, A , A#, B
-};
-
-
-// --------------------------------------------------------------------
-// GLOBALS 
-// --------------------------------------------------------------------
-
-
-int __qran_seed= 42;
-COLOR *vid_page= vid_mem_back;
-
-
-// --------------------------------------------------------------------
-// FUNCTIONS 
-// --------------------------------------------------------------------
-
-
-// --- data -----------------------------------------------------------
-
-//! VRAM-safe cpy.
-/*!	This version mimics memcpy in functionality, with 
-	the benefit of working for VRAM as well. It is also 
-	slightly faster than the original memcpy, but faster 
-	implementations can be made.
-	\param dst	Destination pointer.
-	\param src	Source pointer.
-	\param size	Fill-length in bytes.
-	\return		\a dst.
-	\note	The pointers and size need not be word-aligned.
-*/
-void *tonccpy(void *dst, const void *src, uint size)
-{
-	if(size == 0 || dst==NULL || src==NULL)
-		return dst;
-
-	uint count;
-	u16 *dst16;		// hword destination
-	u8  *src8;		// byte source
-
-	// Ideal case: copy by 4x words. Leaves tail for later.
-	if( ((u32)src|(u32)dst)%4==0 && size>=4)
-	{
-		u32 *src32= (u32*)src, *dst32= (u32*)dst;
-
-		count= size/4;
-		uint tmp= count&3;
-		count /= 4;
-
-		// Duff, bitch!
-		switch(tmp) {
-			do {	*dst32++ = *src32++;
-		case 3:		*dst32++ = *src32++;
-		case 2:		*dst32++ = *src32++;
-		case 1:		*dst32++ = *src32++;
-		case 0:		; }	while(count--);
-		}
-
-		// Check for tail
-		size &= 3;
-		if(size == 0)
-			return dst;
-
-		src8= (u8*)src32;
-		dst16= (u16*)dst32;
-	}
-	else		// Unaligned.
-	{
-		uint dstOfs= (u32)dst&1;
-		src8= (u8*)src;
-		dst16= (u16*)(dst-dstOfs);
-
-		// Head: 1 byte.
-		if(dstOfs != 0)
-		{
-			*dst16= (*dst16 & 0xFF) | *src8++<<8;
-			dst16++;
-			if(--size==0)
-				return dst;
-		}
-	}
-
-	// Unaligned main: copy by 2x byte.
-	count= size/2;
-	while(count--)
-	{
-		*dst16++ = src8[0] | src8[1]<<8;
-		src8 += 2;
-	}
-
-	// Tail: 1 byte.
-	if(size&1)
-		*dst16= (*dst16 &~ 0xFF) | *src8;
-
-	return dst;
-}
-
-//! VRAM-safe memset, internal routine.
-/*!	This version mimics memset in functionality, with 
-	the benefit of working for VRAM as well. It is also 
-	slightly faster than the original memset.
-	\param dst	Destination pointer.
-	\param fill	Word to fill with.
-	\param size	Fill-length in bytes.
-	\return		\a dst.
-	\note	The \a dst pointer and \a size need not be 
-		word-aligned. In the case of unaligned fills, \a fill 
-		will be masked off to match the situation.
-*/
-void *__toncset(void *dst, u32 fill, uint size)
-{
-	if(dst==NULL || size==0)
-		return dst;
-
-	uint left= (u32)dst&3;
-	u32 *dst32= (u32*)(dst-left);
-	u32 count, mask;
-
-	// Unaligned head.
-	if(left != 0)
-	{
-		// Adjust for very small stint.
-		if(left+size<4)
-		{
-			mask= BIT_MASK(size*8)<<(left*8);	
-			*dst32= (*dst32 &~ mask) | (fill & mask);
-			return dst;
-		}
-
-		mask= BIT_MASK(left*8);
-		*dst32= (*dst32 & mask) | (fill&~mask);
-		dst32++;
-		size -= 4-left;
-	}
-
-	// Main stint.
-	count= size/4;
-	uint tmp= count&3;
-	count /= 4;
-
-	switch(tmp) {
-		do {	*dst32++ = fill;
-	case 3:		*dst32++ = fill;
-	case 2:		*dst32++ = fill;
-	case 1:		*dst32++ = fill;
-	case 0:		; }	while(count--);
-	}
-
-	// Tail
-	size &= 3;
-	if(size)
-	{
-		mask= BIT_MASK(size*8);
-		*dst32= (*dst32 &~ mask) | (fill & mask);
-	}
-
-	return dst;
-}
-
-
-// --- random numbers -------------------------------------------------
-
-int sqran(int seed)
-{	
-	int old= __qran_seed;
-	__qran_seed= seed; 
-	return old;	
-}
-
-// --- misc -----------------------------------------------------------
-
-//! Get the octant that (\a x, \a y) is in.
-/*!	This function divides the circle in 8 parts. The angle 
-	starts at the \a y=0 line and then moves in the direction
-	of the \a x=0 line. On the screen, this would be like
-	starting at the 3 o'clock position and moving clockwise 
-*/
-u32 octant(int x, int y)
-{
-    u32 oct=0;
-    if(y<0) { oct ^= 7; y=-y; }
-    if(x<0) { oct ^= 3; x=-x; }
-    if(x<y) { oct ^= 1; }
-    return oct;
-}
-
-//! Get the rotated octant that (\a x, \a y) is in.
-/*!	Like \c octant() but with a twist. The 0-octant starts 
-	22.5� earlier so that 3 o'clock falls in the middle of 
-	octant 0, instead of at its start. This can be useful for 
-	8 directional pointing.
-*/
-u32 octant_rot(int x0, int y0)
-{
-	//rotate by pi/8: (.9: sin: 195.9; cos 473.0)
-	int x= 473*x0 - 196*y0;
-	int y= 196*x0 + 473*y0;
-
-    u32 oct=0;
-    if(y<0) { oct ^= 7; y=-y; }
-    if(x<0) { oct ^= 3; x=-x; }
-    if(x<y) { oct ^= 1; }
-    return oct;
-}
-
-//	EOF
+//
+//  Core stuff: keys, interrupts and misc
+//
+//! \file tonc_core.c
+//! \author J Vijn
+//! \date 20060508 - 20060508
+//
+// === NOTES ===
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+#include "tonc_bios.hpp"
+
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+const u8 oam_sizes[3][4][2]=
+{
+	{ { 8, 8}, {16,16}, {32,32}, {64,64} }, 
+	{ {16, 8}, {32, 8}, {32,16}, {64,32} },
+	{ { 8,16}, { 8,32}, {16,32}, {32,64} },
+};
+
+const BG_AFFINE bg_aff_default= { 256, 0, 0, 256, 0, 0 };
+
+const uint __snd_rates[12]=
+{
+	8013, 7566, 7144, 6742, // C , C#, D , D#
+	6362, 6005, 5666, 5346, // E , F , F#, G
+	5048, 4766, 4499, 4246  // G#, A , A#, B
+};
+
+
+// --------------------------------------------------------------------
+// GLOBALS 
+// --------------------------------------------------------------------
+
+
+int __qran_seed= 42;
+COLOR *vid_page= vid_mem_back;
+
+//! Lookup table for bup_unpack(), and what it was built for.
+IWRAM_DATA static u32 __bup_lut[256];
+static u32 __bup_fmt= 0, __bup_ofs= 0;
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS 
+// --------------------------------------------------------------------
+
+
+// --- data -----------------------------------------------------------
+
+//! VRAM-safe cpy.
+/*!	This version mimics memcpy in functionality, with 
+	the benefit of working for VRAM as well. It is also 
+	slightly faster than the original memcpy, but faster 
+	implementations can be made.
+	\param dst	Destination pointer.
+	\param src	Source pointer.
+	\param size	Fill-length in bytes.
+	\return		\a dst.
+	\note	The pointers and size need not be word-aligned.
+*/
+void *tonccpy(void *dst, const void *src, uint size)
+{
+	if(size == 0 || dst==NULL || src==NULL)
+		return dst;
+
+	uint count;
+	u16 *dst16;		// hword destination
+	u8  *src8;		// byte source
+
+	// Ideal case: copy by 4x words. Leaves tail for later.
+	if( ((u32)src|(u32)dst)%4==0 && size>=4)
+	{
+		u32 *src32= (u32*)src, *dst32= (u32*)dst;
+
+		count= size/4;
+		uint tmp= count&3;
+		count /= 4;
+
+		// Duff, bitch!
+		switch(tmp) {
+			do {	*dst32++ = *src32++;
+		case 3:		*dst32++ = *src32++;
+		case 2:		*dst32++ = *src32++;
+		case 1:		*dst32++ = *src32++;
+		case 0:		; }	while(count--);
+		}
+
+		// Check for tail
+		size &= 3;
+		if(size == 0)
+			return dst;
+
+		src8= (u8*)src32;
+		dst16= (u16*)dst32;
+	}
+	else		// Unaligned.
+	{
+		uint dstOfs= (u32)dst&1;
+		src8= (u8*)src;
+		dst16= (u16*)(dst-dstOfs);
+
+		// Head: 1 byte.
+		if(dstOfs != 0)
+		{
+			*dst16= (*dst16 & 0xFF) | *src8++<<8;
+			dst16++;
+			if(--size==0)
+				return dst;
+		}
+	}
+
+	// Unaligned main: copy by 2x byte.
+	count= size/2;
+	while(count--)
+	{
+		*dst16++ = src8[0] | src8[1]<<8;
+		src8 += 2;
+	}
+
+	// Tail: 1 byte.
+	if(size&1)
+		*dst16= (*dst16 &~ 0xFF) | *src8;
+
+	return dst;
+}
+
+//! VRAM-safe memset, internal routine.
+/*!	This version mimics memset in functionality, with 
+	the benefit of working for VRAM as well. It is also 
+	slightly faster than the original memset.
+	\param dst	Destination pointer.
+	\param fill	Word to fill with.
+	\param size	Fill-length in bytes.
+	\return		\a dst.
+	\note	The \a dst pointer and \a size need not be 
+		word-aligned. In the case of unaligned fills, \a fill 
+		will be masked off to match the situation.
+*/
+void *__toncset(void *dst, u32 fill, uint size)
+{
+	if(dst==NULL || size==0)
+		return dst;
+
+	uint left= (u32)dst&3;
+	u32 *dst32= (u32*)(dst-left);
+	u32 count, mask;
+
+	// Unaligned head.
+	if(left != 0)
+	{
+		// Adjust for very small stint.
+		if(left+size<4)
+		{
+			mask= BIT_MASK(size*8)<<(left*8);	
+			*dst32= (*dst32 &~ mask) | (fill & mask);
+			return dst;
+		}
+
+		mask= BIT_MASK(left*8);
+		*dst32= (*dst32 & mask) | (fill&~mask);
+		dst32++;
+		size -= 4-left;
+	}
+
+	// Main stint.
+	count= size/4;
+	uint tmp= count&3;
+	count /= 4;
+
+	switch(tmp) {
+		do {	*dst32++ = fill;
+	case 3:		*dst32++ = fill;
+	case 2:		*dst32++ = fill;
+	case 1:		*dst32++ = fill;
+	case 0:		; }	while(count--);
+	}
+
+	// Tail
+	size &= 3;
+	if(size)
+	{
+		mask= BIT_MASK(size*8);
+		*dst32= (*dst32 &~ mask) | (fill & mask);
+	}
+
+	return dst;
+}
+
+
+// --- bit unpacking --------------------------------------------------
+
+//! Fast replacement for BitUnPack().
+/*!	Same arguments and results, but done with a lookup table in IWRAM.
+	Each source byte (or nybble or bit pair, if the data grows more
+	than 4x) becomes one table entry, instead of going bit by bit.
+	The table is only rebuilt when the formats or offset change.
+	\param src	Source data.
+	\param dst	Destination; word aligned.
+	\param bup	Source length, bitdepths and offset, as for BitUnPack().
+		Unpacks 1, 2 and 4 bpp to 4, 8 and 16 bpp; anything else is
+		passed on to the BIOS.
+	\note	Like the BIOS, non-zero units (or all units, with
+		BUP_ALL_OFS) get the offset added, without masking.
+*/
+void bup_unpack(const void *src, void *dst, const BUP *bup)
+{
+	uint srcB= bup->src_bpp, dstB= bup->dst_bpp;
+	uint ii, iu, group, mode, len= bup->src_len;
+
+	if( (srcB != 1 && srcB != 2 && srcB != 4) ||
+		(dstB != 4 && dstB != 8 && dstB != 16) || dstB <= srcB)
+	{
+		BitUnPack(src, dst, bup);
+		return;
+	}
+
+	// Table index size, so that an entry fits in a word.
+	switch(8*dstB/srcB)
+	{
+	case 16:	group= 8;	mode= BUPX_8TO16;	len += len&1;	break;
+	case 32:	group= 8;	mode= BUPX_8TO32;	break;
+	case 64:	group= 4;	mode= BUPX_4TO32;	break;
+	default:	group= 2;	mode= BUPX_2TO32;	break;
+	}
+
+	u32 fmt= srcB | dstB<<8;
+	if(fmt != __bup_fmt || bup->dst_ofs != __bup_ofs)
+	{
+		u32 ofs= bup->dst_ofs & ~BUP_ALL_OFS;
+		bool all= bup->dst_ofs & BUP_ALL_OFS;
+		u32 srcMask= (1<<srcB)-1;
+
+		for(ii=0; ii < 1u<<group; ii++)
+		{
+			u32 entry= 0;
+			for(iu=0; iu<group/srcB; iu++)
+			{
+				u32 unit= (ii>>(iu*srcB)) & srcMask;
+				if(unit || all)
+					unit += ofs;
+				entry |= unit<<(iu*dstB);
+			}
+			__bup_lut[ii]= entry;
+		}
+		__bup_fmt= fmt;
+		__bup_ofs= bup->dst_ofs;
+	}
+
+	bup_expand(dst, src, len, __bup_lut, mode);
+}
+
+
+// --- random numbers -------------------------------------------------
+
+int sqran(int seed)
+{	
+	int old= __qran_seed;
+	__qran_seed= seed; 
+	return old;	
+}
+
+//! SplitMix32 step; used to spread a single seed over larger states.
+/*!	\param seed	Pointer to seed, which will be incremented.
+	\return	Mixed 32bit value.
+*/
+u32 rng_splitmix32(u32 *seed)
+{
+	u32 z= (*seed += 0x9E3779B9);
+	z= (z ^ z>>16) * 0x85EBCA6B;
+	z= (z ^ z>>13) * 0xC2B2AE35;
+	return z ^ z>>16;
+}
+
+//! Seed an xorshift32 generator.
+/*!	\note A zero state would be a fixed point, so the seed is
+		hashed first and a zero result replaced.
+*/
+void xs32_seed(RNG_XS32 *rng, u32 seed)
+{
+	u32 x= rng_splitmix32(&seed);
+	rng->state= x ? x : 0x2545F491;
+}
+
+//! Seed an xoshiro128** generator from a single word.
+void xo128_seed(RNG_XO128 *rng, u32 seed)
+{
+	rng->state[0]= rng_splitmix32(&seed);
+	rng->state[1]= rng_splitmix32(&seed);
+	rng->state[2]= rng_splitmix32(&seed);
+	rng->state[3]= rng_splitmix32(&seed);
+}
+
+//! Jump an xoshiro128** generator ahead by 2<sup>64</sup> steps.
+/*!	Seed once, then copy and jump to get up to 2<sup>64</sup>
+	non-overlapping streams (e.g., one per particle emitter).
+	\note	Costs 128 generator steps; do this at init.
+*/
+void xo128_jump(RNG_XO128 *rng)
+{
+	static const u32 jump[4]=
+	{	0x8764000B, 0xF542D2D3, 0x6FA035C3, 0x77F2DB5B	};
+
+	u32 s0=0, s1=0, s2=0, s3=0;
+	uint ii, ib;
+	for(ii=0; ii<4; ii++)
+	{
+		for(ib=0; ib<32; ib++)
+		{
+			if(jump[ii] & BIT(ib))
+			{
+				s0 ^= rng->state[0];	s1 ^= rng->state[1];
+				s2 ^= rng->state[2];	s3 ^= rng->state[3];
+			}
+			xo128_next(rng);
+		}
+	}
+	rng->state[0]= s0;	rng->state[1]= s1;
+	rng->state[2]= s2;	rng->state[3]= s3;
+}
+
+//! Seed a PCG32 generator.
+/*!	\param seed	Starting state.
+	\param stream	Stream selector. Generators with different
+		streams give different sequences, even for the same seed.
+*/
+void pcg32_seed(RNG_PCG32 *rng, u64 seed, u64 stream)
+{
+	rng->state= 0;
+	rng->inc= stream<<1 | 1;
+	pcg32_next(rng);
+	rng->state += seed;
+	pcg32_next(rng);
+}
+
+//! Jump a PCG32 generator \a delta steps ahead.
+/*!	Done in O(log <i>delta</i>) by squaring the LCG. Use a
+	negative \a delta (as u64) to go back.
+*/
+void pcg32_advance(RNG_PCG32 *rng, u64 delta)
+{
+	u64 curMul= 0x5851F42D4C957F2DULL, curAdd= rng->inc;
+	u64 accMul= 1, accAdd= 0;
+
+	while(delta)
+	{
+		if(delta&1)
+		{
+			accMul *= curMul;
+			accAdd= accAdd*curMul + curAdd;
+		}
+		curAdd= (curMul+1)*curAdd;
+		curMul *= curMul;
+		delta >>= 1;
+	}
+	rng->state= accMul*rng->state + accAdd;
+}
+
+// --- misc -----------------------------------------------------------
+
+//! Get the octant that (\a x, \a y) is in.
+/*!	This function divides the circle in 8 parts. The angle 
+	starts at the \a y=0 line and then moves in the direction
+	of the \a x=0 line. On the screen, this would be like
+	starting at the 3 o'clock position and moving clockwise 
+*/
+u32 octant(int x, int y)
+{
+    u32 oct=0;
+    if(y<0) { oct ^= 7; y=-y; }
+    if(x<0) { oct ^= 3; x=-x; }
+    if(x<y) { oct ^= 1; }
+    return oct;
+}
+
+//! Get the rotated octant that (\a x, \a y) is in.
+/*!	Like \c octant() but with a twist. The 0-octant starts 
+	22.5� earlier so that 3 o'clock falls in the middle of 
+	octant 0, instead of at its start. This can be useful for 
+	8 directional pointing.
+*/
+u32 octant_rot(int x0, int y0)
+{
+	//rotate by pi/8: (.9: sin: 195.9; cos 473.0)
+	int x= 473*x0 - 196*y0;
+	int y= 196*x0 + 473*y0;
+
+    u32 oct=0;
+    if(y<0) { oct ^= 7; y=-y; }
+    if(x<0) { oct ^= 3; x=-x; }
+    if(x<y) { oct ^= 1; }
+    return oct;
+}
+
+//	EOF
@@ -0,0 +1,349 @@
+//
+//  Window, blend and mosaic effects
+//
+//! \file tonc_fx.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * An empty line is 0 (left == right). Spans are clipped to
+	[0, SCREEN_WIDTH], which is what the hardware wants; larger values
+	wrap around in odd ways.
+  * Circles walk the edge incrementally, so a redraw is one pass over
+	the lines it covers with no multiplies in the inner loop.
+*/
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_bios.hpp"
+#include "tonc_math.hpp"
+#include "tonc_fx.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+// --- Ramps ----------------------------------------------------------
+
+//! Set a ramp to a fixed value.
+void fxr_set(TFxRamp *ramp, int value)
+{
+	ramp->value= ramp->target= value<<8;
+	ramp->step= 0;
+	ramp->frames= 0;
+}
+
+//! Start a ramp from \a from to \a to over \a frames frames.
+/*!	The value reaches \a to exactly after the last frame. If \a frames
+	is 0, the ramp jumps there immediately.
+*/
+void fxr_start(TFxRamp *ramp, int from, int to, uint frames)
+{
+	if(frames == 0)
+	{
+		fxr_set(ramp, to);
+		return;
+	}
+	ramp->value= from<<8;
+	ramp->target= to<<8;
+	ramp->step= (ramp->target - ramp->value)/(int)frames;
+	ramp->frames= frames;
+}
+
+
+// --- Window tables --------------------------------------------------
+
+//! Set a line of a window table to span [\a left, \a right).
+static void win_span(u16 *tbl, int y, int left, int right)
+{
+	if((uint)y >= SCREEN_HEIGHT)
+		return;
+
+	left= clamp(left, 0, SCREEN_WIDTH+1);
+	right= clamp(right, 0, SCREEN_WIDTH+1);
+	tbl[y]= left < right ? (left<<8) | right : 0;
+}
+
+//! Empty all lines of a window table.
+void win_clear(u16 *tbl)
+{
+	memset16(tbl, 0, FX_WIN_LINES);
+}
+
+//! Fill a window table with a rectangle.
+void win_rect(u16 *tbl, int left, int top, int right, int bottom)
+{
+	int iy;
+
+	win_clear(tbl);
+	top= max(top, 0);
+	bottom= min(bottom, SCREEN_HEIGHT);
+	for(iy=top; iy<bottom; iy++)
+		win_span(tbl, iy, left, right);
+}
+
+//! Fill a window table with a circle.
+/*!	\param tbl	Window table (FX_WIN_LINES entries).
+	\param x0	Center x.
+	\param y0	Center y.
+	\param rr	Radius. Empty if &lt;= 0.
+*/
+void win_circle(u16 *tbl, int x0, int y0, int rr)
+{
+	int dx, dy, err;
+
+	win_clear(tbl);
+	if(rr <= 0)
+		return;
+
+	// err = rr^2 + rr - dx^2 - dy^2; step dx in while it's negative.
+	// The +rr makes it a midpoint circle, which looks rounder.
+	dx= rr;
+	err= rr;
+	for(dy=0; dy<rr; dy++)
+	{
+		while(err < 0)
+		{
+			err += 2*dx-1;
+			dx--;
+		}
+		win_span(tbl, y0+dy, x0-dx, x0+dx+1);
+		if(dy)
+			win_span(tbl, y0-dy, x0-dx, x0+dx+1);
+		err -= 2*dy+1;
+	}
+}
+
+//! Fill a window table with a diamond.
+/*!	\param tbl	Window table (FX_WIN_LINES entries).
+	\param x0	Center x.
+	\param y0	Center y.
+	\param rr	Distance from center to the tips. Empty if &lt;= 0.
+*/
+void win_diamond(u16 *tbl, int x0, int y0, int rr)
+{
+	int dy;
+
+	win_clear(tbl);
+	for(dy=0; dy<rr; dy++)
+	{
+		win_span(tbl, y0+dy, x0-rr+dy+1, x0+rr-dy);
+		if(dy)
+			win_span(tbl, y0-dy, x0-rr+dy+1, x0+rr-dy);
+	}
+}
+
+
+// --- Window effects -------------------------------------------------
+
+//! Initialize a window effect.
+/*!	\param wfx	Effect to initialize. It's about 650 bytes, so keep
+		it out of IWRAM.
+	\param win	Window to drive: 0 or 1.
+	\param dma	DMA channel for the HBlank transfers. Channel 0 has the
+		highest priority, which matters during heavy DMA use.
+	\note	Sets the window to cover all lines vertically and empties
+		it. Enabling the window and its layers is up to you.
+*/
+void winfx_init(TWinFx *wfx, uint win, uint dma)
+{
+	wfx->win= win;
+	wfx->dma= dma;
+	wfx->shape= WFX_CIRCLE;
+	wfx->page= 0;
+	wfx->ready= 0;
+	wfx->dirty= 0;
+	wfx->x= SCREEN_WIDTH/2;
+	wfx->y= SCREEN_HEIGHT/2;
+	fxr_set(&wfx->size, 0);
+
+	win_clear(wfx->tables[0]);
+	win_clear(wfx->tables[1]);
+
+	(&REG_WIN0V)[win]= SCREEN_HEIGHT;	// top 0, bottom 160
+	(&REG_WIN0H)[win]= 0;
+}
+
+//! Animate a window shape.
+/*!	\param wfx	Window effect.
+	\param shape	Shape; WFX_CIRCLE, WFX_DIAMOND or WFX_BOX.
+	\param x	Center x.
+	\param y	Center y.
+	\param from	Starting size.
+	\param to	Final size.
+	\param frames	Duration of the animation.
+*/
+void winfx_start(TWinFx *wfx, uint shape, int x, int y,
+	int from, int to, uint frames)
+{
+	wfx->shape= shape;
+	wfx->x= x;
+	wfx->y= y;
+	fxr_start(&wfx->size, from, to, frames);
+	wfx->dirty= 1;
+}
+
+//! Iris wipe: grow a shape from nothing to full screen, or back.
+/*!	\param wfx	Window effect.
+	\param shape	Shape; WFX_CIRCLE, WFX_DIAMOND or WFX_BOX.
+	\param x	Center x.
+	\param y	Center y.
+	\param open	If true, open up; otherwise close down.
+	\param frames	Duration of the wipe.
+*/
+void winfx_iris(TWinFx *wfx, uint shape, int x, int y, bool open,
+	uint frames)
+{
+	int dx= max(x, SCREEN_WIDTH-x), dy= max(y, SCREEN_HEIGHT-y);
+	int size;
+
+	// Smallest size that covers the screen.
+	if(shape == WFX_CIRCLE)
+		size= Sqrt(dx*dx + dy*dy)+1;
+	else if(shape == WFX_DIAMOND)
+		size= dx+dy+1;
+	else
+		size= max(dx, dy);
+
+	if(open)
+		winfx_start(wfx, shape, x, y, 0, size, frames);
+	else
+		winfx_start(wfx, shape, x, y, size, 0, frames);
+}
+
+//! Advance the animation and redraw the shape if needed.
+/*!	Call once per frame, outside VBlank is fine. The new shape shows
+	up after the next winfx_vblank().
+	\return	true if the shape was redrawn.
+*/
+BOOL winfx_update(TWinFx *wfx)
+{
+	if(!fxr_update(&wfx->size) && !wfx->dirty)
+		return false;
+
+	// Block the swap while the back table is being drawn.
+	wfx->ready= 0;
+
+	u16 *tbl= wfx->tables[wfx->page^1];
+	int size= fxr_get(&wfx->size);
+
+	switch(wfx->shape)
+	{
+	case WFX_CIRCLE:
+		win_circle(tbl, wfx->x, wfx->y, size);		break;
+	case WFX_DIAMOND:
+		win_diamond(tbl, wfx->x, wfx->y, size);		break;
+	default:
+		win_rect(tbl, wfx->x-size, wfx->y-size, wfx->x+size, wfx->y+size);
+	}
+
+	wfx->dirty= 0;
+	wfx->ready= 1;
+	return true;
+}
+
+//! Show the latest table and restart the HBlank DMA.
+/*!	Call every VBlank, before line 0 starts.
+*/
+void winfx_vblank(TWinFx *wfx)
+{
+	if(wfx->ready)
+	{
+		wfx->page ^= 1;
+		wfx->ready= 0;
+	}
+
+	const u16 *tbl= wfx->tables[wfx->page];
+	vu16 *dst= &(&REG_WIN0H)[wfx->win];
+
+	// Line 0 by hand; each HBlank then sets up the next line.
+	REG_DMA[wfx->dma].cnt= 0;
+	*dst= tbl[0];
+	dma_cpy((void*)dst, &tbl[1], 1, wfx->dma, DMA_HDMA|DMA_16);
+}
+
+//! Stop the HBlank DMA and empty the window.
+void winfx_stop(TWinFx *wfx)
+{
+	REG_DMA[wfx->dma].cnt= 0;
+	(&REG_WIN0H)[wfx->win]= 0;
+	wfx->size.frames= 0;
+	wfx->dirty= 0;
+}
+
+
+// --- Blend and mosaic -----------------------------------------------
+
+//! Set the blend weights and fade level, and write them out.
+void bldfx_init(TBlendFx *bfx, uint eva, uint evb, uint ey)
+{
+	fxr_set(&bfx->eva, eva);
+	fxr_set(&bfx->evb, evb);
+	fxr_set(&bfx->ey, ey);
+	REG_BLDALPHA= BLDA_BUILD(eva, evb);
+	REG_BLDY= BLDY_BUILD(ey);
+}
+
+//! Ramp the blend weights (0-16) from their current values.
+void bldfx_alpha(TBlendFx *bfx, uint eva, uint evb, uint frames)
+{
+	fxr_start(&bfx->eva, fxr_get(&bfx->eva), eva, frames);
+	fxr_start(&bfx->evb, fxr_get(&bfx->evb), evb, frames);
+}
+
+//! Ramp the fade level (0-16) from its current value.
+/*!	Whether it fades to white or black depends on the mode in
+	REG_BLDCNT.
+*/
+void bldfx_fade(TBlendFx *bfx, uint ey, uint frames)
+{
+	fxr_start(&bfx->ey, fxr_get(&bfx->ey), ey, frames);
+}
+
+//! Advance the blend ramps and write the registers; call in VBlank.
+/*!	\return	true if any of the ramps is still running.
+*/
+BOOL bldfx_update(TBlendFx *bfx)
+{
+	if(fxr_update(&bfx->eva) | fxr_update(&bfx->evb))
+		REG_BLDALPHA= BLDA_BUILD(fxr_get(&bfx->eva), fxr_get(&bfx->evb));
+	if(fxr_update(&bfx->ey))
+		REG_BLDY= BLDY_BUILD(fxr_get(&bfx->ey));
+
+	return fxr_is_running(&bfx->eva) || fxr_is_running(&bfx->evb) ||
+		fxr_is_running(&bfx->ey);
+}
+
+//! Set the mosaic sizes (0-15) and write them out.
+void mosfx_init(TMosaicFx *mfx, uint bg, uint obj)
+{
+	fxr_set(&mfx->bg, bg);
+	fxr_set(&mfx->obj, obj);
+	REG_MOSAIC= MOS_BUILD(bg, bg, obj, obj);
+}
+
+//! Ramp the mosaic sizes (0-15) from their current values.
+void mosfx_ramp(TMosaicFx *mfx, uint bg, uint obj, uint frames)
+{
+	fxr_start(&mfx->bg, fxr_get(&mfx->bg), bg, frames);
+	fxr_start(&mfx->obj, fxr_get(&mfx->obj), obj, frames);
+}
+
+//! Advance the mosaic ramps and write REG_MOSAIC; call in VBlank.
+/*!	\return	true if either ramp is still running.
+*/
+BOOL mosfx_update(TMosaicFx *mfx)
+{
+	if(fxr_update(&mfx->bg) | fxr_update(&mfx->obj))
+	{
+		uint bg= fxr_get(&mfx->bg), obj= fxr_get(&mfx->obj);
+		REG_MOSAIC= MOS_BUILD(bg, bg, obj, obj);
+	}
+
+	return fxr_is_running(&mfx->bg) || fxr_is_running(&mfx->obj);
+}
+
+// EOF
@@ -0,0 +1,513 @@
+//
+//  Link cable: multiplayer transport and lockstep input
+//
+//! \file tonc_link.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * The serial isr owns \a tx, \a rx and the receiving end of the
+	player queues; the main code owns \a txNext and the sending end of
+	\a out. \a ready hands \a txNext over, like in the window effects.
+  * A packet that isn't picked up in time goes out again, but without
+	its messages, since those have already left the queue.
+*/
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_irq.hpp"
+#include "tonc_input.hpp"
+#include "tonc_math.hpp"
+#include "tonc_link.hpp"
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+TLink gLink;
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+// --- Queues ---------------------------------------------------------
+
+INLINE uint lq_count(const TLinkQueue *lq)
+{	return (lq->head - lq->tail) & (LINK_QUEUE_SIZE-1);		}
+
+static BOOL lq_push(TLinkQueue *lq, u16 data)
+{
+	uint head= lq->head, next= (head+1) & (LINK_QUEUE_SIZE-1);
+
+	if(next == lq->tail)
+		return false;
+
+	lq->data[head]= data;
+	lq->head= next;
+	return true;
+}
+
+static BOOL lq_pop(TLinkQueue *lq, u16 *data)
+{
+	uint tail= lq->tail;
+
+	if(tail == lq->head)
+		return false;
+
+	*data= lq->data[tail];
+	lq->tail= (tail+1) & (LINK_QUEUE_SIZE-1);
+	return true;
+}
+
+
+// --- Packets --------------------------------------------------------
+
+//! Move \a txNext to \a tx, if there is one.
+static void link_take(TLink *lk)
+{
+	uint ii, count;
+
+	if(!lk->ready)
+	{
+		lk->tx[0] &= ~0x0F00;
+		return;
+	}
+
+	for(ii=0; ii<LINK_PACKET_LEN; ii++)
+		lk->tx[ii]= lk->txNext[ii];
+
+	count= (lk->tx[0]>>8) & 15;
+	lk->out.tail= (lk->out.tail + count) & (LINK_QUEUE_SIZE-1);
+	lk->ready= 0;
+}
+
+//! Store input word \a word from a player at frame \a frame.
+/*!	Only the first missing frame is taken, so the history never has
+	holes.
+*/
+static void link_keys_in(TLinkPlayer *pl, u32 frame, uint word)
+{
+	if(word == LINK_KEYS_NONE)
+		return;
+
+	frame += (word>>10) - 32;
+	if(frame != pl->confirmed)
+		return;
+
+	pl->keys[frame & (LINK_HISTORY-1)]= word & KEY_MASK;
+	pl->confirmed= frame+1;
+}
+
+//! Unpack the packets in \a rx.
+static void link_receive(TLink *lk, uint self)
+{
+	uint ii, pp, count;
+	u32 frame;
+
+	lk->packets++;
+	for(pp=0; pp<LINK_PLAYERS; pp++)
+	{
+		const u16 *pkt= lk->rx[pp];
+		TLinkPlayer *pl= &lk->players[pp];
+
+		if((pkt[0] & LINK_HDR_MASK) != LINK_HDR_MAGIC)
+		{
+			lk->connected &= ~BIT(pp);
+			continue;
+		}
+		lk->connected |= BIT(pp);
+		if(pp == self)
+			continue;
+
+		// Full frame number from the low byte.
+		frame= lk->frame + (s8)(pkt[0] - lk->frame);
+		pl->frame= frame;
+		pl->need= frame + ((pkt[1]>>(4*self)) & 15) - LINK_ACK_BIAS;
+
+		if(lk->sync)
+		{
+			link_keys_in(pl, frame, pkt[2]);
+			link_keys_in(pl, frame, pkt[3]);
+		}
+
+		count= min((pkt[0]>>8) & 15, LINK_MSG_MAX);
+		for(ii=0; ii<count; ii++)
+			if(!lq_push(&pl->in, pkt[4+ii]))
+				lk->errors++;
+	}
+}
+
+//! Input word for frame \a frame, relative to the current frame.
+static uint link_keys_out(TLink *lk, u32 frame)
+{
+	TLinkPlayer *me= &lk->players[lk->id];
+	int age= me->confirmed - frame, ofs= frame - lk->frame;
+
+	if(age <= 0 || age > LINK_HISTORY || ofs < -32 || ofs > 30)
+		return LINK_KEYS_NONE;
+
+	return me->keys[frame & (LINK_HISTORY-1)] | (ofs+32)<<10;
+}
+
+
+// --- Setup ----------------------------------------------------------
+
+//! Start the link.
+/*!	\param mode	LINK_MP or LINK_LOOPBACK.
+	\param baud	Baud rate for LINK_MP, SIOM_9600 to SIOM_115200. All
+		GBAs must use the same one.
+	\note	Needs irq_init() first. Call link_vblank() from your
+		VBlank isr.
+*/
+void link_init(uint mode, uint baud)
+{
+	TLink *lk= &gLink;
+	uint ii;
+
+	link_stop();
+	memset32(lk, 0, sizeof(TLink)/4);
+	lk->mode= mode;
+	lk->tx[0]= LINK_HDR_MAGIC;
+	for(ii=1; ii<LINK_PACKET_LEN; ii++)
+		lk->tx[ii]= LINK_KEYS_NONE;
+
+	if(mode != LINK_MP)
+		return;
+
+	REG_RCNT= R_MODE_MULTI;
+	REG_SIOCNT= SIO_MODE_MULTI;
+	REG_SIOCNT= SIO_MODE_MULTI | SIO_IRQ | (baud & SIOM_BAUD_MASK);
+	REG_SIOMLT_SEND= lk->tx[0];
+
+	irq_add(II_SERIAL, link_serial_isr);
+	irq_add(II_TIMER3, link_timer_isr);
+}
+
+//! Stop the link and release the serial port and timer 3.
+void link_stop(void)
+{
+	if(gLink.mode == LINK_MP)
+	{
+		REG_TM3CNT= 0;
+		REG_SIOCNT= 0;
+		irq_delete(II_SERIAL);
+		irq_delete(II_TIMER3);
+	}
+	gLink.mode= LINK_OFF;
+	gLink.sync= 0;
+}
+
+//! Start lockstep input at frame 0.
+/*!	All players must call this, with the same \a delay. The lobby
+	messages can be used to agree on that.
+	\param delay	Input delay in frames, at most LINK_DELAY_MAX.
+		Frames before it have no keys for anyone.
+*/
+void link_start(uint delay)
+{
+	TLink *lk= &gLink;
+	uint ii;
+
+	delay= min(delay, LINK_DELAY_MAX);
+
+	u32 ime= REG_IME;
+	REG_IME= 0;
+
+	lk->id= lk->mode == LINK_MP ? BFN_GET(REG_SIOCNT, SIOM_ID) : 0;
+	lk->delay= delay;
+	lk->frame= 0;
+	lk->stalls= 0;
+	for(ii=0; ii<LINK_PLAYERS; ii++)
+	{
+		TLinkPlayer *pl= &lk->players[ii];
+		pl->confirmed= delay;
+		pl->frame= 0;
+		pl->need= delay;
+		pl->curr= pl->prev= 0;
+		memset16(pl->keys, 0, LINK_HISTORY);
+	}
+	lk->sync= 1;
+
+	REG_IME= ime;
+}
+
+
+// --- Interrupts -----------------------------------------------------
+
+//! Start the frame's packet exchange; call in VBlank.
+/*!	On the master, this sends the latest packet. Slaves don't need
+	it, but it's harmless. In loopback mode, it delivers the packet.
+*/
+void link_vblank(void)
+{
+	TLink *lk= &gLink;
+	uint ii;
+
+	if(lk->mode == LINK_LOOPBACK)
+	{
+		link_take(lk);
+		for(ii=0; ii<LINK_PACKET_LEN; ii++)
+			lk->rx[0][ii]= lk->rx[1][ii]= lk->tx[ii];
+		for(ii=2; ii<LINK_PLAYERS; ii++)
+			lk->rx[ii][0]= 0xFFFF;
+
+		// Seen from player 1, the acks for 0 and 1 are swapped.
+		uint acks= lk->tx[1];
+		lk->rx[1][1]= (acks & 0xFF00) | (acks<<4 & 0xF0) | (acks>>4 & 0x0F);
+		link_receive(lk, 0);
+		return;
+	}
+
+	if(lk->mode != LINK_MP)
+		return;
+
+	// Only the master starts transfers.
+	u32 cnt= REG_SIOCNT;
+	if((cnt & SIOM_SLAVE) || !(cnt & SIOM_CONNECTED) || (cnt & SIOM_ENABLE))
+		return;
+
+	// A packet that's still going after a frame is stuck; drop it.
+	if(lk->index != 0)
+	{
+		REG_TM3CNT= 0;
+		lk->index= 0;
+		lk->error= 0;
+		lk->errors++;
+	}
+
+	link_take(lk);
+	REG_SIOMLT_SEND= lk->tx[0];
+	REG_SIOCNT= cnt | SIOM_ENABLE;
+}
+
+//! Serial isr: store the received halfwords and load the next one.
+void link_serial_isr(void)
+{
+	TLink *lk= &gLink;
+	uint ii, idx= lk->index;
+	u32 cnt= REG_SIOCNT;
+
+	// Out of step: wait for the master's next header.
+	if(idx == 0 && (REG_SIOMULTI0 & LINK_HDR_MASK) != LINK_HDR_MAGIC)
+	{
+		REG_SIOMLT_SEND= lk->tx[0];
+		return;
+	}
+
+	if(cnt & SIOM_ERROR)
+		lk->error= 1;
+
+	for(ii=0; ii<LINK_PLAYERS; ii++)
+		lk->rx[ii][idx]= REG_SIOMULTI[ii];
+
+	if(++idx >= LINK_PACKET_LEN)
+	{
+		if(lk->error)
+			lk->errors++;
+		else
+			link_receive(lk, BFN_GET(cnt, SIOM_ID));
+		lk->error= 0;
+
+		// The master takes its next packet in VBlank.
+		if(cnt & SIOM_SLAVE)
+			link_take(lk);
+		idx= 0;
+	}
+	lk->index= idx;
+	REG_SIOMLT_SEND= lk->tx[idx];
+
+	if(idx != 0 && !(cnt & SIOM_SLAVE))
+	{
+		REG_TM3D= -LINK_TIMER_GAP;
+		REG_TM3CNT= TM_FREQ_64 | TM_IRQ | TM_ENABLE;
+	}
+}
+
+//! Timer 3 isr: start the next transfer of the packet (master only).
+void link_timer_isr(void)
+{
+	REG_TM3CNT= 0;
+	REG_SIOCNT |= SIOM_ENABLE;
+}
+
+
+// --- Frames ---------------------------------------------------------
+
+//! Prepare the next packet: acks, input and queued messages.
+/*!	Called by link_key_poll(); call it once per frame yourself if
+	you only use messages.
+*/
+void link_update(void)
+{
+	TLink *lk= &gLink;
+	u16 *pkt= lk->txNext;
+	uint ii, count, acks=0;
+	u32 need= lk->players[lk->id].confirmed;
+
+	// Block the swap while the packet is being built.
+	lk->ready= 0;
+
+	for(ii=0; ii<LINK_PLAYERS; ii++)
+	{
+		TLinkPlayer *pl= &lk->players[ii];
+		if(ii == lk->id || !((lk->connected>>ii) & 1))
+			continue;
+
+		if((int)(pl->need - need) < 0)
+			need= pl->need;
+		if(lk->sync)
+			acks |= clamp(pl->confirmed - lk->frame + LINK_ACK_BIAS, 0, 16) << (4*ii);
+	}
+	pkt[1]= acks;
+	pkt[2]= lk->sync ? link_keys_out(lk, need) : LINK_KEYS_NONE;
+	pkt[3]= lk->sync ? link_keys_out(lk, need+1) : LINK_KEYS_NONE;
+
+	// Peek; link_take() removes them once they're on their way.
+	count= min(lq_count(&lk->out), LINK_MSG_MAX);
+	for(ii=0; ii<count; ii++)
+		pkt[4+ii]= lk->out.data[(lk->out.tail+ii) & (LINK_QUEUE_SIZE-1)];
+	for( ; ii<LINK_MSG_MAX; ii++)
+		pkt[4+ii]= 0;
+
+	pkt[0]= LINK_HDR_MAGIC | count<<8 | (lk->frame & 255);
+	lk->ready= 1;
+}
+
+//! Sample the local keys for frame + delay, once.
+static void link_sample(TLink *lk)
+{
+	TLinkPlayer *me= &lk->players[lk->id];
+
+	if(me->confirmed > lk->frame + lk->delay)
+		return;
+
+	me->keys[me->confirmed & (LINK_HISTORY-1)]= ~REG_KEYINPUT & KEY_MASK;
+	me->confirmed= me->confirmed+1;
+}
+
+//! Move to the next frame.
+static void link_advance(TLink *lk)
+{
+	uint ii;
+
+	for(ii=0; ii<LINK_PLAYERS; ii++)
+	{
+		TLinkPlayer *pl= &lk->players[ii];
+		pl->prev= pl->curr;
+		pl->curr= (lk->connected>>ii) & 1 ? link_keys_at(ii, lk->frame) : 0;
+	}
+	__key_prev= __key_curr;
+	__key_curr= lk->players[lk->id].curr;
+	lk->frame++;
+}
+
+//! Lockstep replacement for key_poll().
+/*!	Samples the local keys and sends them off. If everybody's input
+	for the current frame is in, the frame advances: link_keys() has
+	each player's keys, and the local ones are also set as the key
+	state, so key_hit() and friends work as usual.
+	\return	true if the frame advanced; false means wait and try
+		again next frame.
+	\note	Before link_start(), this is a plain key_poll().
+*/
+BOOL link_key_poll(void)
+{
+	TLink *lk= &gLink;
+	uint ii;
+
+	if(!lk->sync)
+	{
+		link_update();
+		key_poll();
+		return true;
+	}
+
+	link_sample(lk);
+	link_update();
+
+	for(ii=0; ii<LINK_PLAYERS; ii++)
+	{
+		if(((lk->connected>>ii) & 1) &&
+			(int)(lk->players[ii].confirmed - lk->frame) <= 0)
+		{
+			lk->stalls++;
+			return false;
+		}
+	}
+
+	link_advance(lk);
+	return true;
+}
+
+//! Rollback version of link_key_poll().
+/*!	Advances without waiting, with predictions for the keys that
+	haven't arrived, unless that goes over LINK_PREDICT_MAX frames.
+	\return	true if the frame advanced.
+*/
+BOOL link_key_predict(void)
+{
+	TLink *lk= &gLink;
+	uint ii;
+
+	if(!lk->sync)
+		return link_key_poll();
+
+	link_sample(lk);
+	link_update();
+
+	for(ii=0; ii<LINK_PLAYERS; ii++)
+	{
+		if(((lk->connected>>ii) & 1) &&
+			(int)(lk->players[ii].confirmed + LINK_PREDICT_MAX - lk->frame) <= 0)
+		{
+			lk->stalls++;
+			return false;
+		}
+	}
+
+	link_advance(lk);
+	return true;
+}
+
+//! Keys of \a player at \a frame.
+/*!	For frames past link_confirmed() this is a prediction: the last
+	real keys.
+*/
+u32 link_keys_at(uint player, u32 frame)
+{
+	TLinkPlayer *pl= &gLink.players[player];
+	u32 last= pl->confirmed-1;
+
+	if((int)(frame - last) > 0)
+		frame= last;
+
+	return pl->keys[frame & (LINK_HISTORY-1)];
+}
+
+
+// --- Messages -------------------------------------------------------
+
+//! Queue a message halfword for all other players.
+/*!	\return	false if the queue is full.
+*/
+BOOL link_send(u16 msg)
+{
+	return lq_push(&gLink.out, msg);
+}
+
+//! Get the next message halfword from \a player.
+/*!	\return	false if there are none.
+	\note	Messages can get lost to transfer errors (see \a errors).
+		Build something on top if that matters.
+*/
+BOOL link_recv(uint player, u16 *msg)
+{
+	return lq_pop(&gLink.players[player].in, msg);
+}
+
+// EOF
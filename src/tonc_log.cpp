@@ -0,0 +1,280 @@
+//
+//  Debug logging
+//
+//! \file tonc_log.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * log_put() can be called from isrs, so the ring is only touched
+	with interrupts off. log_flush() belongs in the main loop.
+  * The formatter is deliberately small. It's not printf, and it
+	doesn't pull printf in.
+*/
+
+#include <stdarg.h>
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+#include "tonc_nocash.hpp"
+#include "tonc_log.hpp"
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+TLog gLog=
+{
+	LOGL_DEBUG, 0, LOG_OUT_NOCASH, 0xFFFFFFFF, 0, 0, 0,
+	{	"gen", "video", "audio", "input", "link", "save", "text"	}
+};
+
+EWRAM_BSS static TLogEntry __log_ring[LOG_RING_SIZE];
+
+static const char __log_levels[]= "FEWID";
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Set up the outputs.
+/*!	\param flags	LOG_OUT_xxx outputs, plus LOG_RAW.
+	\return	The outputs in use. LOG_OUT_MGBA is dropped if mGBA's
+		debug registers don't answer.
+*/
+uint log_init(uint flags)
+{
+	if(flags & LOG_OUT_MGBA)
+	{
+		REG_MGBA_DEBUG_ENABLE= MGBA_DEBUG_KEY;
+		if(REG_MGBA_DEBUG_ENABLE != MGBA_DEBUG_ACK)
+			flags &= ~LOG_OUT_MGBA;
+	}
+
+	gLog.flags= flags;
+	gLog.head= gLog.tail= 0;
+	gLog.dropped= 0;
+	return flags;
+}
+
+//! Store a message; use the LOG() macros instead.
+/*!	\param level	LOGL_xxx level. LOGL_FATAL flushes at once.
+	\param cat	Category.
+	\param fmt	Format string. Only the pointer is stored.
+	\param argc	Number of arguments that follow, at most LOG_ARGS_MAX.
+*/
+void log_put(uint level, uint cat, const char *fmt, uint argc, ...)
+{
+	uint ii, head;
+	va_list args;
+
+	argc= argc < LOG_ARGS_MAX ? argc : LOG_ARGS_MAX;
+
+	u32 ime= REG_IME;
+	REG_IME= 0;
+
+	head= gLog.head;
+	if(((head+1) & (LOG_RING_SIZE-1)) == gLog.tail)
+	{
+		gLog.dropped++;
+		REG_IME= ime;
+		return;
+	}
+
+	TLogEntry *entry= &__log_ring[head];
+	entry->fmt= fmt;
+	entry->level= level;
+	entry->cat= cat;
+	entry->argc= argc;
+
+	va_start(args, argc);
+	for(ii=0; ii<argc; ii++)
+		entry->args[ii]= va_arg(args, u32);
+	va_end(args);
+
+	gLog.head= (head+1) & (LOG_RING_SIZE-1);
+	REG_IME= ime;
+
+	if(level == LOGL_FATAL)
+		log_flush(0);
+}
+
+//! Format and send out stored messages.
+/*!	\param max	Maximum number of messages; 0 for all.
+	\return	Number of messages sent.
+*/
+uint log_flush(uint max)
+{
+	char line[LOG_LINE_MAX];
+	uint count= 0;
+
+	if(gLog.dropped)
+	{
+		TLogEntry note= { "%u messages dropped", LOGL_WARN, LOGC_GENERAL, 1 };
+		note.args[0]= gLog.dropped;
+		gLog.dropped= 0;
+		log_format(line, LOG_LINE_MAX, &note);
+		log_write(LOGL_WARN, line);
+	}
+
+	while(gLog.tail != gLog.head && (max == 0 || count < max))
+	{
+		const TLogEntry *entry= &__log_ring[gLog.tail];
+		log_format(line, LOG_LINE_MAX, entry);
+		log_write(entry->level, line);
+
+		gLog.tail= (gLog.tail+1) & (LOG_RING_SIZE-1);
+		count++;
+	}
+
+	return count;
+}
+
+//! Write \a value backwards from \a end, in \a base.
+static const char *log_fmt_uint(char *end, u32 value, uint base, bool upper)
+{
+	const char *digits= upper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+	do {
+		*--end= digits[value%base];
+		value /= base;
+	} while(value);
+
+	return end;
+}
+
+//! Copy \a str to \a pos, stopping at \a end.
+static char *log_copy(char *pos, const char *end, const char *str)
+{
+	while(*str && pos < end)
+		*pos++= *str++;
+	return pos;
+}
+
+//! Format \a entry into \a dst as "[level:category] text".
+/*!	\return	Length of the line.
+*/
+int log_format(char *dst, uint size, const TLogEntry *entry)
+{
+	char num[12], *pos= dst, *end= dst+size-1;
+	char *numEnd= &num[11];
+	const char *fmt= entry->fmt, *str;
+	uint arg, ch, width, len;
+	bool zero, neg;
+
+	*numEnd= '\0';
+
+	// Prefix
+	str= gLog.names[entry->cat & 31];
+	if(str == NULL)
+		str= log_fmt_uint(numEnd, entry->cat, 10, false);
+	*pos++= '[';
+	*pos++= entry->level < 5 ? __log_levels[entry->level] : '?';
+	*pos++= ':';
+	pos= log_copy(pos, end-2, str);
+	*pos++= ']';
+	*pos++= ' ';
+
+	if(gLog.flags & LOG_RAW)
+	{
+		*pos++= '#';
+		pos= log_copy(pos, end, log_fmt_uint(numEnd, (u32)fmt, 16, true));
+		for(arg=0; arg<entry->argc && pos < end; arg++)
+		{
+			*pos++= ' ';
+			pos= log_copy(pos, end, log_fmt_uint(numEnd, entry->args[arg], 16, true));
+		}
+		*pos= '\0';
+		return pos-dst;
+	}
+
+	arg= 0;
+	while((ch= *fmt++) != '\0' && pos < end)
+	{
+		if(ch != '%')
+		{
+			*pos++= ch;
+			continue;
+		}
+
+		zero= false;
+		width= 0;
+		if(*fmt == '0')
+		{
+			zero= true;
+			fmt++;
+		}
+		while(*fmt >= '0' && *fmt <= '9')
+			width= width*10 + *fmt++ - '0';
+
+		ch= *fmt++;
+		if(ch == '\0')
+			break;
+		if(ch == '%')
+		{
+			*pos++= '%';
+			continue;
+		}
+
+		u32 value= arg < entry->argc ? entry->args[arg++] : 0;
+		neg= false;
+
+		switch(ch)
+		{
+		case 'd':	case 'i':
+			neg= (int)value < 0;
+			str= log_fmt_uint(numEnd, neg ? -value : value, 10, false);	break;
+		case 'u':
+			str= log_fmt_uint(numEnd, value, 10, false);	break;
+		case 'x':
+			str= log_fmt_uint(numEnd, value, 16, false);	break;
+		case 'X':	case 'p':
+			str= log_fmt_uint(numEnd, value, 16, true);		break;
+		case 'c':
+			*pos++= value;
+			continue;
+		case 's':
+			pos= log_copy(pos, end, value ? (const char*)value : "(null)");
+			continue;
+		default:
+			continue;
+		}
+
+		// Numbers: sign, padding, digits.
+		len= numEnd-str + neg;
+		if(neg && zero)
+			*pos++= '-';
+		for( ; width > len && pos < end; width--)
+			*pos++= zero ? '0' : ' ';
+		if(neg && !zero && pos < end)
+			*pos++= '-';
+		pos= log_copy(pos, end, str);
+	}
+
+	*pos= '\0';
+	return pos-dst;
+}
+
+//! Send a line to the outputs.
+void log_write(uint level, const char *str)
+{
+	if(gLog.flags & LOG_OUT_MGBA)
+	{
+		char *dst= REG_MGBA_DEBUG_STRING;
+		uint ii;
+
+		for(ii=0; ii<255 && str[ii]; ii++)
+			dst[ii]= str[ii];
+		dst[ii]= '\0';
+		REG_MGBA_DEBUG_FLAGS= (level & 7) | MGBA_DEBUG_SEND;
+	}
+
+	if(gLog.flags & LOG_OUT_NOCASH)
+		nocash_puts(str);
+}
+
+// EOF
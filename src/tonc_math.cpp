@@ -1,54 +1,285 @@
-//
-//  Basic math functions
-//
-//! \file tonc_math.c
-//! \author J Vijn
-//! \date 20060508 - 20060508
-//
-// === NOTES ===
-
-#include "tonc_memmap.hpp"
-#include "tonc_core.hpp"
-#include "tonc_math.hpp"
-
-
-// --------------------------------------------------------------------
-// FUNCTIONS 
-// --------------------------------------------------------------------
-
-
-// --- Geometry -------------------------------------------------------
-
-// --- Point functions ---
-
-//! Is a point inside a rectangle
-int pt_in_rect(const POINT *pt, const RECT *rc)
-{
-	if(pt->x < rc->left || pt->x >= rc->right)
-		return 0;
-	if(pt->y < rc->top || pt->y >= rc->bottom)
-		return 0;
-	return 1;
-}
-
-// --- Vector functions ---
-
-VECTOR *vec_cross(VECTOR *vd, const VECTOR *va, const VECTOR *vb)
-{
-	vd->x= fxmul(va->y, vb->z) - fxmul(va->z,vb->y);
-	vd->y= fxmul(va->y, vb->z) - fxmul(va->z,vb->y);
-	vd->z= fxmul(va->y, vb->z) - fxmul(va->z,vb->y);
-	return vd;
-}
-
-// --- Rect functions ---
-
-RECT *rc_normalize(RECT *rc)
-{
-	int tmp;
-	if(rc->left > rc->right) 
-		SWAP3(rc->left, rc->right, tmp);
-	if(rc->top > rc->bottom) 
-		SWAP3(rc->top, rc->bottom, tmp);
-	return rc;
-}
+//
+//  Basic math functions
+//
+//! \file tonc_math.c
+//! \author J Vijn
+//! \date 20060508 - 20060508
+//
+// === NOTES ===
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+#include "tonc_math.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS 
+// --------------------------------------------------------------------
+
+
+// --- Geometry -------------------------------------------------------
+
+// --- Point functions ---
+
+//! Is a point inside a rectangle
+int pt_in_rect(const POINT *pt, const RECT *rc)
+{
+	if(pt->x < rc->left || pt->x >= rc->right)
+		return 0;
+	if(pt->y < rc->top || pt->y >= rc->bottom)
+		return 0;
+	return 1;
+}
+
+// --- Vector functions ---
+
+VECTOR *vec_cross(VECTOR *vd, const VECTOR *va, const VECTOR *vb)
+{
+	vd->x= fxmul(va->y, vb->z) - fxmul(va->z,vb->y);
+	vd->y= fxmul(va->y, vb->z) - fxmul(va->z,vb->y);
+	vd->z= fxmul(va->y, vb->z) - fxmul(va->z,vb->y);
+	return vd;
+}
+
+// --- Rect functions ---
+
+RECT *rc_normalize(RECT *rc)
+{
+	int tmp;
+	if(rc->left > rc->right) 
+		SWAP3(rc->left, rc->right, tmp);
+	if(rc->top > rc->bottom) 
+		SWAP3(rc->top, rc->bottom, tmp);
+	return rc;
+}
+
+// --- Line iterators ---
+
+//! Initialize a run-slice line iterator from (\a x1, \a y1) to (\a x2, \a y2).
+/*!	Both end points are included. The division for the run length 
+	is done here, once; line_iter_next() only adds.
+*/
+void line_iter_init(LINE_ITER *li, int x1, int y1, int x2, int y2)
+{
+	int dx= x2-x1, dy= y2-y1, dmaj, dmin;
+
+	li->xstep= 1;
+	li->ystep= 1;
+	if(dx<0)	{	li->xstep= -1;	dx= -dx;	}
+	if(dy<0)	{	li->ystep= -1;	dy= -dy;	}
+	li->x= x1;
+	li->y= y1;
+
+	if(dx>=dy)
+	{	li->ymajor= FALSE;	dmaj= dx;	dmin= dy;	}
+	else
+	{	li->ymajor= TRUE;	dmaj= dy;	dmin= dx;	}
+
+	// Straight line: single span.
+	if(dmin == 0)
+	{
+		li->run= li->finalRun= dmaj+1;
+		li->wholeStep= li->adjUp= li->adjDown= li->err= 0;
+		li->count= 1;
+		return;
+	}
+
+	// Runs of wholeStep or wholeStep+1, with the remainder split 
+	// over the first and last runs.
+	int whole= dmaj/dmin, rem= dmaj - whole*dmin;
+	int initRun= whole/2+1;
+
+	li->wholeStep= whole;
+	li->adjUp= rem*2;
+	li->adjDown= dmin*2;
+	li->err= rem - dmin*2;
+	li->finalRun= initRun;
+
+	if(rem == 0 && (whole&1) == 0)
+		initRun--;
+	if(whole&1)
+		li->err += dmin;
+
+	li->run= initRun;
+	li->count= dmin+1;
+}
+
+//! Initialize a fixed-point DDA line iterator.
+/*!	The end points are .8f fixed point, with integer values at pixel 
+	centers. The line is sampled once per pixel along its major axis 
+	and rounded to the nearest pixel, with halves going away from the 
+	start, like LINE_ITER does. The minor coordinate is kept as a 
+	.16f value plus a remainder, so it doesn't drift: integer end 
+	points give the same pixels as LINE_ITER.
+*/
+void line_dda_init(LINE_DDA *ld, FIXED x1, FIXED y1, FIXED x2, FIXED y2)
+{
+	FIXED dx= x2-x1, dy= y2-y1;
+	FIXED maj1, maj2, min1, dmaj, dmin;
+
+	if(ABS(dx) >= ABS(dy))
+	{
+		ld->ymajor= FALSE;
+		maj1= x1;	maj2= x2;	min1= y1;	dmaj= dx;	dmin= dy;
+	}
+	else
+	{
+		ld->ymajor= TRUE;
+		maj1= y1;	maj2= y2;	min1= x1;	dmaj= dy;	dmin= dx;
+	}
+
+	// Round to nearest pixel along the major axis
+	int start= (maj1 + (FIXED)FIX_SCALE/2)>>FIX_SHIFT;
+	int end=   (maj2 + (FIXED)FIX_SCALE/2)>>FIX_SHIFT;
+	ld->major= start;
+	ld->step= (end<start) ? -1 : 1;
+	ld->count= ABS(end-start)+1;
+
+	// Work with the minor coordinate mirrored so that it goes up; 
+	// the rounding then sends halves away from the start either way.
+	ld->sign= 1;
+	if(dmin < 0)
+	{
+		ld->sign= -1;
+		dmin= -dmin;
+		min1= -min1;
+	}
+	int dir= dmaj < 0 ? -1 : 1;
+	dmaj= ABS(dmaj);
+	if(dmaj == 0)
+	{
+		ld->minor= (min1<<(16-FIX_SHIFT)) + (1<<15);
+		ld->inc= ld->adjUp= ld->err= 0;
+		ld->adjDown= 1;
+		return;
+	}
+
+	// Increment per pixel (.16f): dmin/dmaj as quotient and remainder.
+	s64 num= (s64)dmin<<16;
+	ld->inc= (FIXED)(num/dmaj);
+	ld->adjUp= (int)(num - (s64)ld->inc*dmaj);
+	ld->adjDown= dmaj;
+
+	// Minor coord at the first pixel, biased by a half so that the 
+	// shift in line_dda_next() rounds. Floored division for the 
+	// part from the end point to the pixel center.
+	FIXED ofs= ((start<<FIX_SHIFT) - maj1)*dir;
+	num= (s64)ofs*dmin<<(16-FIX_SHIFT);
+	FIXED quot= (FIXED)(num/dmaj);
+	int rem= (int)(num - (s64)quot*dmaj);
+	if(rem < 0)
+	{
+		quot--;
+		rem += dmaj;
+	}
+	ld->minor= (min1<<(16-FIX_SHIFT)) + (1<<15) + quot;
+	ld->err= rem;
+}
+
+
+// --- Number formatting ----------------------------------------------
+
+// Division by 10 without the division routine. Small values use
+// the reciprocal 52429/2^19, which is exact below 81920 and doesn't
+// overflow there. Larger ones multiply by 0.1 in shifts and adds,
+// which is exact for all of u32 after the final correction.
+
+//! Digits of \a value, with padding and sign; the workhorse.
+static int num_to_str(char *dst, u32 value, bool neg, uint width, char pad)
+{
+	char buf[10], *str= &buf[10];
+	u32 quot, rem;
+
+	while(value >= 81920)
+	{
+		quot= (value>>1) + (value>>2);
+		quot += quot>>4;
+		quot += quot>>8;
+		quot += quot>>16;
+		quot >>= 3;
+		rem= value - quot*10;
+		if(rem > 9)
+		{
+			quot++;
+			rem -= 10;
+		}
+		*--str= '0'+rem;
+		value= quot;
+	}
+
+	do
+	{
+		quot= value*FX_RECIPROCAL(10, 19) >> 19;
+		*--str= '0' + value-quot*10;
+		value= quot;
+	} while(value);
+
+	// Zeros go between sign and digits, anything else before the sign
+	char *dstL= dst;
+	uint len= &buf[10]-str + neg;
+
+	if(neg && pad == '0')
+		*dstL++= '-';
+	for( ; len<width; len++)
+		*dstL++= pad;
+	if(neg && pad != '0')
+		*dstL++= '-';
+	while(str < &buf[10])
+		*dstL++= *str++;
+	*dstL= '\0';
+
+	return dstL-dst;
+}
+
+//! Write \a value as a decimal string, without printf.
+/*!	\param dst		Destination; needs room for max(\a width, 10)+1 chars.
+	\param value	Value to write.
+	\param width	Minimum number of characters; padded on the left.
+	\param pad		Padding character; usually ' ' or '0'.
+	\return	Length of the string.
+*/
+int uint_to_str(char *dst, u32 value, uint width, char pad)
+{
+	return num_to_str(dst, value, false, width, pad);
+}
+
+//! Write signed \a value as a decimal string, without printf.
+/*!	Like uint_to_str(). Zero-padding goes after the minus sign, other
+	padding before it. \a dst needs room for max(\a width, 11)+1 chars.
+*/
+int int_to_str(char *dst, int value, uint width, char pad)
+{
+	return num_to_str(dst, value<0 ? -(u32)value : value, value<0, width, pad);
+}
+
+//! Write fixed-point \a value as a decimal string, without printf.
+/*!	\param dst		Destination; needs room for 13+\a decimals chars.
+	\param value	Value to write.
+	\param fbits	Number of fractional bits, up to 28. FIX_SHIFT for
+		the usual FIXED.
+	\param decimals	Number of decimals. These are cut off, not rounded.
+	\return	Length of the string.
+*/
+int fx_to_str(char *dst, FIXED value, uint fbits, uint decimals)
+{
+	u32 mag= value<0 ? -(u32)value : value;
+	char *str= dst;
+
+	str += num_to_str(str, mag>>fbits, value<0, 0, ' ');
+	if(decimals)
+	{
+		u32 mask= (1<<fbits)-1, frac= mag & mask;
+		*str++= '.';
+		while(decimals--)
+		{
+			frac *= 10;
+			*str++= '0' + (frac>>fbits);
+			frac &= mask;
+		}
+		*str= '\0';
+	}
+
+	return str-dst;
+}
+
+// EOF
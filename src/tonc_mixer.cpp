@@ -0,0 +1,371 @@
+//
+//  DirectSound software mixer
+//
+//! \file tonc_mixer.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Double buffering: each output buffer holds two frames. DMA runs
+	through both halves and is reset to the start at every other
+	VBlank. mix_frame() always fills the half that plays next.
+  * The DMA restart is the only thing that's timing-critical, which
+	is why mix_vblank() does nothing else.
+  * ADPCM voices play from their stream's buffer like any other
+	sample. Before each frame, the part already played is dropped and
+	enough is decoded to cover the frame; loops are handled by the
+	decoder, not the voice.
+*/
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_video.hpp"
+#include "tonc_math.hpp"
+#include "tonc_mixer.hpp"
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+TMixer gMixer;
+
+// Output buffers: two frames per channel.
+EWRAM_BSS static u32 __mix_bufL[MIX_BUFSIZE_MAX*2/4];
+EWRAM_BSS static u32 __mix_bufR[MIX_BUFSIZE_MAX*2/4];
+
+// Accumulator is hammered by mix_voice_add(); keep it in IWRAM.
+IWRAM_DATA static u32 __mix_acc[MIX_BUFSIZE_MAX];
+
+EWRAM_BSS static TMixStream __mix_streams[MIX_STREAMS];
+
+
+#define MIX_DMA_CNT	(DMA_DST_FIXED | DMA_REPEAT | DMA_32 | DMA_AT_FIFO | DMA_ENABLE)
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Point the FIFO DMAs at the start of the output buffers.
+INLINE void mix_dma_reset(void)
+{
+	REG_DMA1CNT= 0;
+	REG_DMA2CNT= 0;
+	REG_DMA1SAD= (u32)gMixer.bufL;
+	REG_DMA2SAD= (u32)gMixer.bufR;
+	REG_DMA1CNT= MIX_DMA_CNT;
+	REG_DMA2CNT= MIX_DMA_CNT;
+}
+
+//! Initialize the mixer and start output.
+/*!	\param bufsize	Samples per frame: MIX_10KHZ through MIX_21KHZ.
+		Other sizes work if they divide MIX_FRAME_CYCLES and are
+		multiples of 8.
+	\note	Waits for VBlank, so that the buffer swaps line up with
+		the frames.
+*/
+void mix_init(uint bufsize)
+{
+	if(bufsize > MIX_BUFSIZE_MAX)
+		bufsize= MIX_BUFSIZE_MAX;
+
+	REG_TM0CNT= 0;
+	REG_DMA1CNT= 0;
+	REG_DMA2CNT= 0;
+
+	gMixer.bufsize= bufsize;
+	gMixer.rate= (1<<24)/(MIX_FRAME_CYCLES/bufsize);
+	gMixer.shift= 6;
+	gMixer.active= 0;
+	gMixer.bufL= (s8*)__mix_bufL;
+	gMixer.bufR= (s8*)__mix_bufR;
+	mix_stop_all();
+
+	memset32(__mix_bufL, 0, sizeof(__mix_bufL)/4);
+	memset32(__mix_bufR, 0, sizeof(__mix_bufR)/4);
+
+	// Left on A, right on B, both on timer 0. Keep the DMG volume.
+	REG_SNDSTAT= SSTAT_ENABLE;
+	REG_SNDDSCNT= (REG_SNDDSCNT & 3) | SDS_A100 | SDS_B100
+		| SDS_AL | SDS_BR | SDS_ATMR0 | SDS_BTMR0 | SDS_ARESET | SDS_BRESET;
+
+	REG_DMA1DAD= (u32)&REG_FIFO_A;
+	REG_DMA2DAD= (u32)&REG_FIFO_B;
+
+	vid_vsync();
+	mix_dma_reset();
+	REG_TM0D= 0x10000 - MIX_FRAME_CYCLES/bufsize;
+	REG_TM0CNT= TM_ENABLE;
+}
+
+//! Stop all voices.
+void mix_stop_all(void)
+{
+	uint ii;
+
+	memset32(gMixer.voices, 0, sizeof(gMixer.voices)/4);
+	for(ii=0; ii<MIX_STREAMS; ii++)
+		__mix_streams[ii].smp= NULL;
+}
+
+//! Get a voice: \a voice itself, or the first free one if it's -1.
+static int mix_get_voice(int voice)
+{
+	if(voice < 0)
+	{
+		for(voice=0; voice<MIX_VOICES; voice++)
+			if(!gMixer.voices[voice].active)
+				break;
+		if(voice >= MIX_VOICES)
+			return -1;
+	}
+
+	// Stop it and free its stream.
+	TMixVoice *mv= &gMixer.voices[voice];
+	mv->active= 0;
+	if(mv->stream)
+	{
+		mv->stream->smp= NULL;
+		mv->stream= NULL;
+	}
+	return voice;
+}
+
+//! Decode up to \a count samples (even) of a stream into \a dst.
+/*!	\return	Number of samples decoded; less than \a count only at the
+		end of a non-looping sample.
+*/
+static uint mix_stream_decode(TMixStream *st, s8 *dst, uint count)
+{
+	const TAdpcmSample *smp= st->smp;
+	const u8 *end= smp->data + smp->length/2;
+	const u8 *loop= smp->loopLength ? end - smp->loopLength/2 : NULL;
+	const u8 *stop;
+	uint done=0, nn;
+
+	while(count-done >= 2)
+	{
+		if(st->src == loop)
+			st->loopState= st->state;
+
+		if(st->src >= end)
+		{
+			if(loop == NULL)
+				break;
+			st->src= loop;
+			st->state= st->loopState;
+			continue;
+		}
+
+		// Decode up to the loop start (to save the state) or the end.
+		stop= (loop && st->src < loop) ? loop : end;
+		nn= min((count-done)/2, stop - st->src);
+		st->src= adpcm_decode(&dst[done], st->src, nn, &st->state);
+		done += 2*nn;
+	}
+	return done;
+}
+
+//! Make sure a stream voice has the samples for the next \a count outputs.
+static void mix_stream_prep(TMixVoice *voice, uint count)
+{
+	TMixStream *st= voice->stream;
+	uint ii, first, need;
+
+	// Drop what has been played.
+	first= min(voice->pos>>MIX_POS_SHIFT, st->filled);
+	for(ii=first; ii<st->filled; ii++)
+		st->buffer[ii-first]= st->buffer[ii];
+	st->filled -= first;
+	voice->pos -= first<<MIX_POS_SHIFT;
+
+	// Decode up to the last sample this frame reads, plus a little.
+	need= ((voice->pos + voice->step*count)>>MIX_POS_SHIFT) + MIX_STREAM_AHEAD;
+	need= min(need, MIX_STREAM_SIZE);
+	if(need > st->filled)
+		st->filled += mix_stream_decode(st, &st->buffer[st->filled],
+			(need - st->filled + 1) &~ 1);
+
+	voice->end= st->filled<<MIX_POS_SHIFT;
+	voice->loopLength= 0;
+}
+
+//! Swap output buffers; call at the very start of VBlank.
+/*!	Put this in the VBlank isr (before anything slow), or directly
+	after VBlankIntrWait() if nothing else happens in between.
+*/
+void mix_vblank(void)
+{
+	if(gMixer.active)
+	{
+		mix_dma_reset();
+		gMixer.active= 0;
+	}
+	else
+		gMixer.active= 1;
+}
+
+//! Mix the next frame of audio.
+/*!	Call once per frame, any time after mix_vblank().
+*/
+void mix_frame(void)
+{
+	uint ii, left, count, nn= gMixer.bufsize;
+	u32 *acc;
+	TMixVoice *voice;
+
+	memset32(__mix_acc, 0, nn);
+
+	for(ii=0; ii<MIX_VOICES; ii++)
+	{
+		voice= &gMixer.voices[ii];
+		if(!voice->active || voice->step == 0)
+			continue;
+
+		if(voice->stream)
+			mix_stream_prep(voice, nn);
+
+		acc= __mix_acc;
+		left= nn;
+		while(left)
+		{
+			// Samples until the end: ceil((end-pos)/step).
+			count= (voice->end - voice->pos + voice->step-1)/voice->step;
+			if(count > left)
+				count= left;
+
+			voice->pos= mix_voice_add(acc, voice->data, voice->pos,
+				voice->step, count, voice->gains);
+			acc += count;
+			left -= count;
+
+			if(voice->pos >= voice->end)
+			{
+				if(voice->loopLength == 0)
+				{
+					mix_get_voice(ii);
+					break;
+				}
+				while(voice->pos >= voice->end)
+					voice->pos -= voice->loopLength;
+			}
+		}
+	}
+
+	uint half= gMixer.active ? 0 : nn;
+	mix_output(&gMixer.bufL[half], &gMixer.bufR[half], __mix_acc, nn,
+		gMixer.shift);
+}
+
+//! Start playing a sample.
+/*!	\param smp	Sample to play.
+	\param voice	Voice to use, or -1 for the first free one.
+	\param vol	Volume, 0-64.
+	\param pan	Panning, 0 (left) - 128 (right).
+	\return	Voice index, or -1 if all voices are busy.
+*/
+int mix_play(const TMixSample *smp, int voice, uint vol, uint pan)
+{
+	voice= mix_get_voice(voice);
+	if(voice < 0)
+		return -1;
+
+	TMixVoice *mv= &gMixer.voices[voice];
+
+	mv->data= smp->data;
+	mv->pos= 0;
+	mv->end= smp->length<<MIX_POS_SHIFT;
+	mv->loopLength= smp->loopLength<<MIX_POS_SHIFT;
+	mix_set_rate(voice, smp->rate);
+	mix_set_vol(voice, vol, pan);
+	mv->active= (mv->end > 0 && mv->step > 0);
+
+	return voice;
+}
+
+//! Start playing an ADPCM sample.
+/*!	\param smp	Sample to play.
+	\param voice	Voice to use, or -1 for the first free one.
+	\param vol	Volume, 0-64.
+	\param pan	Panning, 0 (left) - 128 (right).
+	\return	Voice index, or -1 if all voices or streams are busy.
+*/
+int mix_play_adpcm(const TAdpcmSample *smp, int voice, uint vol, uint pan)
+{
+	uint ii;
+	TMixStream *st= NULL;
+
+	// Stop the voice first; it may be holding the only free stream.
+	voice= mix_get_voice(voice);
+	if(voice < 0)
+		return -1;
+
+	for(ii=0; ii<MIX_STREAMS; ii++)
+	{
+		if(__mix_streams[ii].smp == NULL)
+		{
+			st= &__mix_streams[ii];
+			break;
+		}
+	}
+	if(st == NULL)
+		return -1;
+
+	st->smp= smp;
+	st->src= smp->data;
+	st->state.pred= smp->pred;
+	st->state.index= smp->index;
+	st->loopState= st->state;
+	st->filled= 0;
+
+	TMixVoice *mv= &gMixer.voices[voice];
+
+	mv->stream= st;
+	mv->data= st->buffer;
+	mv->pos= 0;
+	mv->end= 0;
+	mv->loopLength= 0;
+	mix_set_rate(voice, smp->rate);
+	mix_set_vol(voice, vol, pan);
+	mv->active= (smp->length > 0 && mv->step > 0);
+
+	return voice;
+}
+
+//! Stop a voice.
+void mix_stop(int voice)
+{
+	mix_get_voice(voice);
+}
+
+//! Set volume and panning of a voice.
+/*!	\param voice	Voice index.
+	\param vol	Volume, 0-64.
+	\param pan	Panning, 0 (left) - 128 (right). Both sides get full
+		volume at MIX_PAN_CENTER.
+*/
+void mix_set_vol(int voice, uint vol, uint pan)
+{
+	TMixVoice *mv= &gMixer.voices[voice];
+
+	vol= min(vol, MIX_VOL_MAX);
+	pan= min(pan, MIX_PAN_RIGHT);
+	mv->vol= vol;
+	mv->pan= pan;
+
+	u32 gl= vol*min(MIX_PAN_CENTER, MIX_PAN_RIGHT-pan)>>7;
+	u32 gr= vol*min(MIX_PAN_CENTER, pan)>>7;
+	mv->gains= gl | gr<<16;
+}
+
+//! Set the playback rate of a voice, in Hz.
+void mix_set_rate(int voice, uint rate)
+{
+	gMixer.voices[voice].step= (rate<<MIX_POS_SHIFT)/gMixer.rate;
+}
+
+// EOF
@@ -0,0 +1,215 @@
+//
+//  Palette animation
+//
+//! \file tonc_palanim.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Cycles work in place on the shadow palette, one color-shift per
+	step. That's O(n) per step, unlike clr_rotate().
+*/
+
+#include "tonc_memmap.hpp"
+#include "tonc_core.hpp"
+#include "tonc_video.hpp"
+#include "tonc_math.hpp"
+#include "tonc_palanim.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Initialize a palette animator.
+/*!	\param pa	Animator to initialize.
+	\param pal	Initial palette (512 colors). If NULL, the current
+		contents of palette memory are used.
+	\param ranges	Range descriptions; may be NULL.
+	\param count	Number of ranges.
+*/
+void panim_init(TPalAnim *pa, const COLOR *pal,
+	const TPalRange *ranges, uint count)
+{
+	memset32(pa->ranges, 0, sizeof(pa->ranges)/4);
+	memcpy32(pa->shadow, pal ? pal : pal_bg_mem, sizeof(pa->shadow)/4);
+	pa->count= 0;
+	pa->dirty= 0;
+
+	uint ii;
+	for(ii=0; ii<count; ii++)
+		panim_add(pa, &ranges[ii]);
+}
+
+//! Add a range to the animator.
+/*!	\return	Pointer to the animator's copy of the range, which can be
+		used to change speed, direction, etc. later; or NULL if all
+		PANIM_MAX slots are taken.
+	\note	Sweep ranges render their first frame right away.
+*/
+TPalRange *panim_add(TPalAnim *pa, const TPalRange *range)
+{
+	uint ii;
+	TPalRange *pr;
+
+	for(ii=0; ii<PANIM_MAX; ii++)
+	{
+		pr= &pa->ranges[ii];
+		if(pr->type != PA_OFF)
+			continue;
+
+		*pr= *range;
+		if(pr->dir == 0)
+			pr->dir= 1;
+		if(ii >= pa->count)
+			pa->count= ii+1;
+
+		if((pr->type & PA_TYPE_MASK) == PA_SWEEP)
+		{
+			pr->phase= min(pr->phase, PANIM_SWEEP_MAX);
+			COLOR ends[2];
+			clr_blend(&pr->clrs[0], &pr->clrs[2], ends, 2, pr->phase);
+			pal_gradient_ex(pa->shadow, pr->first, pr->first+pr->count-1,
+				ends[0], ends[1]);
+			panim_mark(pa, pr->first, pr->count);
+		}
+		return pr;
+	}
+	return NULL;
+}
+
+//! Stop and remove a range.
+/*!	The colors stay as they are.
+*/
+void panim_remove(TPalAnim *pa, TPalRange *range)
+{
+	range->type= PA_OFF;
+	while(pa->count > 0 && pa->ranges[pa->count-1].type == PA_OFF)
+		pa->count--;
+}
+
+//! Rotate \a count colors at \a clrs by one, in direction \a dir.
+static void panim_shift(COLOR *clrs, uint count, int dir)
+{
+	uint ii;
+	COLOR tmp;
+
+	if(dir > 0)
+	{
+		tmp= clrs[count-1];
+		for(ii=count-1; ii>0; ii--)
+			clrs[ii]= clrs[ii-1];
+		clrs[0]= tmp;
+	}
+	else
+	{
+		tmp= clrs[0];
+		for(ii=0; ii<count-1; ii++)
+			clrs[ii]= clrs[ii+1];
+		clrs[count-1]= tmp;
+	}
+}
+
+//! Advance all ranges by one frame.
+/*!	Only updates the shadow palette; the changes go to palette
+	memory with panim_commit().
+*/
+void panim_update(TPalAnim *pa)
+{
+	uint ii, steps, last;
+	TPalRange *pr;
+
+	for(ii=0; ii<pa->count; ii++)
+	{
+		pr= &pa->ranges[ii];
+		if(pr->type == PA_OFF || pr->count < 2)
+			continue;
+
+		pr->acc += pr->speed;
+		steps= pr->acc>>8;
+		pr->acc &= 0xFF;
+		if(steps == 0)
+			continue;
+
+		switch(pr->type & PA_TYPE_MASK)
+		{
+		case PA_CYCLE:
+			// Ping-pong: phase counts the steps since the last turn.
+			last= pr->count-1;
+			while(steps--)
+			{
+				if(pr->type & PA_PINGPONG)
+				{
+					if(pr->phase >= last)
+					{
+						pr->dir= -pr->dir;
+						pr->phase= 0;
+					}
+					pr->phase++;
+				}
+				panim_shift(&pa->shadow[pr->first], pr->count, pr->dir);
+			}
+			break;
+
+		case PA_SWEEP:
+		{
+			int phase= pr->phase + pr->dir*(int)steps;
+			if(phase > PANIM_SWEEP_MAX || phase < 0)
+			{
+				if(pr->type & PA_PINGPONG)
+				{
+					phase= phase < 0 ? -phase : 2*PANIM_SWEEP_MAX-phase;
+					pr->dir= -pr->dir;
+				}
+				phase= clamp(phase, 0, PANIM_SWEEP_MAX+1);
+			}
+			if(phase == pr->phase)
+				continue;
+			pr->phase= phase;
+
+			COLOR ends[2];
+			clr_blend(&pr->clrs[0], &pr->clrs[2], ends, 2, phase);
+			pal_gradient_ex(pa->shadow, pr->first, pr->first+pr->count-1,
+				ends[0], ends[1]);
+			break;
+		}
+
+		default:
+			continue;
+		}
+
+		panim_mark(pa, pr->first, pr->count);
+	}
+}
+
+//! Copy the changed banks of the shadow palette to palette memory.
+/*!	Runs of adjacent banks are copied in one go. Call in VBlank.
+*/
+void panim_commit(TPalAnim *pa)
+{
+	u32 dirty= pa->dirty;
+	uint bank=0, start;
+
+	pa->dirty= 0;
+	while(dirty)
+	{
+		if(~dirty & 1)
+		{
+			dirty >>= 1;
+			bank++;
+			continue;
+		}
+
+		start= bank;
+		while(dirty & 1)
+		{
+			dirty >>= 1;
+			bank++;
+		}
+		memcpy32(&pal_bg_mem[start*16], &pa->shadow[start*16],
+			(bank-start)*16/2);
+	}
+}
+
+// EOF
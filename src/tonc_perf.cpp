@@ -0,0 +1,324 @@
+//
+//  Performance overlay
+//
+//! \file tonc_perf.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Object tiles are in a 2D grid of 32 tiles per row unless
+	DCNT_OBJ_1D is set; perf_init() checks, so set the mapping first.
+  * IRQ time is measured around each hooked isr. With nested
+	interrupts, a nested isr counts for both.
+*/
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_bios.hpp"
+#include "tonc_irq.hpp"
+#include "tonc_math.hpp"
+#include "tonc_oam.hpp"
+#include "tonc_video.hpp"
+#include "tonc_tte.hpp"
+#include "tonc_perf.hpp"
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+TPerf gPerf;
+
+//! sys8Font in 4bpp tiles: paper and ink.
+EWRAM_BSS static TILE __perf_glyphs[96];
+
+//! Original isrs, for the hooks.
+static fnptr __perf_isrs[II_MAX];
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+// --- IRQ hooks ------------------------------------------------------
+
+#define PERF_ISR(n)														\
+static void perf_isr_##n(void)											\
+{																		\
+	u32 start= perf_ticks();											\
+	__perf_isrs[n]();													\
+	gPerf.irq += (u16)(perf_ticks() - start);							\
+}
+
+PERF_ISR(0)		PERF_ISR(1)		PERF_ISR(2)		PERF_ISR(3)
+PERF_ISR(4)		PERF_ISR(5)		PERF_ISR(6)		PERF_ISR(7)
+PERF_ISR(8)		PERF_ISR(9)		PERF_ISR(10)	PERF_ISR(11)
+PERF_ISR(12)	PERF_ISR(13)
+
+static const fnptr __perf_hooks[II_MAX]=
+{
+	perf_isr_0, perf_isr_1, perf_isr_2, perf_isr_3,
+	perf_isr_4, perf_isr_5, perf_isr_6, perf_isr_7,
+	perf_isr_8, perf_isr_9, perf_isr_10, perf_isr_11,
+	perf_isr_12, perf_isr_13
+};
+
+//! Time the isr of \a irq as IRQ time.
+/*!	Call after the isr is set with irq_add() or irq_set(); setting it
+	again removes the hook.
+	\return	true if there was an isr to hook.
+*/
+BOOL perf_irq_hook(enum eIrqIndex irq)
+{
+	IRQ_REC *pir;
+	BOOL found= false;
+
+	u16 ime= REG_IME;
+	REG_IME= 0;
+
+	for(pir= __isr_table; pir->flag; pir++)
+	{
+		if(pir->flag != (u32)BIT(irq) || pir->isr == NULL)
+			continue;
+
+		if(pir->isr != __perf_hooks[irq])
+		{
+			__perf_isrs[irq]= pir->isr;
+			pir->isr= __perf_hooks[irq];
+		}
+		found= true;
+		break;
+	}
+
+	REG_IME= ime;
+	return found;
+}
+
+
+// --- Drawing --------------------------------------------------------
+
+//! Fill \a height tile rows of 8 tiles with \a clr.
+static void perf_fill(TILE *tile, uint height, uint clr)
+{
+	uint iy;
+
+	for(iy=0; iy<height; iy++)
+		memset32(&tile[iy*gPerf.stride], quad8(clr*0x11), 8*8);
+}
+
+//! Put character \a ch at column \a ix of line \a iy.
+INLINE void perf_putc(TPerf *pf, uint ix, uint iy, uint ch)
+{
+	ch -= sys8Font.charOffset;
+	if(ch >= sys8Font.charCount)
+		ch= 0;
+	pf->text[iy*pf->stride + ix]= __perf_glyphs[ch];
+}
+
+//! Write the first three characters of \a name, padded.
+static void perf_fmt_name(char *str, const char *name)
+{
+	uint ii;
+
+	for(ii=0; ii<3; ii++)
+		str[ii]= (name && *name) ? *name++ : ' ';
+}
+
+//! Write per mille \a pm as "dd.d%".
+static void perf_fmt_pm(char *str, uint pm)
+{
+	if(pm > 999)
+		pm= 999;
+
+	str[0]= pm >= 100 ? '0' + pm/100 : ' ';
+	str[1]= '0' + pm/10%10;
+	str[2]= '.';
+	str[3]= '0' + pm%10;
+	str[4]= '%';
+}
+
+//! Draw text line \a line.
+static void perf_draw_line(TPerf *pf, uint line)
+{
+	char str[PERF_COLS];
+	uint ii, count;
+
+	switch(line)
+	{
+	case 0:
+		perf_fmt_name(str, "cpu");
+		perf_fmt_pm(&str[3], pf->cpuShown);
+		break;
+
+	case 1:
+		perf_fmt_name(str, "irq");
+		perf_fmt_pm(&str[3], pf->irqShown);
+		break;
+
+	case 2:
+		perf_fmt_name(str, "ovr");
+		count= min(pf->overruns, 99999);
+		for(ii=PERF_COLS-1; ii>=3; ii--)
+		{
+			str[ii]= (count || ii == PERF_COLS-1) ? '0' + count%10 : ' ';
+			count /= 10;
+		}
+		break;
+
+	default:
+		{
+			TPerfScope *ps= &pf->scopes[line-3];
+			perf_fmt_name(str, ps->name);
+			if(ps->name)
+				perf_fmt_pm(&str[3], ps->shown);
+			else
+				for(ii=3; ii<PERF_COLS; ii++)
+					str[ii]= ' ';
+		}
+	}
+
+	for(ii=0; ii<PERF_COLS; ii++)
+		perf_putc(pf, ii, line, str[ii]);
+}
+
+//! Draw graph column \a ix: a bar \a height high.
+static void perf_draw_column(TPerf *pf, uint ix, uint height, uint clr)
+{
+	uint iy, shift= (ix&7)*4;
+	u32 mask= ~(15<<shift);
+	TILE *tile= &pf->graph[ix>>3];
+
+	for(iy=0; iy<PERF_GRAPH_H; iy++)
+	{
+		u32 *row= &tile[(iy>>3)*pf->stride].data[iy&7];
+		uint pixel= iy >= PERF_GRAPH_H-height ? clr : PERF_CLR_PAPER;
+
+		*row= (*row & mask) | pixel<<shift;
+	}
+}
+
+
+// --- Interface ------------------------------------------------------
+
+//! Set up the overlay and start the clock.
+/*!	\param obj	Two objects for the overlay, usually in an OAM buffer.
+	\param tid	First object tile; uses PERF_TILES tiles (in 1D
+		mapping), or a 16x8 tile block in 2D.
+	\param pb	Object palette bank; colors 1-4 are set.
+	\param x	Left of the overlay.
+	\param y	Top of the overlay; it's 96 pixels high.
+	\note	Uses timer PERF_TIMER (1 by default).
+*/
+void perf_init(OBJ_ATTR *obj, uint tid, uint pb, int x, int y)
+{
+	TPerf *pf= &gPerf;
+	const TFont *font= &sys8Font;
+	BUP bup= { (u16)(font->charCount*font->cellSize), 1, 4,
+		(u32)BUP_ALL_OFS | PERF_CLR_PAPER };
+	bool map1D= REG_DISPCNT & DCNT_OBJ_1D;
+
+	memset32(pf, 0, sizeof(TPerf)/4);
+
+	// 0 -> paper, 1 -> ink.
+	bup_unpack(font->data, __perf_glyphs, &bup);
+
+	pal_obj_bank[pb][PERF_CLR_PAPER]= RGB15(2, 2, 8);
+	pal_obj_bank[pb][PERF_CLR_INK]= CLR_WHITE;
+	pal_obj_bank[pb][PERF_CLR_OK]= CLR_LIME;
+	pal_obj_bank[pb][PERF_CLR_OVER]= CLR_RED;
+
+	pf->obj= obj;
+	pf->stride= map1D ? 8 : 32;
+	pf->text= &tile_mem_obj[0][tid];
+	pf->graph= &tile_mem_obj[0][tid + (map1D ? 64 : 8)];
+	perf_fill(pf->text, PERF_LINES, PERF_CLR_PAPER);
+	perf_fill(pf->graph, PERF_GRAPH_H/8, PERF_CLR_PAPER);
+
+	obj_set_attr(&obj[0], ATTR0_SQUARE, ATTR1_SIZE_64,
+		ATTR2_ID(tid) | ATTR2_PALBANK(pb));
+	obj_set_attr(&obj[1], ATTR0_WIDE, ATTR1_SIZE_64x32,
+		ATTR2_ID(tid + (map1D ? 64 : 8)) | ATTR2_PALBANK(pb));
+	obj_set_pos(&obj[0], x, y);
+	obj_set_pos(&obj[1], x, y+64);
+	pf->visible= true;
+
+	REG_TM[PERF_TIMER].cnt= 0;
+	REG_TM[PERF_TIMER].start= 0;
+	REG_TM[PERF_TIMER].cnt= TM_FREQ_64 | TM_ENABLE;
+	pf->frameStart= pf->idle= perf_ticks();
+}
+
+//! Show or hide the overlay. Hidden, it only keeps counting.
+void perf_show(bool show)
+{
+	TPerf *pf= &gPerf;
+
+	pf->visible= show;
+	if(show)
+	{
+		obj_unhide(&pf->obj[0], 0);
+		obj_unhide(&pf->obj[1], 0);
+	}
+	else
+	{
+		obj_hide(&pf->obj[0]);
+		obj_hide(&pf->obj[1]);
+	}
+}
+
+//! Close the frame and update the overlay; call right after VBlank.
+/*!	perf_vsync() does this for you. Measures the frame since the last
+	call, counts missed VBlanks and redraws one line and one graph
+	column.
+*/
+void perf_frame(void)
+{
+	TPerf *pf= &gPerf;
+	u32 now= perf_ticks(), len, busy;
+	uint ii;
+
+	len= (u16)(now - pf->frameStart);
+	busy= (u16)(pf->idle - pf->frameStart);
+	if(busy > len)			// No perf_idle() this frame.
+		busy= len;
+	pf->frameStart= now;
+
+	if(len > PERF_FRAME_TICKS*3/2)
+		pf->overruns += (len + PERF_FRAME_TICKS/2)/PERF_FRAME_TICKS - 1;
+	pf->busy += busy;
+	pf->total += len;
+
+	// Close the window: averages for the text.
+	if(++pf->frames >= PERF_REFRESH)
+	{
+		u32 total= max(pf->total, 1);
+
+		pf->cpuShown= pf->busy*1000/total;
+		pf->irqShown= pf->irq*1000/total;
+		for(ii=0; ii<PERF_SCOPES; ii++)
+		{
+			pf->scopes[ii].shown= pf->scopes[ii].sum*1000/total;
+			pf->scopes[ii].sum= 0;
+		}
+		pf->busy= pf->total= pf->irq= 0;
+		pf->frames= 0;
+	}
+
+	if(pf->visible)
+	{
+		uint height= busy*PERF_GRAPH_H/PERF_FRAME_TICKS;
+		perf_draw_column(pf, pf->column, min(height, PERF_GRAPH_H),
+			len > PERF_FRAME_TICKS*3/2 ? PERF_CLR_OVER : PERF_CLR_OK);
+		pf->column= (pf->column+1) % PERF_GRAPH_W;
+
+		perf_draw_line(pf, pf->line);
+		pf->line= (pf->line+1) % PERF_LINES;
+	}
+
+	pf->self= (u16)(perf_ticks() - now);
+}
+
+// EOF
@@ -0,0 +1,704 @@
+//
+//  Save memory: SRAM, Flash and EEPROM
+//
+//! \file tonc_save.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Slot layout: header (16 bytes), then the data. Writes go in the
+	order data, header; since writes happen in whole units (a byte;
+	an 8-byte EEPROM block; a 128-byte Atmel page), the unit with the
+	header goes last, data and all.
+  * Only the sectors a commit needs are erased. Padding in the last
+	unit is 0xFF, which is also what Flash skips programming.
+  * Checksum: two running sums, Fletcher-style but mod 2^32. Cheap,
+	and order-sensitive enough to catch torn or shifted writes.
+*/
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_math.hpp"
+#include "tonc_save.hpp"
+
+#if !defined(__arm__)
+#include <stdio.h>
+#endif
+
+
+// --------------------------------------------------------------------
+// CONSTANTS
+// --------------------------------------------------------------------
+
+
+#define SAVE_FLASH_SECTOR	0x1000
+#define SAVE_CHUNK			128		// Largest write unit (Atmel page).
+
+#define FLASH_ATMEL_64K		0x3D1F
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+TSave gSave;
+
+
+// --------------------------------------------------------------------
+// BACKENDS
+// --------------------------------------------------------------------
+
+
+#if defined(__arm__)
+
+// --- Cartridge ------------------------------------------------------
+
+#define flash_mem		((vu8*)MEM_SRAM)
+#define eeprom_mem		((vu16*)0x0DFFFF00)	// Fine for any ROM size.
+
+//! Send a Flash command.
+static void flash_cmd(uint cmd)
+{
+	flash_mem[0x5555]= 0xAA;
+	flash_mem[0x2AAA]= 0x55;
+	flash_mem[0x5555]= cmd;
+}
+
+//! Select the 64 KiB bank for \a ofs on 128 KiB Flash.
+static void flash_bank(uint ofs)
+{
+	if(gSave.type == SAVE_FLASH_128K)
+	{
+		flash_cmd(0xB0);
+		flash_mem[0]= ofs>>16;
+	}
+}
+
+//! Get the Flash manufacturer and device id.
+static uint flash_get_id(void)
+{
+	uint id;
+
+	flash_cmd(0x90);
+	id= flash_mem[0] | flash_mem[1]<<8;
+	flash_cmd(0xF0);
+	flash_mem[0]= 0xF0;		// Some 128K chips want this one as well.
+
+	return id;
+}
+
+//! Wait for a Flash write to land.
+static BOOL flash_wait(uint addr, uint value)
+{
+	uint timeout= 0x10000;
+
+	while(flash_mem[addr] != value)
+		if(--timeout == 0)
+			return false;
+
+	return true;
+}
+
+//! Send or receive an EEPROM bit stream; must not be interrupted.
+static void eeprom_dma(void *dst, const void *src, uint count)
+{
+	u16 ime= REG_IME;
+
+	REG_IME= 0;
+	dma_cpy(dst, src, count, 3, DMA_CPY16);
+	REG_IME= ime;
+}
+
+//! Put the request bits and unit address for an EEPROM transfer.
+static u16 *eeprom_request(u16 *bits, uint req, uint unit)
+{
+	int ii= gSave.type == SAVE_EEPROM_512 ? 6 : 14;
+
+	*bits++= req>>1;
+	*bits++= req&1;
+	while(--ii >= 0)
+		*bits++= (unit>>ii)&1;
+
+	return bits;
+}
+
+//! Read 8 bytes from EEPROM.
+static void eeprom_read_unit(uint unit, u8 *dst)
+{
+	u16 bits[68], *end;
+	uint ii, jj, byte;
+
+	end= eeprom_request(bits, 3, unit);
+	*end++= 0;
+	eeprom_dma((void*)eeprom_mem, bits, end-bits);
+	eeprom_dma(bits, (const void*)eeprom_mem, 68);
+
+	// 4 junk bits, then 64 data bits; high bit first.
+	for(ii=0; ii<8; ii++)
+	{
+		byte= 0;
+		for(jj=0; jj<8; jj++)
+			byte= byte<<1 | (bits[4+ii*8+jj]&1);
+		dst[ii]= byte;
+	}
+}
+
+//! Start writing 8 bytes to EEPROM.
+static void eeprom_write_unit(uint unit, const u8 *src)
+{
+	u16 bits[81], *end;
+	uint ii;
+	int jj;
+
+	end= eeprom_request(bits, 2, unit);
+	for(ii=0; ii<8; ii++)
+		for(jj=7; jj>=0; jj--)
+			*end++= (src[ii]>>jj)&1;
+	*end++= 0;
+	eeprom_dma((void*)eeprom_mem, bits, end-bits);
+}
+
+//! Open the backend; for Flash, that means getting the chip id.
+static void save_raw_open(void)
+{
+	if(gSave.type == SAVE_FLASH_64K || gSave.type == SAVE_FLASH_128K)
+		gSave.flashId= flash_get_id();
+}
+
+//! Read from save memory.
+static void save_raw_read(uint ofs, u8 *dst, uint size)
+{
+	uint ii, nn;
+	u8 unit[8];
+
+	switch(gSave.type)
+	{
+	case SAVE_SRAM:
+		for(ii=0; ii<size; ii++)
+			dst[ii]= sram_mem[ofs+ii];
+		break;
+
+	case SAVE_FLASH_64K:
+	case SAVE_FLASH_128K:
+		while(size)
+		{
+			flash_bank(ofs);
+			nn= min(size, 0x10000-(ofs&0xFFFF));
+			for(ii=0; ii<nn; ii++)
+				*dst++= flash_mem[(ofs+ii)&0xFFFF];
+			ofs += nn;
+			size -= nn;
+		}
+		break;
+
+	case SAVE_EEPROM_512:
+	case SAVE_EEPROM_8K:
+		while(size)
+		{
+			eeprom_read_unit(ofs>>3, unit);
+			nn= min(size, 8-(ofs&7));
+			for(ii=0; ii<nn; ii++)
+				*dst++= unit[(ofs&7)+ii];
+			ofs += nn;
+			size -= nn;
+		}
+		break;
+	}
+}
+
+//! Write one chunk: any size for SRAM and Flash, a unit otherwise.
+/*!	Chunks don't cross a Flash bank.
+*/
+static BOOL save_raw_write(uint ofs, const u8 *src, uint size)
+{
+	uint ii;
+
+	switch(gSave.type)
+	{
+	case SAVE_SRAM:
+		for(ii=0; ii<size; ii++)
+			sram_mem[ofs+ii]= src[ii];
+		break;
+
+	case SAVE_FLASH_64K:
+	case SAVE_FLASH_128K:
+		flash_bank(ofs);
+		ofs &= 0xFFFF;
+		if(gSave.flashId == FLASH_ATMEL_64K)
+		{
+			// Atmel: whole pages, no erase.
+			flash_cmd(0xA0);
+			for(ii=0; ii<size; ii++)
+				flash_mem[ofs+ii]= src[ii];
+			return flash_wait(ofs+size-1, src[size-1]);
+		}
+		for(ii=0; ii<size; ii++)
+		{
+			if(src[ii] == 0xFF)		// Already erased.
+				continue;
+			flash_cmd(0xA0);
+			flash_mem[ofs+ii]= src[ii];
+			if(!flash_wait(ofs+ii, src[ii]))
+				return false;
+		}
+		break;
+
+	case SAVE_EEPROM_512:
+	case SAVE_EEPROM_8K:
+		eeprom_write_unit(ofs>>3, src);
+		break;
+	}
+	return true;
+}
+
+//! Start erasing the Flash sector at \a ofs.
+static void save_raw_erase(uint ofs)
+{
+	flash_bank(ofs);
+	flash_cmd(0x80);
+	flash_mem[0x5555]= 0xAA;
+	flash_mem[0x2AAA]= 0x55;
+	flash_mem[ofs&0xFFFF]= 0x30;
+}
+
+//! Check if the chip is still busy with an erase at \a ofs or an
+//! EEPROM write.
+static BOOL save_raw_busy(uint ofs)
+{
+	switch(gSave.type)
+	{
+	case SAVE_FLASH_64K:
+	case SAVE_FLASH_128K:
+		return flash_mem[ofs&0xFFFF] != 0xFF;
+
+	case SAVE_EEPROM_512:
+	case SAVE_EEPROM_8K:
+		return !(*eeprom_mem & 1);
+	}
+	return false;
+}
+
+#else
+
+// --- Host: RAM image mirrored to a file -----------------------------
+
+static u8 __save_image[0x20000];
+static FILE *__save_file= NULL;
+
+static void save_raw_open(void)
+{
+	if(__save_file)
+		fclose(__save_file);
+
+	toncset(__save_image, 0xFF, gSave.size);
+	__save_file= fopen(SAVE_HOST_FILE, "r+b");
+	if(__save_file)
+		fread(__save_image, 1, gSave.size, __save_file);
+	else
+		__save_file= fopen(SAVE_HOST_FILE, "w+b");
+}
+
+static void save_raw_flush(uint ofs, uint size)
+{
+	if(__save_file == NULL)
+		return;
+
+	fseek(__save_file, ofs, SEEK_SET);
+	fwrite(&__save_image[ofs], 1, size, __save_file);
+	fflush(__save_file);
+}
+
+static void save_raw_read(uint ofs, u8 *dst, uint size)
+{
+	tonccpy(dst, &__save_image[ofs], size);
+}
+
+static BOOL save_raw_write(uint ofs, const u8 *src, uint size)
+{
+	tonccpy(&__save_image[ofs], src, size);
+	save_raw_flush(ofs, size);
+	return true;
+}
+
+static void save_raw_erase(uint ofs)
+{
+	toncset(&__save_image[ofs], 0xFF, SAVE_FLASH_SECTOR);
+	save_raw_flush(ofs, SAVE_FLASH_SECTOR);
+}
+
+static BOOL save_raw_busy(uint ofs)
+{
+	return false;
+}
+
+#endif
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Detect the save type.
+/*!	Probes for SRAM, then for Flash.
+	\param fallback	Type to return if neither responds; SAVE_NONE,
+		or an EEPROM type if the game uses EEPROM.
+	\return	Save type.
+	\note	The SRAM probe flips one byte and puts it back. Flash
+		commands are only sent if that doesn't stick, because on SRAM
+		they'd overwrite the first slot's header.
+*/
+uint save_detect(uint fallback)
+{
+#if defined(__arm__)
+	u8 old;
+
+	// SRAM if a write sticks; Flash ignores lone writes.
+	old= sram_mem[0x7FFF];
+	sram_mem[0x7FFF]= ~old;
+	if(sram_mem[0x7FFF] == (u8)~old)
+	{
+		sram_mem[0x7FFF]= old;
+		return SAVE_SRAM;
+	}
+
+	switch(flash_get_id())
+	{
+	case 0xD4BF: case 0x1CC2: case 0x1B32: case FLASH_ATMEL_64K:
+		return SAVE_FLASH_64K;
+	case 0x09C2: case 0x1362:
+		return SAVE_FLASH_128K;
+	}
+
+	return fallback;
+#else
+	return fallback != SAVE_NONE ? fallback : SAVE_SRAM;
+#endif
+}
+
+//! Read a slot header; true if it's a valid one.
+static BOOL save_read_header(uint slot, TSaveHeader *hdr)
+{
+	save_raw_read(slot*gSave.slotSize, (u8*)hdr, sizeof(TSaveHeader));
+
+	return hdr->magic == SAVE_MAGIC && hdr->size <= save_max_size();
+}
+
+//! Set up the save system for \a type and find the latest save.
+/*!	\return	true if \a type is usable.
+*/
+BOOL save_init(uint type)
+{
+	TSave *sv= &gSave;
+	TSaveHeader hdr;
+	uint ii;
+
+	toncset(sv, 0, sizeof(TSave));
+	sv->type= type;
+	sv->slot= SAVE_SLOT_NONE;
+	sv->unit= 1;
+
+	switch(type)
+	{
+	case SAVE_SRAM:			sv->size= 0x8000;		break;
+	case SAVE_FLASH_64K:	sv->size= 0x10000;		break;
+	case SAVE_FLASH_128K:	sv->size= 0x20000;		break;
+	case SAVE_EEPROM_512:	sv->size= 0x200;	sv->unit= 8;	break;
+	case SAVE_EEPROM_8K:	sv->size= 0x2000;	sv->unit= 8;	break;
+	default:
+		sv->type= SAVE_NONE;
+		return false;
+	}
+	sv->slotSize= sv->size/2;
+
+	save_raw_open();
+	if(sv->flashId == FLASH_ATMEL_64K)
+		sv->unit= SAVE_CHUNK;
+
+	for(ii=0; ii<2; ii++)
+	{
+		if(!save_read_header(ii, &hdr))
+			continue;
+		if(sv->slot == SAVE_SLOT_NONE || (s32)(hdr.seq - sv->seq) > 0)
+		{
+			sv->slot= ii;
+			sv->seq= hdr.seq;
+		}
+	}
+
+	return true;
+}
+
+//! Add \a size bytes to the running sums.
+static void save_sum(u32 *sumA, u32 *sumB, const u8 *src, uint size)
+{
+	u32 aa= *sumA, bb= *sumB;
+
+	while(size--)
+	{
+		aa += *src++;
+		bb += aa;
+	}
+	*sumA= aa;
+	*sumB= bb;
+}
+
+//! Checksum of a block, as stored in the slot header.
+u32 save_checksum(const void *src, uint size)
+{
+	u32 aa=0, bb=0;
+
+	save_sum(&aa, &bb, (const u8*)src, size);
+	return aa ^ (bb<<16 | bb>>16);
+}
+
+//! Load and check the data of \a slot.
+static BOOL save_load_slot(uint slot, u8 *dst, uint size, const TSaveHeader *hdr)
+{
+	u8 buf[64];
+	u32 aa=0, bb=0;
+	uint ofs= slot*gSave.slotSize + SAVE_HEADER_SIZE, pos, nn;
+
+	size= min(size, hdr->size);
+	save_raw_read(ofs, dst, size);
+	save_sum(&aa, &bb, dst, size);
+
+	// The rest only counts for the checksum.
+	for(pos=size; pos<hdr->size; pos += nn)
+	{
+		nn= min(sizeof(buf), hdr->size-pos);
+		save_raw_read(ofs+pos, buf, nn);
+		save_sum(&aa, &bb, buf, nn);
+	}
+
+	return hdr->check == (aa ^ (bb<<16 | bb>>16));
+}
+
+//! Load the latest good save.
+/*!	If the latest save is damaged, the one before it is used.
+	\param dst	Destination.
+	\param size	Size of \a dst. If the save is smaller, only that
+		much is loaded.
+	\return	Bytes loaded, or -1 if there's no good save.
+*/
+int save_load(void *dst, uint size)
+{
+	TSave *sv= &gSave;
+	TSaveHeader hdrs[2];
+	uint ii, slot, first;
+	BOOL valid[2];
+
+	if(sv->type == SAVE_NONE)
+		return -1;
+
+	for(ii=0; ii<2; ii++)
+		valid[ii]= save_read_header(ii, &hdrs[ii]);
+
+	// A slot that's being written doesn't count.
+	if(save_busy())
+		valid[sv->base/sv->slotSize]= false;
+
+	first= sv->slot != SAVE_SLOT_NONE ? sv->slot : 0;
+	for(ii=0; ii<2; ii++)
+	{
+		slot= first^ii;
+		if(!valid[slot] || !save_load_slot(slot, (u8*)dst, size, &hdrs[slot]))
+			continue;
+
+		// The next commit should overwrite the other one.
+		sv->slot= slot;
+		sv->seq= hdrs[slot].seq;
+		return min(size, hdrs[slot].size);
+	}
+
+	return -1;
+}
+
+//! Start a journaled write of \a src; returns at once.
+/*!	The data goes to the slot not holding the latest save; see
+	save_update() for the actual work.
+	\return	false if a commit is already running or the data doesn't
+		fit (see save_max_size()).
+*/
+BOOL save_commit(const void *src, uint size)
+{
+	TSave *sv= &gSave;
+
+	if(sv->type == SAVE_NONE || save_busy() || size > save_max_size())
+		return false;
+
+	sv->src= (const u8*)src;
+	sv->hdr.magic= SAVE_MAGIC;
+	sv->hdr.seq= sv->slot != SAVE_SLOT_NONE ? sv->seq+1 : 1;
+	sv->hdr.size= size;
+	sv->hdr.check= 0;
+	sv->base= sv->slot == 0 ? sv->slotSize : 0;
+	sv->pos= 0;
+	sv->sumA= sv->sumB= 0;
+	sv->state= SAVE_SUM;
+
+	return true;
+}
+
+//! Get bytes [\a ofs, \a ofs+\a size) of the slot image being written.
+static void save_image(u8 *dst, uint ofs, uint size)
+{
+	const TSave *sv= &gSave;
+	uint ii;
+
+	for(ii=ofs; ii<ofs+size; ii++)
+	{
+		if(ii < SAVE_HEADER_SIZE)
+			*dst++= ((const u8*)&sv->hdr)[ii];
+		else if(ii < SAVE_HEADER_SIZE + sv->hdr.size)
+			*dst++= sv->src[ii-SAVE_HEADER_SIZE];
+		else
+			*dst++= 0xFF;
+	}
+}
+
+//! Write up to \a budget bytes; the header's unit goes last.
+static void save_write_step(uint budget)
+{
+	TSave *sv= &gSave;
+	uint unit= sv->unit;
+	uint hdrEnd= align(SAVE_HEADER_SIZE, unit);
+	uint end= align(SAVE_HEADER_SIZE + sv->hdr.size, unit);
+	uint ofs, nn;
+	u8 buf[SAVE_CHUNK];
+
+	while(sv->pos < end)
+	{
+		if(unit == 8 && save_raw_busy(0))
+			return;
+
+		// Start after the header unit, wrap around to it at the end.
+		ofs= sv->pos + hdrEnd;
+		if(ofs >= end)
+			ofs -= end;
+
+		if(unit > 1)
+			nn= unit;
+		else
+			nn= min(min(budget, SAVE_CHUNK), min(end-ofs, end-sv->pos));
+
+		save_image(buf, ofs, nn);
+		if(!save_raw_write(sv->base+ofs, buf, nn))
+		{
+			sv->state= SAVE_ERROR;
+			return;
+		}
+		sv->pos += nn;
+
+		if(nn >= budget)
+			return;
+		budget -= nn;
+	}
+
+	sv->pos= 0;
+	sv->state= SAVE_VERIFY;
+}
+
+//! Read back up to 4*\a budget bytes and compare.
+static void save_verify_step(uint budget)
+{
+	TSave *sv= &gSave;
+	uint end= SAVE_HEADER_SIZE + sv->hdr.size, nn, ii;
+	u8 buf[64], ref[64];
+
+	if(sv->unit == 8 && save_raw_busy(0))
+		return;
+
+	for(budget *= 4; budget && sv->pos < end; budget -= min(budget, nn))
+	{
+		nn= min(sizeof(buf), end-sv->pos);
+		save_raw_read(sv->base+sv->pos, buf, nn);
+		save_image(ref, sv->pos, nn);
+		for(ii=0; ii<nn; ii++)
+		{
+			if(buf[ii] != ref[ii])
+			{
+				sv->state= SAVE_ERROR;
+				return;
+			}
+		}
+		sv->pos += nn;
+	}
+
+	if(sv->pos >= end)
+	{
+		sv->slot= sv->base/sv->slotSize;
+		sv->seq= sv->hdr.seq;
+		sv->state= SAVE_IDLE;
+	}
+}
+
+//! Advance a running commit; call once per frame.
+/*!	\param budget	Rough number of bytes to write this call. EEPROM
+		writes 8 bytes per call at most, since the chip needs a few
+		milliseconds for each block.
+	\return	Commit state: SAVE_IDLE when done, SAVE_ERROR if it failed.
+*/
+uint save_update(uint budget)
+{
+	TSave *sv= &gSave;
+	uint nn, end;
+
+	if(budget == 0)
+		budget= 1;
+
+	switch(sv->state)
+	{
+	case SAVE_SUM:
+		nn= min(budget*4, sv->hdr.size - sv->pos);
+		save_sum(&sv->sumA, &sv->sumB, &sv->src[sv->pos], nn);
+		sv->pos += nn;
+		if(sv->pos >= sv->hdr.size)
+		{
+			sv->hdr.check= sv->sumA ^ (sv->sumB<<16 | sv->sumB>>16);
+			sv->pos= 0;
+			if((sv->type == SAVE_FLASH_64K || sv->type == SAVE_FLASH_128K)
+				&& sv->flashId != FLASH_ATMEL_64K)
+				sv->state= SAVE_ERASE;
+			else
+				sv->state= SAVE_WRITE;
+		}
+		break;
+
+	case SAVE_ERASE:
+		// One sector per call; the chip takes a frame or so for each.
+		if(sv->pos && save_raw_busy(sv->base + sv->pos - SAVE_FLASH_SECTOR))
+			break;
+		end= align(SAVE_HEADER_SIZE + sv->hdr.size, SAVE_FLASH_SECTOR);
+		if(sv->pos >= end)
+		{
+			sv->pos= 0;
+			sv->state= SAVE_WRITE;
+			break;
+		}
+		save_raw_erase(sv->base + sv->pos);
+		sv->pos += SAVE_FLASH_SECTOR;
+		break;
+
+	case SAVE_WRITE:
+		save_write_step(budget);
+		break;
+
+	case SAVE_VERIFY:
+		save_verify_step(budget);
+		break;
+	}
+
+	return sv->state;
+}
+
+//! Read raw bytes from save memory.
+void save_read(uint ofs, void *dst, uint size)
+{
+	if(gSave.type != SAVE_NONE)
+		save_raw_read(ofs, (u8*)dst, size);
+}
+
+// EOF
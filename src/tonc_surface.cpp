@@ -1,105 +1,141 @@
-//
-// Basic surface functionality..
-//
-//! \file tonc_surface.c
-//! \author J Vijn
-//! \date 20080409 - 20080409
-//
-/* === NOTES ===
-*/
-
-#include <string.h>
-#include "tonc_surface.hpp"
-#include "tonc_video.hpp"
-
-// --------------------------------------------------------------------
-// FUNCTIONS 
-// --------------------------------------------------------------------
-
-//! Initalize a surface for \a type formatted graphics.
-/*!
-	\param srf		Surface to initialize.
-	\param type		Surface type. See \sa ESurfaceType for details.
-	\param data		Pointer to the surface memory.
-	\param width	Width of surface.
-	\param height	Height of surface.
-	\param bpp		Bitdepth. If \a type is not 0, this value will be ignored.
-	\param pal		Pointer to the surface's palette.
-*/
-void srf_init(TSurface *srf, enum ESurfaceType type, const void *data, 
-	uint width, uint height, uint bpp, u16 *pal)
-{
-	memset(srf, 0, sizeof(TSurface));
-	srf->data= (u8*)data;
-	srf->type= type;
-
-	switch(type &~ SRF_ALLOCATED)
-	{
-	case SRF_CHR4R:
-		bpp= 4;
-		srf->pitch= srf_align(width, 4)*8;
-		break;
-
-	case SRF_CHR4C:
-		bpp= 4;
-		srf->pitch= srf_align(height, 4)*8;
-		break;
-
-	case SRF_CHR8:
-		bpp= 8;
-		srf->pitch= srf_align(width, 8)*8;
-		break;
-
-	case SRF_BMP8:
-		bpp= 8;
-		srf->pitch= srf_align(width, bpp);
-		break;
-
-	case SRF_BMP16:
-		bpp= 16;
-		srf->pitch= srf_align(width, bpp);
-		pal= NULL;
-		break;
-	default:
-		srf->pitch= srf_align(width, bpp);
-	}
-
-	srf->width= width;
-	srf->height= height;
-	srf->bpp= bpp;
-
-	if(pal != NULL)
-	{
-		srf->palSize= 1<<bpp;
-		srf->palData= pal;
-	}
-}
-
-//! Copy \a count colors from \a src's palette to \a dst's palette.
-void srf_pal_copy(const TSurface *dst, const TSurface *src, uint count)
-{
-	if(dst && src && count)
-		memcpy16(dst->palData, src->palData, count);
-}
-
-//! Get the byte address of coordinates (\a x, \a y) on the surface.
-void *srf_get_ptr(const TSurface *srf, uint x, uint y)
-{
-	uint bpp= srf->bpp, pitch= srf->pitch;
-	switch(srf->type &~ SRF_ALLOCATED)
-	{
-	case SRF_CHR4R:
-	case SRF_CHR8:
-		return &srf->data[y/8*pitch + y%8*bpp + (x/8*8)*bpp + (x%8)*bpp/8];
-
-	case SRF_CHR4C:
-		return &srf->data[y*4 + x/8*pitch + (x%8)/2];
-		
-	default:
-		return &srf->data[y*pitch + x*bpp/8];
-	}
-}
-
-
-
-// EOF
+//
+// Basic surface functionality..
+//
+//! \file tonc_surface.c
+//! \author J Vijn
+//! \date 20080409 - 20080409
+//
+/* === NOTES ===
+*/
+
+#include <string.h>
+#include "tonc_surface.hpp"
+#include "tonc_video.hpp"
+#include "tonc_math.hpp"
+
+// --------------------------------------------------------------------
+// FUNCTIONS 
+// --------------------------------------------------------------------
+
+//! Initalize a surface for \a type formatted graphics.
+/*!
+	\param srf		Surface to initialize.
+	\param type		Surface type. See \sa ESurfaceType for details.
+	\param data		Pointer to the surface memory.
+	\param width	Width of surface.
+	\param height	Height of surface.
+	\param bpp		Bitdepth. If \a type is not 0, this value will be ignored.
+	\param pal		Pointer to the surface's palette.
+*/
+void srf_init(TSurface *srf, enum ESurfaceType type, const void *data, 
+	uint width, uint height, uint bpp, u16 *pal)
+{
+	memset(srf, 0, sizeof(TSurface));
+	srf->data= (u8*)data;
+	srf->type= type;
+
+	switch(type &~ SRF_ALLOCATED)
+	{
+	case SRF_CHR4R:
+		bpp= 4;
+		srf->pitch= srf_align(width, 4)*8;
+		break;
+
+	case SRF_CHR4C:
+		bpp= 4;
+		srf->pitch= srf_align(height, 4)*8;
+		break;
+
+	case SRF_CHR8:
+		bpp= 8;
+		srf->pitch= srf_align(width, 8)*8;
+		break;
+
+	case SRF_BMP8:
+		bpp= 8;
+		srf->pitch= srf_align(width, bpp);
+		break;
+
+	case SRF_BMP16:
+		bpp= 16;
+		srf->pitch= srf_align(width, bpp);
+		pal= NULL;
+		break;
+	default:
+		srf->pitch= srf_align(width, bpp);
+	}
+
+	srf->width= width;
+	srf->height= height;
+	srf->bpp= bpp;
+
+	if(pal != NULL)
+	{
+		srf->palSize= 1<<bpp;
+		srf->palData= pal;
+	}
+}
+
+//! Copy \a count colors from \a src's palette to \a dst's palette.
+void srf_pal_copy(const TSurface *dst, const TSurface *src, uint count)
+{
+	if(dst && src && count)
+		memcpy16(dst->palData, src->palData, count);
+}
+
+//! Get the byte address of coordinates (\a x, \a y) on the surface.
+void *srf_get_ptr(const TSurface *srf, uint x, uint y)
+{
+	uint bpp= srf->bpp, pitch= srf->pitch;
+	switch(srf->type &~ SRF_ALLOCATED)
+	{
+	case SRF_CHR4R:
+	case SRF_CHR8:
+		return &srf->data[y/8*pitch + y%8*bpp + (x/8*8)*bpp + (x%8)*bpp/8];
+
+	case SRF_CHR4C:
+		return &srf->data[y*4 + x/8*pitch + (x%8)/2];
+		
+	default:
+		return &srf->data[y*pitch + x*bpp/8];
+	}
+}
+
+//! Draw a line with fixed-point end points.
+/*!	For lines that move by less than a pixel at a time, like the 
+	edges of a rotating object. Works for any surface type, using 
+	the hline, vline and plot routines of \a tab.
+	\param dst		Destination surface.
+	\param tab		Renderers for \a dst's type; e.g. bmp16_tab.
+	\param x1		First X-coord (.8f).
+	\param y1		First Y-coord (.8f).
+	\param x2		Second X-coord (.8f).
+	\param y2		Second Y-coord (.8f).
+	\param clr		Color.
+	\note	Clipped to \a dst; steps by spans with LINE_DDA.
+*/
+void srf_line_fx(const TSurface *dst, const TSurfaceProcTab *tab, 
+	FIXED x1, FIXED y1, FIXED x2, FIXED y2, u32 clr)
+{
+	LINE_DDA ld;
+	LINE_SPAN span;
+	RECT clip= { 0, 0, dst->width, dst->height };
+
+	line_dda_init(&ld, x1, y1, x2, y2);
+	while(line_dda_next(&ld, &span))
+	{
+		if(!line_span_clip(&span, &clip))
+			continue;
+
+		if(span.y1 != span.y2)
+			tab->vline(dst, span.x1, span.y1, span.y2, clr);
+		else if(span.x1 != span.x2)
+			tab->hline(dst, span.x1, span.y1, span.x2, clr);
+		else
+			tab->plot(dst, span.x1, span.y1, clr);
+	}
+}
+
+
+
+// EOF
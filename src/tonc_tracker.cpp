@@ -0,0 +1,263 @@
+//
+//  Music player for the DMG tone channels
+//
+//! \file tonc_tracker.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * The wave channel plays 32 samples per period where the squares
+	play 8 (well, 16 half-steps), so the same rate is an octave lower.
+	Wave notes are shifted up an octave to make up for it.
+*/
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_tracker.hpp"
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+TTracker gTracker;
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Enable the tone generators at full volume on both sides.
+void trk_init(void)
+{
+	REG_SNDSTAT= SSTAT_ENABLE;
+	REG_SNDDMGCNT= SDMG_BUILD_LR(SDMG_SQR1|SDMG_SQR2|SDMG_WAVE|SDMG_NOISE, 7);
+	REG_SNDDSCNT= (REG_SNDDSCNT &~ 3) | SDS_DMG100;
+
+	gTracker.song= NULL;
+	gTracker.playing= 0;
+	gTracker.wave= NULL;
+}
+
+//! Load the patterns of the current order position.
+static void trk_load_order(TTracker *trk)
+{
+	const TTrackSong *song= trk->song;
+	const u8 *order= &song->order[trk->order*TRK_CHANNELS];
+	uint ii;
+
+	for(ii=0; ii<TRK_CHANNELS; ii++)
+	{
+		trk->channels[ii].pos= order[ii] != TRK_NONE ?
+			song->patterns[order[ii]] : NULL;
+		trk->channels[ii].wait= 0;
+	}
+	trk->row= 0;
+}
+
+//! Silence channel \a id.
+static void trk_note_off(uint id)
+{
+	switch(id)
+	{
+	case 0:
+		REG_SND1CNT= 0;		REG_SND1FREQ= SFREQ_RESET;	break;
+	case 1:
+		REG_SND2CNT= 0;		REG_SND2FREQ= SFREQ_RESET;	break;
+	case 2:
+		REG_SND3SEL= 0;		break;
+	case 3:
+		REG_SND4CNT= 0;		REG_SND4FREQ= SNOISE_RESET;	break;
+	}
+}
+
+//! Start \a note on channel \a id.
+static void trk_note_on(TTracker *trk, uint id, uint note)
+{
+	TTrackChannel *chn= &trk->channels[id];
+	const TTrackInstr *ins= &trk->song->instruments[chn->instr];
+	u32 timed= (ins->flags & TRKI_TIMED) ? SFREQ_TIMED : 0;
+
+	if(id == 2 && note < 0x60-12)
+		note += 12;
+
+	chn->rate= SND_RATE(note%12, (int)(note/12)-2);
+	chn->sounding= 1;
+
+	switch(id)
+	{
+	case 0:
+		REG_SND1SWEEP= ins->sweep ? ins->sweep : SSW_OFF;
+		REG_SND1CNT= ins->cnt;
+		REG_SND1FREQ= chn->rate | timed | SFREQ_RESET;
+		break;
+
+	case 1:
+		REG_SND2CNT= ins->cnt;
+		REG_SND2FREQ= chn->rate | timed | SFREQ_RESET;
+		break;
+
+	case 2:
+		// Writes go to the bank that isn't playing: select bank 1 for
+		// playback, fill bank 0, then switch back.
+		if(ins->wave && ins->wave != trk->wave)
+		{
+			REG_SND3SEL= SWAV_BANK1;
+			REG_WAVE_RAM0= ins->wave[0];
+			REG_WAVE_RAM1= ins->wave[1];
+			REG_WAVE_RAM2= ins->wave[2];
+			REG_WAVE_RAM3= ins->wave[3];
+			trk->wave= ins->wave;
+		}
+		REG_SND3SEL= SWAV_ENABLE | SWAV_BANK0;
+		REG_SND3CNT= ins->cnt;
+		REG_SND3FREQ= chn->rate | timed | SFREQ_RESET;
+		break;
+
+	case 3:
+		chn->rate= SNOISE_SFT(note/8) | SNOISE_DIV(note%8) | ins->sweep;
+		REG_SND4CNT= ins->cnt;
+		REG_SND4FREQ= chn->rate | (timed ? SNOISE_TIMED : 0) | SNOISE_RESET;
+		break;
+	}
+}
+
+//! Read the next row of channel \a id.
+static void trk_channel_row(TTracker *trk, uint id)
+{
+	TTrackChannel *chn= &trk->channels[id];
+	uint cmd;
+
+	if(chn->pos == NULL)
+		return;
+
+	if(chn->wait)
+	{
+		chn->wait--;
+		return;
+	}
+
+	while(1)
+	{
+		cmd= *chn->pos++;
+		if(cmd < TRK_OFF)
+		{
+			trk_note_on(trk, id, cmd);
+			return;
+		}
+		else if(cmd == TRK_OFF)
+		{
+			trk_note_off(id);
+			chn->sounding= 0;
+			return;
+		}
+		else if(cmd == TRK_INSTR)
+			chn->instr= *chn->pos++;
+		else if(cmd >= 0x80)
+		{
+			chn->wait= cmd&0x7F;
+			return;
+		}
+		// Unknown bytes are skipped.
+	}
+}
+
+//! Apply per-frame pitch slides.
+static void trk_channel_slide(TTracker *trk, uint id)
+{
+	TTrackChannel *chn= &trk->channels[id];
+	const TTrackInstr *ins= &trk->song->instruments[chn->instr];
+	int rate;
+
+	if(!chn->sounding || ins->slide == 0 || id == 3)
+		return;
+
+	rate= chn->rate + ins->slide;
+	chn->rate= rate < 0 ? 0 : rate > 2047 ? 2047 : rate;
+
+	// No reset bit: changes pitch without restarting the note.
+	u32 timed= (ins->flags & TRKI_TIMED) ? SFREQ_TIMED : 0;
+	if(id == 0)
+		REG_SND1FREQ= chn->rate | timed;
+	else if(id == 1)
+		REG_SND2FREQ= chn->rate | timed;
+	else
+		REG_SND3FREQ= chn->rate | timed;
+}
+
+//! Start playing \a song from the top.
+void trk_play(const TTrackSong *song)
+{
+	uint ii;
+
+	trk_stop();
+	for(ii=0; ii<TRK_CHANNELS; ii++)
+	{
+		gTracker.channels[ii].instr= 0;
+		gTracker.channels[ii].sounding= 0;
+	}
+
+	gTracker.song= song;
+	gTracker.order= 0;
+	gTracker.tick= 0;
+	trk_load_order(&gTracker);
+	gTracker.playing= 1;
+}
+
+//! Stop the song and silence all channels.
+void trk_stop(void)
+{
+	uint ii;
+
+	gTracker.playing= 0;
+	for(ii=0; ii<TRK_CHANNELS; ii++)
+		trk_note_off(ii);
+}
+
+//! Advance the player by one frame.
+/*!	Call once per frame from the VBlank isr or the main loop; or
+	from a timer isr for tempos that don't fit the frame rate.
+*/
+void trk_update(void)
+{
+	TTracker *trk= &gTracker;
+	uint ii;
+
+	if(!trk->playing)
+		return;
+
+	if(trk->tick == 0)
+	{
+		// Next order position at the end of the pattern.
+		if(trk->row >= trk->song->rows)
+		{
+			if(++trk->order >= trk->song->length)
+			{
+				if(trk->song->loop == TRK_NONE)
+				{
+					trk_stop();
+					return;
+				}
+				trk->order= trk->song->loop;
+			}
+			trk_load_order(trk);
+		}
+
+		for(ii=0; ii<TRK_CHANNELS; ii++)
+			trk_channel_row(trk, ii);
+		trk->row++;
+	}
+	else
+	{
+		for(ii=0; ii<TRK_CHANNELS; ii++)
+			trk_channel_slide(trk, ii);
+	}
+
+	if(++trk->tick >= trk->song->speed)
+		trk->tick= 0;
+}
+
+// EOF
@@ -1,33 +1,107 @@
-//
-//  Basic video functionality
-//
-//! \file tonc_video.c
-//! \author J Vijn
-//! \date 20060604 - 20070805
-//
-// === NOTES ===
-
-#include "tonc_memmap.hpp"
-#include "tonc_core.hpp"
-#include "tonc_video.hpp"
-
-
-// --------------------------------------------------------------------
-// FUNCTIONS 
-// --------------------------------------------------------------------
-
-
-//! Flip the display page.
-/*! Toggles the display page in REG_DISPCNT and sets \a vid_page
-	to point to the back buffer.
-	\return	Current back buffer pointer.
-*/
-COLOR *vid_flip(void)
-{
-	vid_page= (COLOR*)((u32)vid_page ^ VRAM_PAGE_SIZE);
-	REG_DISPCNT ^= DCNT_PAGE;	// update control register	
-
-	return vid_page;
-}
-
-// EOF
+//
+//  Basic video functionality
+//
+//! \file tonc_video.c
+//! \author J Vijn
+//! \date 20060604 - 20070805
+//
+// === NOTES ===
+// * Triple buffering: the renderer draws into a RAM buffer that's
+//   never displayed. vid_tb_present() copies it into the hidden VRAM
+//   page and queues a flip; the VBlank isr does the flip. A frame that
+//   is still queued when the next one is presented gets overwritten,
+//   so the renderer never waits.
+// * The copy uses memcpy32 rather than DMA: it's as fast from EWRAM,
+//   and it doesn't hold up interrupts (like the mixer's VBlank isr)
+//   for a quarter of a frame.
+
+#include "tonc_memmap.hpp"
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_video.hpp"
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+static vu16 __vid_tb_flip= 0;	//!< Flip queued for the next VBlank.
+static uint __vid_tb_size= 0;	//!< Bytes to copy per frame.
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS 
+// --------------------------------------------------------------------
+
+
+//! Flip the display page.
+/*! Toggles the display page in REG_DISPCNT and sets \a vid_page
+	to point to the back buffer.
+	\return	Current back buffer pointer.
+*/
+COLOR *vid_flip(void)
+{
+	vid_page= (COLOR*)((u32)vid_page ^ VRAM_PAGE_SIZE);
+	REG_DISPCNT ^= DCNT_PAGE;	// update control register	
+
+	return vid_page;
+}
+
+//! Start triple-buffered rendering for mode 4 or 5.
+/*!	Set the video mode first; it decides how much is copied per frame.
+	Add vid_tb_vblank() to the VBlank isr.
+	\param buffer	Back buffer, VRAM_PAGE_SIZE bytes and word-aligned.
+		EWRAM is the place for it; unlike VRAM, it can take byte
+		writes in mode 4.
+	\return	Back buffer pointer (also in \a vid_page).
+	\note	Don't mix with vid_flip().
+*/
+COLOR *vid_tb_init(void *buffer)
+{
+	__vid_tb_flip= 0;
+	__vid_tb_size= (REG_DISPCNT & DCNT_MODE_MASK) == DCNT_MODE5 ?
+		M5_SIZE : M4_SIZE;
+	vid_page= (COLOR*)buffer;
+
+	return vid_page;
+}
+
+//! Present the back buffer; returns immediately.
+/*!	Copies the back buffer into the hidden VRAM page, and queues a
+	flip for the next VBlank. If a previous frame was still waiting,
+	it's replaced by this one.
+	\return	Back buffer pointer, ready for the next frame.
+	\note	The copy takes about a quarter of a frame for mode 4.
+*/
+COLOR *vid_tb_present(void)
+{
+	// Cancel any queued flip first, or the isr could show the page
+	// while it's being written.
+	__vid_tb_flip= 0;
+
+	void *dst= (REG_DISPCNT & DCNT_PAGE) ? (void*)MEM_VRAM : (void*)MEM_VRAM_BACK;
+	memcpy32(dst, vid_page, __vid_tb_size/4);
+
+	__vid_tb_flip= 1;
+
+	return vid_page;
+}
+
+//! Do a queued flip; call from the VBlank isr.
+void vid_tb_vblank(void)
+{
+	if(__vid_tb_flip)
+	{
+		REG_DISPCNT ^= DCNT_PAGE;
+		__vid_tb_flip= 0;
+	}
+}
+
+//! Check if a presented frame is still waiting for VBlank.
+BOOL vid_tb_pending(void)
+{
+	return __vid_tb_flip;
+}
+
+// EOF
@@ -0,0 +1,83 @@
+//
+// Affine tile renderer, var width/height, 1->8bpp tiles,
+// recolored with transparency
+//
+//! \file ase_vwf_drawg_b1cts.c
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Goes cell by cell, so a cell only gets a tile if the glyph has
+	pixels in it. Inside a tile, a line is 8 bytes and the pixels
+	are written in pairs, like bmp8_drawg_b1cts().
+*/
+
+#include "tonc_memdef.hpp"
+#include "tonc_math.hpp"
+#include "tonc_tte.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+//! Render 1bpp fonts into pooled 8bpp tiles.
+void ase_vwf_drawg_b1cts(uint gid)
+{
+	TTE_BASE_VARS(tc, font);
+	TTE_CHAR_VARS(font, gid, u8, srcD, srcL, charW, charH);
+	int x0= tc->cursorX, y0= tc->cursorY;
+	uint srcP= font->cellH;
+	uint strips= (charW+7)/8;
+
+	u32 ink= tc->cattr[TTE_INK], raw, px;
+
+	int tx, ty, iy, iy1, sx;
+	uint ix, is;
+	for(ty=y0/8; ty*8 < y0+(int)charH; ty++)		// Loop over cell rows
+	{
+		iy1= min(ty*8+8-y0, charH);
+
+		for(tx=x0/8; tx*8 < x0+(int)charW; tx++)	// Loop over cells
+		{
+			u16 *tile= NULL, *dstL;
+
+			// Glyph x of the cell's left edge
+			sx= tx*8-x0;
+			is= sx < 0 ? 0 : sx/8;
+			srcL= &srcD[is*srcP];
+
+			for(iy=max(ty*8-y0, 0); iy<iy1; iy++)	// Loop over lines
+			{
+				// Glyph pixels in this cell
+				if(sx < 0)
+					raw= srcL[iy]<<-sx & 255;
+				else
+				{
+					raw= srcL[iy]>>(sx%8);
+					if(sx%8 && is+1 < strips)
+						raw |= srcL[iy+srcP]<<(8-sx%8) & 255;
+				}
+				if(raw == 0)
+					continue;
+
+				if(tile == NULL)
+				{
+					tile= (u16*)ase_vwf_get_tile(tx, ty);
+					if(tile == NULL)
+						return;
+				}
+
+				dstL= &tile[(y0+iy)%8*4];
+				for(ix=0; raw>0; raw>>=2, ix++)	// Loop over pixels
+				{
+					// 2-fold 1->8 bitunpack
+					px= ( (raw&3)<<7 | (raw&3) ) &~ 0xFE;
+					dstL[ix]= (dstL[ix]&~(px*255)) + ink*px;
+				}
+			}
+		}
+	}
+}
+
+// EOF
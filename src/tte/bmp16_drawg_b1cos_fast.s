@@ -0,0 +1,130 @@
+@
+@ 16bpp bitmap glyph renderer. 1->16bpp recolored, 
+@ any size, opaque
+@
+@! \file bmp16_drawg_b1cos_fast.s
+@! \author J Vijn
+@! \date 20261018 - 20261018
+@
+@ === NOTES ===
+@ * Pixel pairs come from a 4-word table on the stack, so a scanline 
+@   of a strip is 4 words, or 2 halfwords and 3 words for odd x. 
+@   Nothing is read from VRAM.
+
+#include "tonc_asminc.hpp"
+#include "tte_types.s"
+
+@ IWRAM_CODE void bmp16_drawg_b1cos_fast(int gid);
+BEGIN_FUNC_ARM(bmp16_drawg_b1cos_fast, CSEC_IWRAM)
+	stmfd	sp!, {r4-r11, lr}
+
+	ldr		r5,=gp_tte_context
+	ldr		r5, [r5]
+	
+	@ Preload dstBase (r4), dstPitch (ip), yx (r6), font (r7)
+	ldmia	r5, {r4, ip}
+	add		r3, r5, #TTC_cursorX
+	ldmia	r3, {r6, r7}
+
+	@ Get srcD (r1), width (r11), charH (r2), cellH (r10)
+	ldmia	r7, {r1, r3}			@ Load data, widths
+	cmp		r3, #0
+	ldrneb	r11, [r3, r0]			@ Var charW
+	ldreqb	r11, [r7, #TF_charW]	@ Fixed charW
+	ldrh	r3, [r7, #TF_cellS]
+	mla		r1, r3, r0, r1			@ srcD
+	ldrb	r2, [r7, #TF_charH]		@ charH
+	ldrb	r10, [r7, #TF_cellH]	@ cellH
+
+	cmp		r11, #0
+	cmpne	r2, #0
+	ldmeqfd	sp!, {r4-r11, lr}
+	bxeq	lr
+
+	@ Positional issues: dstD(lr)
+	mov		r3, r6, lsr #16			@ y
+	bic		r6, r6, r3, lsl #16		@ x
+	mla		lr, ip, r3, r4
+	add		lr, lr, r6, lsl #1		@ dstD= dstBase + y*dstP + x*2
+	sub		r10, r10, r2			@ deltaS= cellH-charH
+
+	@ Colors: ink (r8), paper (r9) and pixel-pair table
+	ldrh	r8, [r5, #TTC_ink]
+	ldrh	r9, [r5, #TTC_paper]
+	orr		r4, r9, r9, lsl #16		@ 00: paper, paper
+	orr		r5, r8, r9, lsl #16		@ 01: ink, paper
+	orr		r6, r9, r8, lsl #16		@ 10: paper, ink
+	orr		r7, r8, r8, lsl #16		@ 11: ink, ink
+	str		r2, [sp, #-4]!
+	stmfd	sp!, {r4-r7}
+
+	@ --- Reg-list for strip/render loop ---
+	@ r0	dstL
+	@ r1	srcL
+	@ r2	scanline looper
+	@ r3	raw
+	@ r4-r7	px pairs
+	@ r8	ink
+	@ r9	paper
+	@ r10	deltaS
+	@ r11	strip looper
+	@ ip	dstP
+	@ lr	dstD
+	@ sp00	pair table
+	@ sp10	charH
+
+	@ --- Strip loop ---
+.Lsloop:
+		ldr		r2, [sp, #16]		@ Reset scanline looper
+		mov		r0, lr
+		add		lr, lr, #16			@ dstD += 8 pixels
+
+		@ --- Render loop ---
+.Lyloop:
+			ldrb	r3, [r1], #1
+			tst		r0, #2
+			bne		.Lodd
+
+			@ Word-aligned: 4 pairs
+			and		r4, r3, #3
+			ldr		r4, [sp, r4, lsl #2]
+			and		r5, r3, #12
+			ldr		r5, [sp, r5]
+			and		r6, r3, #48
+			ldr		r6, [sp, r6, lsr #2]
+			mov		r7, r3, lsr #6
+			ldr		r7, [sp, r7, lsl #2]
+			stmia	r0, {r4-r7}
+			b		.Lynext
+.Lodd:
+			@ Halfword-aligned: single, 3 pairs, single
+			tst		r3, #1
+			strneh	r8, [r0]
+			streqh	r9, [r0]
+			and		r4, r3, #6
+			ldr		r4, [sp, r4, lsl #1]
+			and		r5, r3, #24
+			ldr		r5, [sp, r5, lsr #1]
+			and		r6, r3, #96
+			ldr		r6, [sp, r6, lsr #3]
+			add		r7, r0, #2
+			stmia	r7, {r4-r6}
+			tst		r3, #128
+			strneh	r8, [r0, #14]
+			streqh	r9, [r0, #14]
+.Lynext:
+			add		r0, r0, ip
+			subs	r2, r2, #1
+			bne		.Lyloop
+
+		add		r1, r1, r10			@ srcL += deltaS
+		subs	r11, r11, #8
+		bgt		.Lsloop
+
+	add		sp, sp, #20
+	ldmfd	sp!, {r4-r11, lr}
+	bx		lr
+END_FUNC(bmp16_drawg_b1cos_fast)
+
+
+@ EOF
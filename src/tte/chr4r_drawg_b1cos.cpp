@@ -0,0 +1,80 @@
+//
+// Row-major tile renderer, var width/height, 1->4bpp tiles,
+// recolored, opaque
+//
+//! \file chr4r_drawg_b1cos.c
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * The cell is filled with paper, so whole words can be written 
+	without reading VRAM first. Only the edge words of a cell that 
+	isn't tile-aligned are merged.
+  * Fills whole 8px strips, which may be wider than charW.
+*/
+
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_tte.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+//! Render 1bpp fonts to row-major 4bpp tiles, with paper
+void chr4r_drawg_b1cos(uint gid)
+{
+	TTE_BASE_VARS(tc, font);
+	TTE_CHAR_VARS(font, gid, u8, srcD, srcL, charW, charH);
+	uint x= tc->cursorX, y= tc->cursorY;
+	uint srcP= font->cellH, dstP= tc->dst.pitch;
+
+	u32 *dstD= (u32*)(tc->dst.data + y/8*dstP + (y%8)*4 + x/8*32), *dstL;
+	x %= 8;
+	u32 lsl= 4*x, lsr= 32-4*x;
+
+	// Inner loop vars
+	u32 px, raw, carry;
+	u32 paper= octup(tc->cattr[TTE_PAPER]);
+	u32 ink= octup(tc->cattr[TTE_INK]) ^ paper;
+	const u32 mask= 0x01010101;
+
+	uint iy, iw;
+	for(iy=0; iy<charH; iy++)		// Loop over scanlines
+	{
+		dstL= dstD++;
+		srcL= srcD++;
+
+		// Skip for new tile-row
+		if( ((u32)dstD)%32 == 0 )
+			dstD += dstP/4 - 8;
+
+		// Pixels left of the cell
+		carry= x ? *dstL &~ (0xFFFFFFFF<<lsl) : 0;
+
+		for(iw=0; iw<charW; iw += 8)	// Loop over strips
+		{
+			raw= *srcL;
+			srcL += srcP;
+
+			raw |= raw<<12;
+			raw |= raw<< 6;
+			px   = raw & mask<<1;
+			raw &= mask;
+			px   = raw | px<<3;
+
+			px= paper ^ (px*15 & ink);
+
+			*dstL= carry | px<<lsl;
+			carry= x ? px>>lsr : 0;
+			dstL += 8;
+		}
+
+		// Pixels right of the cell
+		if(x && charW)
+			*dstL= (*dstL & 0xFFFFFFFF<<lsl) | carry;
+	}
+}
+
+// EOF
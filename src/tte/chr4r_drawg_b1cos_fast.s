@@ -0,0 +1,139 @@
+@
+@ Tile character renderer. 1->4bpp recolored, any size, opaque
+@
+@! \file chr4r_drawg_b1cos_fast.s
+@! \author J Vijn
+@! \date 20261018 - 20261018
+@
+@ === NOTES ===
+@ * Goes by scanline, then strip, so that the overflow of one strip 
+@   can be combined with the next. Only the words at the left and 
+@   right edge of a cell that isn't tile-aligned are read.
+
+#include "tonc_asminc.hpp"
+#include "tte_types.s"
+
+@ IWRAM_CODE void chr4r_drawg_b1cos_fast(int gid);
+BEGIN_FUNC_ARM(chr4r_drawg_b1cos_fast, CSEC_IWRAM)
+	stmfd	sp!, {r4-r11, lr}
+
+	ldr		r5,=gp_tte_context
+	ldr		r5, [r5]
+	
+	@ Preload dstBase (r4), dstPitch (ip), yx (r6), font (r7)
+	ldmia	r5, {r4, ip}
+	add		r3, r5, #TTC_cursorX
+	ldmia	r3, {r6, r7}
+
+	@ Get srcD (r1), width (r11), charH (r2), cellH (r10)
+	ldmia	r7, {r1, r3}			@ Load data, widths
+	cmp		r3, #0
+	ldrneb	r11, [r3, r0]			@ Var charW
+	ldreqb	r11, [r7, #TF_charW]	@ Fixed charW
+	ldrh	r3, [r7, #TF_cellS]
+	mla		r1, r3, r0, r1			@ srcD
+	ldrb	r2, [r7, #TF_charH]		@ charH
+	ldrb	r10, [r7, #TF_cellH]	@ cellH
+
+	cmp		r11, #0
+	cmpne	r2, #0
+	ldmeqfd	sp!, {r4-r11, lr}
+	bxeq	lr
+
+	@ Positional issues: dstD(lr), lsl(r8)
+	mov		r3, r6, lsr #16			@ y
+	bic		r6, r6, r3, lsl #16		@ x
+	mov		lr, r3, lsr #3
+	mla		r4, ip, lr, r4			@ dstBase += y/8*dstP
+	and		r3, r3, #7
+	add		r4, r4, r3, lsl #2		@ dstBase += y%8*4
+	mov		r3, r6, lsr #3
+	add		lr, r4, r3, lsl #5		@ dstD= dstBase + x/8*32
+	sub		ip, ip, #32				@ Tile-row skip
+	and		r8, r6, #7
+	mov		r8, r8, lsl #2			@ lsl= x%8*4
+
+	@ Colors: paper (r7), ink^paper (r9)
+	ldr		r6,=0x11111111
+	ldrh	r3, [r5, #TTC_paper]
+	mul		r7, r3, r6
+	ldrh	r3, [r5, #TTC_ink]
+	mul		r9, r3, r6
+	eor		r9, r9, r7
+	ldr		r6,=0x01010101
+
+	stmfd	sp!, {r1, r11}			@ Store srcD, charW
+
+	@ --- Reg-list for render/strip loop ---
+	@ r0	dstL
+	@ r1	srcL
+	@ r2	scanline looper
+	@ r3	raw / tmp
+	@ r4	px
+	@ r5	carry
+	@ r6	bitmask
+	@ r7	paper
+	@ r8	left shift
+	@ r9	ink^paper
+	@ r10	srcP
+	@ r11	strip looper
+	@ ip	dstP-32
+	@ lr	dstD
+	@ sp00	srcD
+	@ sp04	charW
+
+	@ --- Render loop ---
+.Lyloop:
+		ldmia	sp, {r1, r11}		@ srcL= srcD, reload charW
+		add		r3, r1, #1
+		str		r3, [sp]			@ srcD++
+		mov		r0, lr
+		add		lr, lr, #4			@ dstD++
+		tst		lr, #31
+		addeq	lr, lr, ip			@ Next tile-row
+
+		@ Pixels left of the cell, if any
+		movs	r5, r8
+		ldrne	r5, [r0]
+		rsbne	r3, r8, #32
+		movne	r5, r5, lsl r3
+		movne	r5, r5, lsr r3
+
+		@ --- Strip loop ---
+.Lsloop:
+			ldrb	r3, [r1], r10
+			orr		r3, r3, r3, lsl #12
+			orr		r3, r3, r3, lsl #6
+			and		r4, r3, r6, lsl #1
+			and		r3, r3, r6
+			orr		r3, r3, r4, lsl #3
+
+			rsb		r3, r3, r3, lsl #4	@ pxmask
+			and		r3, r3, r9
+			eor		r4, r3, r7			@ px= paper ^ (pxmask & (ink^paper))
+
+			orr		r3, r5, r4, lsl r8
+			str		r3, [r0], #32
+			rsb		r3, r8, #32
+			mov		r5, r4, lsr r3		@ Overflow into next tile (0 if aligned)
+
+			subs	r11, r11, #8
+			bgt		.Lsloop
+
+		@ Pixels right of the cell, if any
+		cmp		r8, #0
+		ldrne	r3, [r0]
+		movne	r3, r3, lsr r8
+		orrne	r3, r5, r3, lsl r8
+		strne	r3, [r0]
+
+		subs	r2, r2, #1
+		bne		.Lyloop
+	
+	add		sp, sp, #8
+	ldmfd	sp!, {r4-r11, lr}
+	bx		lr
+END_FUNC(chr4r_drawg_b1cos_fast)
+
+
+@ EOF
@@ -0,0 +1,73 @@
+//
+// Row-major tile renderer, var width/height, 4bpp tiles, 
+// recolored with transparency
+//
+//! \file chr4r_drawg_b4cts.c
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+// === NOTES ===
+
+#include "tonc_memdef.hpp"
+#include "tonc_tte.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+//! Render 4bpp fonts to row-major 4bpp tiles
+void chr4r_drawg_b4cts(uint gid)
+{
+	TTE_BASE_VARS(tc, font);
+	TTE_CHAR_VARS(font, gid, u32, srcD, srcL, charW, charH);
+	uint x= tc->cursorX, y= tc->cursorY;
+	uint srcP= font->cellH, dstP= tc->dst.pitch;
+
+	u32 *dstD= (u32*)(tc->dst.data + y/8*dstP + (y%8)*4 + x/8*32), *dstL;
+	dstP= dstP/4 - 8;
+	x %= 8;
+	u32 lsl= 4*x, lsr= 32-4*x, right= x+charW;
+
+	// Inner loop vars
+	u32 amask= 0x11111111;
+	u32 px, pxmask, raw;
+	u32 ink=   tc->cattr[TTE_INK];
+	u32 shade= tc->cattr[TTE_SHADOW];
+
+	uint iy, iw;
+	for(iw=0; iw<charW; iw += 8)	// Loop over strips
+	{
+		dstL= dstD;		dstD += 8;
+		srcL= srcD;		srcD += srcP;
+
+		iy= charH;
+		while(iy--)					// Loop over scanlines
+		{
+			raw= *srcL++;
+
+			px	  = (raw    & amask);
+			raw	  = (raw>>1 & amask);
+			pxmask= px | raw;
+			if(pxmask)
+			{
+				px *= ink;
+				px += raw*shade;
+				pxmask *= 15;
+
+				// Write left tile:
+				dstL[0] = (dstL[0] &~ (pxmask<<lsl) ) | (px<<lsl);
+
+				// Write right tile (if any)
+				if(right > 8)
+					dstL[8]= (dstL[8] &~ (pxmask>>lsr) ) | (px>>lsr);
+			}
+			dstL++;
+
+			if( ((u32)dstL)%32 == 0 )
+				dstL += dstP;
+		}
+	}
+}
+
+// EOF
@@ -0,0 +1,155 @@
+//
+// Row-major tile renderer for runs of glyphs, 1->4bpp and 4->4bpp
+// tiles, recolored with transparency
+//
+//! \file chr4r_write_run.c
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Goes by scanline over the whole run instead of glyph by glyph.
+	Neighbouring glyphs of a VWF font usually share a word; that word
+	is now read and written once instead of twice, and the per-glyph
+	setup is done once per run.
+  * The pixels go into a window of two words. A word is written when
+	the window moves past it, and only if something was drawn in it.
+*/
+
+#include "tonc_memdef.hpp"
+#include "tonc_tte.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+//! Draw the plain characters at the start of \a text in one go.
+/*!	Stops at the first newline, tab, command or non-ASCII character,
+	where the line would wrap, or after CHR4R_RUN_MAX characters. The
+	cursor is moved past the run; tte_write() can do the rest.
+	\param text	String to write.
+	\return	Number of characters used.
+	\note	For 1bpp and 4bpp fonts, drawn like chr4r_drawg_b1cts()
+		and chr4r_drawg_b4cts(). Other fonts go through the
+		context's renderer, one glyph at a time.
+*/
+int chr4r_write_run(const char *text)
+{
+	TTE_BASE_VARS(tc, font);
+	const u8 *srcs[CHR4R_RUN_MAX];
+	u8 widths[CHR4R_RUN_MAX];
+	uint ii, count, ch, gid, charW;
+	uint x0= tc->cursorX, x= x0, y= tc->cursorY;
+	bool packed= font->bpp == 1 || font->bpp == 4;
+
+	// --- Collect the run ---
+	for(count=0; count<CHR4R_RUN_MAX; count++)
+	{
+		ch= text[count];
+		if(ch < ' ' || ch >= 0x80 || (ch == '#' && text[count+1] == '{')
+				|| (ch == '\\' && text[count+1] == '#'))
+			break;
+
+		gid= ch - font->charOffset;
+		if(tc->charLut)
+			gid= tc->charLut[gid];
+		charW= font->widths ? font->widths[gid] : font->charW;
+		if(x+charW > (uint)tc->marginRight)
+			break;
+
+		if(!packed)
+		{
+			tc->cursorX= x;
+			tc->drawgProc(gid);
+		}
+		srcs[count]= (const u8*)font->data + gid*font->cellSize;
+		widths[count]= charW;
+		x += charW;
+	}
+
+	tc->cursorX= x;
+	if(count == 0 || !packed)
+		return count;
+
+	// --- Render by scanline ---
+	uint srcP= font->cellH, dstP= tc->dst.pitch;
+	u32 *dstD= (u32*)(tc->dst.data + y/8*dstP + (y%8)*4), *dstL;
+	dstP= dstP/4 - 8;
+
+	u32 ink= tc->cattr[TTE_INK], shade= tc->cattr[TTE_SHADOW];
+	u32 px, pxmask, raw, lsl;
+	u32 win[2], winmask[2];			// Pixels for words tx and tx+1
+	uint iy, iw, tx, sx;
+
+	for(iy=0; iy<font->charH; iy++)	// Loop over scanlines
+	{
+		dstL= dstD++;
+		if( ((u32)dstD)%32 == 0 )
+			dstD += dstP;
+
+		x= x0;
+		tx= x0/8;
+		win[0]= win[1]= winmask[0]= winmask[1]= 0;
+
+		for(ii=0; ii<count; ii++)	// Loop over glyphs
+		{
+			for(iw=0; iw<widths[ii]; iw += 8)	// Loop over strips
+			{
+				if(font->bpp == 1)
+				{
+					raw= srcs[ii][iw/8*srcP + iy];
+					raw |= raw<<12;
+					raw |= raw<< 6;
+					px   = raw & 0x02020202;
+					raw &= 0x01010101;
+					px   = raw | px<<3;
+
+					pxmask= px*15;
+					px   *= ink;
+				}
+				else
+				{
+					raw= ((u32*)srcs[ii])[iw/8*srcP + iy];
+					px= raw & 0x11111111;
+					raw= raw>>1 & 0x11111111;
+					pxmask= (px | raw)*15;
+					px= px*ink + raw*shade;
+				}
+
+				// Move the window up to this strip
+				sx= x+iw;
+				while(tx < sx/8)
+				{
+					if(winmask[0])
+						dstL[tx*8]= (dstL[tx*8] &~ winmask[0]) | win[0];
+					win[0]= win[1];			win[1]= 0;
+					winmask[0]= winmask[1];	winmask[1]= 0;
+					tx++;
+				}
+
+				if(pxmask == 0)
+					continue;
+
+				lsl= sx%8*4;
+				win[0]= (win[0] &~ (pxmask<<lsl)) | px<<lsl;
+				winmask[0] |= pxmask<<lsl;
+				if(lsl)
+				{
+					win[1]= (win[1] &~ (pxmask>>(32-lsl))) | px>>(32-lsl);
+					winmask[1] |= pxmask>>(32-lsl);
+				}
+			}
+			x += widths[ii];
+		}
+
+		// Write what's left in the window
+		if(winmask[0])
+			dstL[tx*8]= (dstL[tx*8] &~ winmask[0]) | win[0];
+		if(winmask[1])
+			dstL[tx*8+8]= (dstL[tx*8+8] &~ winmask[1]) | win[1];
+	}
+
+	return count;
+}
+
+// EOF
@@ -0,0 +1,452 @@
+//
+// Text cache: pre-rendered strings
+//
+//! \file tte_cache.c
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * A string is rendered once with the context's own renderer into an
+	off-screen image of the same surface type, and copied to the screen
+	after that. The image starts in the first tile (chr4) or pixel pair
+	(bmp8) at the same offset as on screen, so the copy is whole words
+	or pairs and never has to shift pixels.
+  * For transparent renderers, the image starts out filled with a key
+	color, the paper if the text doesn't use it, and those pixels are
+	left out of the copy, just like the renderer would have done.
+	Opaque renderers (the b1cos ones, or whatever is the opaqueProc)
+	get a paper-filled image that's copied whole. They fill whole 8px
+	strips, so their images are wider than the text; only the text's
+	own width goes to the screen.
+  * Only for bitmap and 4bpp tile surfaces. Only plain, single-line
+	text that doesn't wrap: anything else goes to tte_write().
+  * Everything lives in one buffer that the caller hands over: first the
+	entry table, then the images. When an image doesn't fit, the least
+	recently used ones are thrown out until it does.
+*/
+
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_surface.hpp"
+#include "tonc_math.hpp"
+
+#include "tonc_tte.hpp"
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+TTextCache gTextCache;
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Find room for \a size bytes in the pool.
+/*!	\return	Offset in the pool, or -1 if there's no gap that large.
+*/
+static int tte_cache_find_gap(uint size)
+{
+	TTextCache *cache= &gTextCache;
+	TTextCacheEntry *entries= cache->entries;
+	uint ii, jj, ofs;
+
+	// Candidates: the start of the pool and the end of each image.
+	for(ii=0; ii<=cache->count; ii++)
+	{
+		if(ii == cache->count)
+			ofs= 0;
+		else if(entries[ii].stamp)
+			ofs= entries[ii].ofs + entries[ii].size;
+		else
+			continue;
+
+		if(ofs+size > cache->poolSize)
+			continue;
+
+		for(jj=0; jj<cache->count; jj++)
+		{
+			if(entries[jj].stamp && ofs < entries[jj].ofs+entries[jj].size &&
+					entries[jj].ofs < ofs+size)
+				break;
+		}
+		if(jj == cache->count)
+			return ofs;
+	}
+	return -1;
+}
+
+//! Get a free entry with \a size bytes of pool, evicting what it takes.
+static TTextCacheEntry *tte_cache_alloc(uint size)
+{
+	TTextCache *cache= &gTextCache;
+	TTextCacheEntry *entries= cache->entries, *entry;
+	uint ii;
+	int ofs;
+
+	if(size > cache->poolSize)
+		return NULL;
+
+	while(1)
+	{
+		// A free entry and a gap: done
+		for(ii=0; ii<cache->count; ii++)
+			if(entries[ii].stamp == 0)
+				break;
+		if(ii < cache->count && (ofs= tte_cache_find_gap(size)) >= 0)
+			break;
+
+		// Else evict the least recently used one and try again
+		entry= NULL;
+		for(ii=0; ii<cache->count; ii++)
+			if(entries[ii].stamp && (!entry || entries[ii].stamp < entry->stamp))
+				entry= &entries[ii];
+		if(entry == NULL)
+			return NULL;
+		entry->stamp= 0;
+	}
+
+	entry= &entries[ii];
+	entry->ofs= ofs;
+	entry->size= size;
+	return entry;
+}
+
+//! Get the color that stands for 'nothing drawn' in a cache image.
+/*!	That's the paper, unless the text itself can have that color.
+*/
+static uint tte_cache_key(const TTC *tc)
+{
+	uint key= tc->cattr[TTE_PAPER];
+	while(key == tc->cattr[TTE_INK] || key == tc->cattr[TTE_SHADOW])
+		key= (key+1) & 15;
+	return key;
+}
+
+//! Draw \a entry's image at the cursor.
+static void tte_cache_blit(TTC *tc, const TTextCacheEntry *entry)
+{
+	const TSurface *dst= &tc->dst;
+	const u8 *srcD= &gTextCache.pool[entry->ofs];
+	uint x= tc->cursorX, y= tc->cursorY;
+	uint ox= entry->sub&15, oy= entry->sub>>4;
+	uint width= entry->width, height= entry->height, srfW= entry->srfW;
+	uint dstP= dst->pitch;
+	uint key= tte_cache_key(tc);
+	bool opaque= entry->opaque;
+	uint ix, iy;
+
+	switch(dst->type &~ SRF_ALLOCATED)
+	{
+	case SRF_BMP16:
+		{
+			uint srcP= srf_align(srfW, 16);
+			for(iy=0; iy<height; iy++)
+			{
+				const u16 *srcL= (const u16*)&srcD[iy*srcP];
+				u16 *dstL= (u16*)&dst->data[(y+iy)*dstP + x*2];
+				for(ix=0; ix<width; ix++)
+					if(opaque || srcL[ix] != key)
+						dstL[ix]= srcL[ix];
+			}
+		}
+		break;
+
+	case SRF_BMP8:
+		{
+			// Pairs, starting on the even pixel before x.
+			uint srcP= srf_align(srfW, 8), right= ox+width;
+			u32 px, pxmask;
+			for(iy=0; iy<height; iy++)
+			{
+				const u16 *srcL= (const u16*)&srcD[iy*srcP];
+				u16 *dstL= (u16*)&dst->data[(y+iy)*dstP + x-ox];
+				for(ix=0; ix<right; ix += 2)
+				{
+					px= srcL[ix/2];
+					pxmask= 0;
+					if(ix >= ox && (opaque || (px&255) != key))
+						pxmask |= 0x00FF;
+					if(ix+1 < right && (opaque || (px>>8) != key))
+						pxmask |= 0xFF00;
+					if(pxmask)
+						dstL[ix/2]= (dstL[ix/2] &~ pxmask) | (px & pxmask);
+				}
+			}
+		}
+		break;
+
+	case SRF_CHR4C:
+	case SRF_CHR4R:
+		{
+			// Words of 8 pixels. Edge masks for the first and last
+			// column; paper nibbles go out of the mask if transparent.
+			uint right= ox+width, cols= (right+7)/8, ic;
+			u32 lmask= ~0u<<(ox*4);
+			u32 rmask= right%8 ? ~0u>>(32-right%8*4) : ~0u;
+			u32 keys= octup(key), px, pxmask, colmask, tmp;
+			const u32 *srcL;
+			u32 *dstL;
+
+			bool chr4c= (dst->type &~ SRF_ALLOCATED) == SRF_CHR4C;
+			uint srcP= chr4c ? srf_align(height, 4)*8 : srfW/8*32;
+
+			for(ic=0; ic<cols; ic++)
+			{
+				colmask= ~0u;
+				if(ic == 0)			colmask &= lmask;
+				if(ic == cols-1)	colmask &= rmask;
+
+				for(iy=oy; iy<oy+height; iy++)
+				{
+					if(chr4c)
+					{
+						srcL= (const u32*)&srcD[ic*srcP + iy*4];
+						dstL= (u32*)&dst->data[(x/8+ic)*dstP + (y+iy)*4];
+					}
+					else
+					{
+						uint dy= y-oy+iy;
+						srcL= (const u32*)&srcD[iy/8*srcP + ic*32 + iy%8*4];
+						dstL= (u32*)&dst->data[dy/8*dstP + (x/8+ic)*32 + dy%8*4];
+					}
+
+					px= *srcL;
+					pxmask= colmask;
+					if(!opaque)
+					{
+						tmp= px ^ keys;
+						tmp |= tmp>>2;
+						tmp |= tmp>>1;
+						pxmask &= (tmp & 0x11111111)*15;
+					}
+					if(pxmask)
+						*dstL= (*dstL &~ pxmask) | (px & pxmask);
+				}
+			}
+		}
+		break;
+	}
+}
+
+
+//! Set up the text cache.
+/*!	\param buf		Buffer for the cache; EWRAM is a good place for it.
+	\param size		Size of \a buf in bytes: the cache's budget.
+		Images take multiples of 32 bytes.
+	\param count	Number of entries. These come out of \a buf too,
+		sizeof(TTextCacheEntry) bytes each.
+*/
+void tte_cache_init(void *buf, uint size, uint count)
+{
+	TTextCache *cache= &gTextCache;
+	uint tableSize= count*sizeof(TTextCacheEntry);
+
+	if(buf == NULL || size < tableSize)
+		count= tableSize= 0;
+
+	// Images are 32-byte aligned: the tile renderers find tile
+	// boundaries by address.
+	u8 *pool= (u8*)buf + tableSize;
+	pool += -(u32)pool & 31;
+	if(count && pool+32 > (u8*)buf+size)
+		count= 0;
+
+	cache->entries= (TTextCacheEntry*)buf;
+	cache->pool= pool;
+	cache->poolSize= count ? ((u8*)buf+size-pool) &~ 31 : 0;
+	cache->count= count;
+	cache->stamp= 0;
+
+	tte_cache_flush();
+}
+
+
+//! Drop all cached strings.
+/*!	Needed when the font or the strings change in ways the cache can't
+	see: new glyph data at the same address, for example.
+*/
+void tte_cache_flush(void)
+{
+	TTextCache *cache= &gTextCache;
+	uint ii;
+
+	for(ii=0; ii<cache->count; ii++)
+		cache->entries[ii].stamp= 0;
+}
+
+
+//! Write a string that doesn't change, through the text cache.
+/*!	The first time, the string is rendered into the cache; after that
+	it's copied from there. Strings are told apart by address and
+	contents, font, renderer and color attributes.
+	\param text	String to write.
+	\return	Number of characters used, like tte_write().
+	\note	Only bitmap and 4bpp tile surfaces are cached, and only
+		plain text on a single line that doesn't wrap. Other text is
+		simply passed to tte_write().
+*/
+int tte_cache_write(const char *text)
+{
+	if(text == NULL)
+		return 0;
+
+	TTC *tc= tte_get_context();
+	TTextCache *cache= &gTextCache;
+	const TFont *font= tc->font;
+	uint ii, ch, gid, len, width= 0, hash= 2166136261u;
+	uint reach= 0;
+
+	if(cache->count == 0)
+		return tte_write(text);
+
+	// Only renderers that draw on the surface itself
+	fnErase erase= tc->eraseProc;
+	if(erase != bmp16_erase && erase != bmp8_erase &&
+			erase != chr4c_erase && erase != chr4r_erase)
+		return tte_write(text);
+
+	// --- Measure and hash; bail on anything but plain text ---
+	for(len=0; (ch= (u8)text[len]) != '\0'; len++)
+	{
+		if(ch < ' ' || ch >= 0x80 || (ch == '#' && text[len+1] == '{')
+				|| (ch == '\\' && text[len+1] == '#'))
+			return tte_write(text);
+
+		// Opaque renderers fill whole 8px strips; keep track of how
+		// far those go.
+		gid= tte_get_glyph_id(ch);
+		reach= max(reach, width + ((tte_get_glyph_width(gid)+7)&~7));
+		width += tte_get_glyph_width(gid);
+		hash= (hash ^ ch) * 16777619u;
+	}
+
+	uint x= tc->cursorX, y= tc->cursorY;
+	if(len == 0 || x+width > tc->marginRight)
+		return tte_write(text);
+
+	// --- Look it up ---
+	uint type= tc->dst.type &~ SRF_ALLOCATED, sub;
+	switch(type)
+	{
+	case SRF_BMP8:		sub= x&1;				break;
+	case SRF_CHR4C:		sub= x&7;				break;
+	case SRF_CHR4R:		sub= (x&7) | (y&7)<<4;	break;
+	default:			sub= 0;
+	}
+
+	TTextCacheEntry *entry= NULL;
+	for(ii=0; ii<cache->count; ii++)
+	{
+		TTextCacheEntry *ent= &cache->entries[ii];
+		if(ent->stamp == 0 || ent->text != text)
+			continue;
+
+		if(ent->hash != hash)
+		{
+			// Same buffer, different text: that one's stale.
+			ent->stamp= 0;
+			continue;
+		}
+		if(ent->font == font && ent->proc == tc->drawgProc &&
+			ent->cattr[TTE_INK] == tc->cattr[TTE_INK] &&
+			ent->cattr[TTE_SHADOW] == tc->cattr[TTE_SHADOW] &&
+			ent->cattr[TTE_PAPER] == tc->cattr[TTE_PAPER] &&
+			ent->type == type && ent->sub == sub)
+		{
+			entry= ent;
+			break;
+		}
+	}
+
+	// --- Not there: render it into the cache ---
+	if(entry == NULL)
+	{
+		uint ox= sub&15, oy= sub>>4, height= font->charH, size;
+		bool opaque= tte_is_drawg_opaque();
+		uint key= opaque ? tc->cattr[TTE_PAPER] : tte_cache_key(tc);
+		TSurface srf;
+		u32 fill;
+
+		// The image holds the text. For opaque renderers it also
+		// holds the rest of the last strip, plus 8px for the word
+		// that the chr4 ones carry into the next tile. Only the
+		// text itself is copied to the screen.
+		uint srfW= ox+width;
+		if(opaque)
+			srfW= ox+reach+8;
+		if(type == SRF_CHR4C || type == SRF_CHR4R)
+			srfW= (srfW+7)&~7;
+
+		switch(type)
+		{
+		case SRF_BMP16:
+			srf_init(&srf, SRF_BMP16, NULL, srfW, height, 16, NULL);
+			size= srf.pitch*height;
+			fill= dup16(key);
+			break;
+		case SRF_BMP8:
+			srf_init(&srf, SRF_BMP8, NULL, srfW, height, 8, NULL);
+			size= srf.pitch*height;
+			fill= quad8(key);
+			break;
+		case SRF_CHR4C:
+			srf_init(&srf, SRF_CHR4C, NULL, srfW, height, 4, NULL);
+			size= srf.pitch*srf.width/8;
+			fill= octup(key);
+			break;
+		default:
+			srf_init(&srf, SRF_CHR4R, NULL, srfW, oy+height, 4, NULL);
+			size= srf.pitch*((oy+height+7)/8);
+			fill= octup(key);
+		}
+
+		entry= tte_cache_alloc((size+31) &~ 31);
+		if(entry == NULL)
+			return tte_write(text);
+
+		entry->text= text;
+		entry->hash= hash;
+		entry->font= font;
+		entry->proc= tc->drawgProc;
+		entry->cattr[TTE_INK]= tc->cattr[TTE_INK];
+		entry->cattr[TTE_SHADOW]= tc->cattr[TTE_SHADOW];
+		entry->cattr[TTE_PAPER]= tc->cattr[TTE_PAPER];
+		entry->type= type;
+		entry->sub= sub;
+		entry->opaque= opaque;
+		entry->width= width;
+		entry->height= height;
+		entry->srfW= srfW;
+
+		srf.data= &cache->pool[entry->ofs];
+		memset32(srf.data, fill, size/4);
+
+		// Swap the surface for the cache image and render there
+		TSurface dst= tc->dst;
+		u16 marginRight= tc->marginRight;
+
+		tc->dst= srf;
+		tc->marginRight= srf.width;
+		tc->cursorX= ox;
+		tc->cursorY= oy;
+		tte_write(text);
+
+		tc->dst= dst;
+		tc->marginRight= marginRight;
+		tc->cursorX= x;
+		tc->cursorY= y;
+	}
+
+	entry->stamp= ++cache->stamp;
+	tte_cache_blit(tc, entry);
+	tc->cursorX= x+width;
+
+	return len;
+}
+
+// EOF
@@ -0,0 +1,41 @@
+//
+// Check for paper-filling renderers
+//
+//! \file tte_drawg_opaque.c
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Separate file, so that only the text cache and number fields
+	drag in all the b1cos renderers.
+*/
+
+#include "tonc_tte.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Check if the current renderer fills the paper as well.
+/*!	Opaque renderers don't have to be registered as opaqueProc;
+	tte_init_bmp() with bmp8_drawg_b1cos, say, leaves that empty.
+	\note	The b1cos renderers fill whole 8px strips, so they paint
+		paper past the glyph's own width.
+*/
+bool tte_is_drawg_opaque(void)
+{
+	TTC *tc= tte_get_context();
+	fnDrawg proc= tc->drawgProc;
+
+	if(tc->opaqueProc && proc == tc->opaqueProc)
+		return true;
+
+	return	proc == (fnDrawg)bmp8_drawg_b1cos   || proc == bmp8_drawg_b1cos_fast   ||
+			proc == (fnDrawg)bmp16_drawg_b1cos  || proc == bmp16_drawg_b1cos_fast  ||
+			proc == (fnDrawg)chr4c_drawg_b1cos  || proc == chr4c_drawg_b1cos_fast  ||
+			proc == (fnDrawg)chr4r_drawg_b1cos  || proc == chr4r_drawg_b1cos_fast;
+}
+
+// EOF
@@ -0,0 +1,198 @@
+//
+// Affine tile plotter, VWF
+//
+//! \file tte_init_ase_vwf.c
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Glyphs aren't tiles here; they're drawn into tiles that are handed
+	out to map cells as needed. So any font that the bitmap renderers
+	take works, and it only costs tiles for cells with text in them.
+  * Affine maps have 8bpp entries, so there are 256 tiles at most,
+	blank tile included. A full screen of text won't fit in that;
+	keep the panels small.
+*/
+
+#include "tonc_memdef.hpp"
+#include "tonc_core.hpp"
+#include "tonc_math.hpp"
+#include "tonc_surface.hpp"
+
+#include "tonc_tte.hpp"
+
+
+// --------------------------------------------------------------------
+// GLOBALS
+// --------------------------------------------------------------------
+
+
+TAsePool gAsePool;
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Initialize text system for VWF text on affine backgrounds.
+/*!	Sets the map to \a tid and uses tiles \a tid+1 to \a tid+count-1
+	for the text.
+	\param bgnr		Background number.
+	\param bgcnt	Background control flags.
+	\param tid		Blank tile; the pool follows it.
+	\param count	Number of tiles, blank tile included.
+	\param cattrs	Color attributes; one byte per attr.
+	\param clrs		ink(/shadow) colors.
+	\param font		Font to initialize with.
+	\param proc		Glyph renderer.
+*/
+void tte_init_ase_vwf(int bgnr, u16 bgcnt, uint tid, uint count,
+	u32 cattrs, u32 clrs, const TFont *font, fnDrawg proc)
+{
+	if(font==NULL)	font= &vwf_default;
+	if(proc==NULL)	proc= ase_vwf_drawg_b1cts;
+
+	tte_init_base(font, proc, ase_vwf_erase);
+
+	TTC *tc= tte_get_context();
+	TAsePool *pool= &gAsePool;
+	uint size= 16<<BFN_GET(bgcnt, BG_SIZE);
+
+	srf_init(&tc->dst, SRF_BMP8, se_mem[BFN_GET(bgcnt, BG_SBB)],
+		size, size, 8, pal_bg_mem);
+
+	tc->marginRight= size*8;
+	tc->marginBottom= size*8;
+
+	tc->flags0= bgnr;
+	tc->ctrl= bgcnt;
+	REG_BGCNT[bgnr]= bgcnt;
+
+	// --- Init color attributes ---
+	u32 ink, shadow, paper;
+	ink=	 cattrs     & 255;
+	shadow=	(cattrs>> 8)& 255;
+	paper=	(cattrs>>16)& 255;
+
+	tc->cattr[TTE_INK]= ink;
+	tc->cattr[TTE_SHADOW]= shadow;
+	tc->cattr[TTE_PAPER]= paper;
+
+	pal_bg_mem[ink]= clrs&0xFFFF;
+	pal_bg_mem[shadow]= clrs>>16;
+
+	// --- Tile pool and map ---
+	memset32(pool, 0, sizeof(TAsePool)/4);
+	pool->tiles= (u8*)tile_mem[BFN_GET(bgcnt, BG_CBB)];
+	pool->blank= tid;
+	pool->end= min(tid+count, 256);
+	pool->next= tid+1;
+	pool->paper= paper;
+
+	memset32(&pool->tiles[tid*64], quad8(paper), 16);
+	memset32(tc->dst.data, quad8(tid), size*size/4);
+}
+
+
+//! Get the tile of map cell (\a tx, \a ty) to draw in.
+/*!	A cell that still has the blank tile is given a tile from the
+	pool, filled with the blank tile's paper.
+	\return	The tile, or NULL if the pool has run out.
+*/
+u8 *ase_vwf_get_tile(uint tx, uint ty)
+{
+	TTC *tc= tte_get_context();
+	TAsePool *pool= &gAsePool;
+	uint tid= _sbmp8_get_pixel(&tc->dst, tx, ty);
+
+	if(tid == pool->blank)
+	{
+		// Find a free tile, starting at the hint
+		uint ii, count= pool->end - pool->blank - 1;
+		tid= pool->next;
+		for(ii=0; ii<count; ii++, tid++)
+		{
+			if(tid >= pool->end)
+				tid= pool->blank+1;
+			if(~pool->used[tid/32] & BIT(tid%32))
+				break;
+		}
+		if(ii == count)
+			return NULL;
+
+		pool->used[tid/32] |= BIT(tid%32);
+		pool->next= tid+1;
+		memset32(&pool->tiles[tid*64], quad8(pool->paper), 16);
+		_sbmp8_plot(&tc->dst, tx, ty, tid);
+	}
+
+	return &pool->tiles[tid*64];
+}
+
+
+//! Erase part of the affine VWF canvas.
+/*!	Cells that are erased completely with the blank tile's paper go
+	back to the blank tile. Erasing the whole map with another paper
+	recolors the blank tile instead.
+*/
+void ase_vwf_erase(int left, int top, int right, int bottom)
+{
+	TTC *tc= tte_get_context();
+	TAsePool *pool= &gAsePool;
+	uint paper= tc->cattr[TTE_PAPER];
+	int width= tc->dst.width*8, height= tc->dst.height*8;
+
+	left= max(left, 0);			top= max(top, 0);
+	right= min(right, width);	bottom= min(bottom, height);
+	if(left >= right || top >= bottom)
+		return;
+
+	if(left == 0 && top == 0 && right == width && bottom == height)
+	{
+		memset32(pool->used, 0, 8);
+		pool->next= pool->blank+1;
+		pool->paper= paper;
+		memset32(&pool->tiles[pool->blank*64], quad8(paper), 16);
+		memset32(tc->dst.data, quad8(pool->blank), tc->dst.width*tc->dst.height/4);
+		return;
+	}
+
+	// A single tile as an 8bpp surface, for the partly erased cells.
+	TSurface srf= { NULL, 8, 8, 8, 8, SRF_BMP8, 0, NULL };
+	int tx, ty, x0, y0;
+	uint tid;
+
+	for(ty=top/8; ty*8<bottom; ty++)
+	{
+		for(tx=left/8; tx*8<right; tx++)
+		{
+			x0= tx*8;	y0= ty*8;
+			tid= _sbmp8_get_pixel(&tc->dst, tx, ty);
+
+			if(paper == pool->paper && left <= x0 && x0+8 <= right &&
+				top <= y0 && y0+8 <= bottom)
+			{
+				// All of it: back to blank
+				if(tid != pool->blank)
+				{
+					pool->used[tid/32] &= ~BIT(tid%32);
+					_sbmp8_plot(&tc->dst, tx, ty, pool->blank);
+				}
+				continue;
+			}
+
+			if(tid == pool->blank && paper == pool->paper)
+				continue;
+
+			srf.data= ase_vwf_get_tile(tx, ty);
+			if(srf.data == NULL)
+				return;
+
+			sbmp8_rect(&srf, max(left-x0, 0), max(top-y0, 0),
+				min(right-x0, 8), min(bottom-y0, 8), paper);
+		}
+	}
+}
+
+// EOF
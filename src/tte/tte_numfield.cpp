@@ -0,0 +1,218 @@
+//
+// Number fields: on-screen numbers that only redraw what changes
+//
+//! \file tte_numfield.c
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * A field remembers the string it last drew, plus the font and
+	colors it drew it with. A new value is laid out with the current
+	font; characters that are the same and sit in the same place stay,
+	the old glyphs of the others are erased and their new glyphs drawn.
+	For a score counter that's usually just the last digit or two.
+  * This works for any font. With a fixed-width font or tabular VWF
+	digits, characters only move when the length changes. With
+	proportional digits, everything after the first changed digit
+	may move and is redrawn. Right-aligned fields move everything
+	when the total width changes.
+  * Opaque renderers (see tte_is_drawg_opaque()) can fill whole 8px
+	strips, so a glyph narrower than that also paints paper over the
+	left of the next one. Kept glyphs in that reach are redrawn as
+	well. Old glyphs that are fully covered by the new glyph itself
+	aren't erased first; bmp8_drawg_b1cos only clears the glyph's
+	width, so the strip can't be counted on there.
+  * A different font or ink/shadow/paper means a full redraw. If
+	something else wipes the field, call tte_numfield_erase().
+  * The cursor isn't moved, and there's no wrapping.
+*/
+
+#include "tonc_math.hpp"
+#include "tonc_tte.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Get the glyph positions of \a str; \a pos gets \a len+1 entries.
+static void numfield_layout(const TNumField *nf, const TFont *font,
+	const char *str, uint len, uint *gids, int *pos)
+{
+	TTC *tc= tte_get_context();
+	TFont *cfont= tc->font;
+	uint ii, gid;
+
+	// The glyph helpers use the context's font.
+	tc->font= (TFont*)font;
+	pos[0]= 0;
+	for(ii=0; ii<len; ii++)
+	{
+		gid= tte_get_glyph_id(str[ii]);
+		gids[ii]= gid;
+		pos[ii+1]= pos[ii] + tte_get_glyph_width(gid);
+	}
+	tc->font= cfont;
+
+	int x0= nf->right ? nf->x - pos[len] : nf->x;
+	for(ii=0; ii<=len; ii++)
+		pos[ii] += x0;
+}
+
+
+//! Get the right edge of what an opaque renderer paints for glyph \a ii.
+/*!	The b1cos renderers fill whole 8px strips.
+*/
+static inline int numfield_strip(const int *pos, uint ii)
+{
+	return pos[ii] + ((pos[ii+1]-pos[ii]+7)&~7);
+}
+
+
+//! Set up a number field. Nothing is drawn yet.
+/*!	\param nf		Field to initialize.
+	\param x		Left edge; or the right edge if \a right is set.
+	\param y		Top edge.
+	\param width	Minimum number of characters; padded on the left.
+		At most TTE_PRINT_MAX.
+	\param pad		Padding character; usually ' ' or '0'.
+	\param right	Right-align on \a x.
+*/
+void tte_numfield_init(TNumField *nf, int x, int y, uint width, char pad,
+	bool right)
+{
+	nf->font= NULL;
+	nf->x= x;
+	nf->y= y;
+	nf->width= min(width, TTE_PRINT_MAX);
+	nf->pad= pad;
+	nf->right= right;
+	nf->len= 0;
+	nf->str[0]= '\0';
+}
+
+
+//! Show a signed number in a field.
+/*!	See int_to_str() for the formatting.
+*/
+void tte_numfield_set(TNumField *nf, int value)
+{
+	char str[TTE_PRINT_MAX+1];
+
+	int_to_str(str, value, nf->width, nf->pad);
+	tte_numfield_set_str(nf, str);
+}
+
+
+//! Show a fixed-point number in a field.
+/*!	See fx_to_str() for the formatting. The field's width and
+	padding aren't used.
+*/
+void tte_numfield_set_fixed(TNumField *nf, FIXED value, uint fbits,
+	uint decimals)
+{
+	char str[TTE_PRINT_MAX+1];
+
+	decimals= min(decimals, TTE_PRINT_MAX-12);
+	fx_to_str(str, value, fbits, decimals);
+	tte_numfield_set_str(nf, str);
+}
+
+
+//! Show a string in a field, redrawing only the characters that changed.
+/*!	\param nf	Field.
+	\param str	Plain characters, no commands; at most TTE_PRINT_MAX.
+*/
+void tte_numfield_set_str(TNumField *nf, const char *str)
+{
+	TTE_BASE_VARS(tc, font);
+	const TFont *ofont= nf->font;
+	uint ii, len, olen= nf->len;
+	uint gids[TTE_PRINT_MAX], ogids[TTE_PRINT_MAX];
+	int pos[TTE_PRINT_MAX+1], opos[TTE_PRINT_MAX+1];
+
+	for(len=0; len<TTE_PRINT_MAX && str[len]; len++) ;
+	numfield_layout(nf, font, str, len, gids, pos);
+
+	if(ofont == NULL)
+		olen= 0;
+	if(olen)
+		numfield_layout(nf, ofont, nf->str, olen, ogids, opos);
+
+	// Glyphs drawn with another font or colors can't stay.
+	bool keep= ofont == font && nf->cattr[0] == tc->cattr[TTE_INK] &&
+		nf->cattr[1] == tc->cattr[TTE_SHADOW] &&
+		nf->cattr[2] == tc->cattr[TTE_PAPER];
+	bool opaque= tte_is_drawg_opaque();
+	int top= nf->y;
+
+	// Erase the old glyphs that go, in runs.
+	int left= 0, right= 0;
+	for(ii=0; ii<olen; ii++)
+	{
+		bool same= ii<len && opos[ii] == pos[ii];
+		if(same && ((keep && nf->str[ii] == str[ii]) ||
+			(opaque && ofont == font && opos[ii+1] <= pos[ii+1])))
+		{
+			if(left < right)
+				tc->eraseProc(left, top, right, top+ofont->charH);
+			left= right= 0;
+			continue;
+		}
+
+		if(left == right)
+			left= opos[ii];
+		right= opos[ii+1];
+	}
+	if(left < right)
+		tc->eraseProc(left, top, right, top+ofont->charH);
+
+	// Draw the new glyphs that changed. An opaque redraw paints paper
+	// up to the end of its last strip, over any kept glyphs there.
+	int cx= tc->cursorX, cy= tc->cursorY;
+	int reach= pos[0];
+	tc->cursorY= top;
+	for(ii=0; ii<len; ii++)
+	{
+		if(keep && ii<olen && opos[ii] == pos[ii] && nf->str[ii] == str[ii]
+			&& !(opaque && reach > pos[ii]))
+			continue;
+		tc->cursorX= pos[ii];
+		tc->drawgProc(gids[ii]);
+		if(opaque)
+			reach= max(reach, numfield_strip(pos, ii));
+	}
+	tc->cursorX= cx;
+	tc->cursorY= cy;
+
+	for(ii=0; ii<len; ii++)
+		nf->str[ii]= str[ii];
+	nf->str[len]= '\0';
+	nf->len= len;
+	nf->font= font;
+	nf->cattr[0]= tc->cattr[TTE_INK];
+	nf->cattr[1]= tc->cattr[TTE_SHADOW];
+	nf->cattr[2]= tc->cattr[TTE_PAPER];
+}
+
+
+//! Erase what a field shows and forget it.
+/*!	Uses the current paper color.
+*/
+void tte_numfield_erase(TNumField *nf)
+{
+	TTC *tc= tte_get_context();
+	uint gids[TTE_PRINT_MAX];
+	int pos[TTE_PRINT_MAX+1];
+
+	if(nf->len && nf->font)
+	{
+		numfield_layout(nf, nf->font, nf->str, nf->len, gids, pos);
+		tc->eraseProc(pos[0], nf->y, pos[nf->len], nf->y+nf->font->charH);
+	}
+	nf->len= 0;
+	nf->str[0]= '\0';
+}
+
+// EOF
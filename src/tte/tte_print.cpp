@@ -0,0 +1,101 @@
+//
+// Number printing, without printf
+//
+//! \file tte_print.c
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * The number is formatted with the tonc_math formatters and its
+	characters go straight to the renderer as glyph ids. There's no
+	command parsing and no newlib, so a score counter takes a few
+	hundred cycles plus the glyphs themselves.
+  * The number wraps as a whole, not digit by digit.
+*/
+
+#include "tonc_math.hpp"
+#include "tonc_tte.hpp"
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Draw \a len plain characters at the cursor.
+static int tte_print_plain(const char *str, uint len)
+{
+	TTE_BASE_VARS(tc, font);
+	uint ii, gid, gids[TTE_PRINT_MAX];
+	u8 widths[TTE_PRINT_MAX];
+	int width= 0;
+
+	len= min(len, TTE_PRINT_MAX);
+	for(ii=0; ii<len; ii++)
+	{
+		gid= tte_get_glyph_id(str[ii]);
+		gids[ii]= gid;
+		widths[ii]= tte_get_glyph_width(gid);
+		width += widths[ii];
+	}
+
+	if(tc->cursorX+width > tc->marginRight)
+	{
+		tc->cursorY += font->charH;
+		tc->cursorX  = tc->marginLeft;
+	}
+
+	for(ii=0; ii<len; ii++)
+	{
+		tc->drawgProc(gids[ii]);
+		tc->cursorX += widths[ii];
+	}
+
+	return len;
+}
+
+
+//! Print an unsigned number at the cursor.
+/*!	\param value	Value to print.
+	\param width	Minimum number of characters; padded on the left.
+		At most TTE_PRINT_MAX.
+	\param pad		Padding character; usually ' ' or '0'.
+	\return	Number of characters printed.
+*/
+int tte_print_uint(u32 value, uint width, char pad)
+{
+	char str[TTE_PRINT_MAX+1];
+
+	width= min(width, TTE_PRINT_MAX);
+	return tte_print_plain(str, uint_to_str(str, value, width, pad));
+}
+
+
+//! Print a signed number at the cursor.
+/*!	Like tte_print_uint(); see int_to_str() for where the sign goes.
+*/
+int tte_print_int(int value, uint width, char pad)
+{
+	char str[TTE_PRINT_MAX+1];
+
+	width= min(width, TTE_PRINT_MAX);
+	return tte_print_plain(str, int_to_str(str, value, width, pad));
+}
+
+
+//! Print a fixed-point number at the cursor.
+/*!	\param value	Value to print.
+	\param fbits	Number of fractional bits, up to 28.
+	\param decimals	Number of decimals, cut off rather than rounded.
+		At most TTE_PRINT_MAX-12.
+	\return	Number of characters printed.
+*/
+int tte_print_fixed(FIXED value, uint fbits, uint decimals)
+{
+	char str[TTE_PRINT_MAX+1];
+
+	decimals= min(decimals, TTE_PRINT_MAX-12);
+	return tte_print_plain(str, fx_to_str(str, value, fbits, decimals));
+}
+
+// EOF
@@ -0,0 +1,663 @@
+//
+// Font converter: BDF/PNG to TFont sources
+//
+//! \file fontconv.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Build on the host:
+	  g++ -O2 -o fontconv fontconv.cpp fontconv_load.cpp fontconv_zip.cpp
+	or use the Makefile in this directory.
+  * Glyphs are stored in the layout all TTE renderers walk: a cell is
+	split into 8-pixel wide vertical strips, and a strip is cellH rows
+	of a byte (1bpp, bit 0 leftmost) or a word (4bpp, 1=ink, 2=shadow).
+	A glyph is one contiguous run and the renderers read it front to
+	back. For the tile renderers (se, ase, obj), --tiles pads the cell
+	height to full tiles; the bitmap and chr4 renderers don't need that,
+	so by default the cells are as high as the font and no higher.
+  * Several code-point ranges give a character LUT as well: index it
+	with ch-charOffset for the glyph id, and set TTC.charLut to it.
+  * No TTF rasterizer here; render TTFs to BDF first (otf2bdf, or
+	fontforge's export) and convert that.
+*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include <map>
+
+#include "fontconv.hpp"
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! Conversion options.
+struct TConvOpts
+{
+	const char	*inPath, *outPath;
+	std::string	name;
+	uint	bpp;
+	std::vector<uint>	ranges;		//!< Pairs of first, last code.
+	int		cellW, cellH;			//!< Forced cell size, or 0.
+	bool	tiles;					//!< Pad cell height to 8.
+	bool	trim;					//!< Drop rows that are always empty.
+	bool	fixed;					//!< No width table.
+	bool	shadow;					//!< Add a drop shadow (4bpp).
+	bool	lz77;					//!< Compress the glyphs.
+	bool	cpp;					//!< C++ output instead of asm.
+	uint	defCode;				//!< Glyph for LUT gaps.
+	TGridInfo	grid;
+};
+
+//! The converted font.
+struct TFontData
+{
+	uint	charOffset, charCount;
+	uint	charW, charH, cellW, cellH, cellSize;
+	std::vector<u8>	glyphs;			//!< Packed glyphs (or LZ77 data).
+	uint	rawSize;				//!< Size of the unpacked glyphs.
+	std::vector<u8>	widths;			//!< Empty for fixed-width fonts.
+	std::vector<u8>	lut;			//!< Empty without LUT.
+};
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+static void usage()
+{
+	fprintf(stderr,
+"Usage: fontconv [options] font.bdf|sheet.png\n"
+"  -o FILE      Output; .c/.cpp gives C++, else asm (default: stdout, asm)\n"
+"  -n NAME      Symbol name, giving NAMEFont, NAMEGlyphs, NAMEWidths\n"
+"  -b BPP       1 (default) or 4\n"
+"  -r A-B       Code-point range; may be repeated (default: all glyphs)\n"
+"  -d CODE      Glyph for codes between ranges (default '?')\n"
+"  -C WxH       Cell size (default: smallest that fits)\n"
+"  -t, --tiles  Cell height in whole tiles, for se/ase/obj renderers\n"
+"  -T, --trim   Drop rows that are empty in every glyph\n"
+"  -f, --fixed  Fixed width: no width table\n"
+"  -s, --shadow Add a drop shadow (4bpp only)\n"
+"  -z, --lz77   LZ77-compress the glyphs for the BIOS routines\n"
+"PNG sheets only:\n"
+"  -c WxH       Grid cell size (required)\n"
+"  -F CODE      Code of the top-left cell (default 32)\n"
+"  -p N         Space after the ink of VWF glyphs (default 1)\n"
+"  -S N         Advance of empty VWF glyphs (default cellW/2)\n");
+	exit(1);
+}
+
+static void fail(const char *msg, const char *arg)
+{
+	fprintf(stderr, "fontconv: %s%s%s\n", msg, arg ? ": " : "", arg ? arg : "");
+	exit(1);
+}
+
+static bool ends_with(const char *str, const char *end)
+{
+	size_t len= strlen(str), elen= strlen(end);
+	return len >= elen && strcmp(str+len-elen, end) == 0;
+}
+
+//! Parse a code: number (dec/hex/oct) or a single character.
+static uint parse_code(const char *str)
+{
+	if(str[0] && !str[1] && (str[0] < '0' || str[0] > '9'))
+		return (u8)str[0];
+	return strtoul(str, NULL, 0);
+}
+
+static void parse_args(int argc, char *argv[], TConvOpts *opts)
+{
+	static const option longOpts[]=
+	{
+		{ "tiles",	no_argument, NULL, 't' },
+		{ "trim",	no_argument, NULL, 'T' },
+		{ "fixed",	no_argument, NULL, 'f' },
+		{ "shadow",	no_argument, NULL, 's' },
+		{ "lz77",	no_argument, NULL, 'z' },
+		{ NULL, 0, NULL, 0 }
+	};
+
+	opts->outPath= NULL;
+	opts->bpp= 1;
+	opts->cellW= opts->cellH= 0;
+	opts->tiles= opts->trim= opts->fixed= false;
+	opts->shadow= opts->lz77= opts->cpp= false;
+	opts->defCode= '?';
+	opts->grid.cellW= opts->grid.cellH= 0;
+	opts->grid.first= ' ';
+	opts->grid.spacing= 1;
+	opts->grid.spaceW= -1;
+
+	int opt;
+	char *end;
+	while((opt= getopt_long(argc, argv, "o:n:b:r:d:C:tTfszc:F:p:S:",
+		longOpts, NULL)) != -1)
+	{
+		switch(opt)
+		{
+		case 'o':	opts->outPath= optarg;						break;
+		case 'n':	opts->name= optarg;							break;
+		case 'b':	opts->bpp= atoi(optarg);					break;
+		case 'd':	opts->defCode= parse_code(optarg);			break;
+		case 't':	opts->tiles= true;							break;
+		case 'T':	opts->trim= true;							break;
+		case 'f':	opts->fixed= true;							break;
+		case 's':	opts->shadow= true;							break;
+		case 'z':	opts->lz77= true;							break;
+		case 'F':	opts->grid.first= parse_code(optarg);		break;
+		case 'p':	opts->grid.spacing= atoi(optarg);			break;
+		case 'S':	opts->grid.spaceW= atoi(optarg);			break;
+		case 'r':
+			{
+				uint first= strtoul(optarg, &end, 0), last= first;
+				if(*end == '-')
+					last= strtoul(end+1, &end, 0);
+				if(*end || last < first)
+					fail("bad range", optarg);
+				opts->ranges.push_back(first);
+				opts->ranges.push_back(last);
+			}
+			break;
+		case 'C':
+		case 'c':
+			{
+				int ww= strtol(optarg, &end, 0), hh= 0;
+				if(*end == 'x')
+					hh= strtol(end+1, &end, 0);
+				if(*end || ww <= 0 || hh <= 0)
+					fail("bad size", optarg);
+				if(opt == 'C')
+				{	opts->cellW= ww;		opts->cellH= hh;		}
+				else
+				{	opts->grid.cellW= ww;	opts->grid.cellH= hh;	}
+			}
+			break;
+		default:
+			usage();
+		}
+	}
+
+	if(optind != argc-1)
+		usage();
+	if(opts->bpp != 1 && opts->bpp != 4)
+		fail("bpp must be 1 or 4", NULL);
+	if(opts->shadow && opts->bpp != 4)
+		fail("shadows need 4bpp", NULL);
+
+	opts->inPath= argv[optind];
+	opts->cpp= opts->outPath && (ends_with(opts->outPath, ".c") ||
+		ends_with(opts->outPath, ".cpp") || ends_with(opts->outPath, ".cc"));
+	opts->grid.fixed= opts->fixed;
+	if(opts->grid.spaceW < 0)
+		opts->grid.spaceW= opts->grid.cellW/2;
+
+	// Name from the file: path and extension off, C-safe.
+	if(opts->name.empty())
+	{
+		const char *base= strrchr(opts->inPath, '/');
+		opts->name= base ? base+1 : opts->inPath;
+		opts->name= opts->name.substr(0, opts->name.find('.'));
+	}
+	for(size_t ii=0; ii<opts->name.size(); ii++)
+	{
+		char ch= opts->name[ii];
+		if(!(isalnum(ch) || ch == '_') || (ii == 0 && isdigit(ch)))
+			opts->name[ii]= '_';
+	}
+}
+
+
+//! Add a shadow down-right of the ink. Boxes grow by a pixel each way.
+static void add_shadow(TRawFont *font)
+{
+	int lineH= font->lineH+1;
+	for(size_t gid=0; gid<font->glyphs.size(); gid++)
+	{
+		TRawGlyph *glyph= &font->glyphs[gid];
+		int ww= glyph->width+1, ix, iy;
+		std::vector<u8> pixels(ww*lineH, 0);
+
+		for(iy=0; iy<font->lineH; iy++)
+			for(ix=0; ix<glyph->width; ix++)
+				pixels[iy*ww+ix]= glyph->pixels[iy*glyph->width+ix];
+
+		for(iy=0; iy<font->lineH; iy++)
+			for(ix=0; ix<glyph->width; ix++)
+				if(glyph->pixels[iy*glyph->width+ix] == 1 &&
+					pixels[(iy+1)*ww+ix+1] == 0)
+					pixels[(iy+1)*ww+ix+1]= 2;
+
+		glyph->width= ww;
+		glyph->pixels.swap(pixels);
+	}
+	font->lineH= lineH;
+}
+
+//! Drop the rows at the top and bottom that have no pixels in any glyph.
+static void trim_rows(TRawFont *font)
+{
+	int top= font->lineH, bottom= 0, ix, iy;
+	for(size_t gid=0; gid<font->glyphs.size(); gid++)
+	{
+		const TRawGlyph *glyph= &font->glyphs[gid];
+		for(iy=0; iy<font->lineH; iy++)
+			for(ix=0; ix<glyph->width; ix++)
+				if(glyph->pixels[iy*glyph->width+ix])
+				{
+					if(iy < top)		top= iy;
+					if(iy >= bottom)	bottom= iy+1;
+				}
+	}
+	if(top >= bottom)
+		return;
+
+	for(size_t gid=0; gid<font->glyphs.size(); gid++)
+	{
+		TRawGlyph *glyph= &font->glyphs[gid];
+		glyph->pixels.erase(glyph->pixels.begin() + bottom*glyph->width,
+			glyph->pixels.end());
+		glyph->pixels.erase(glyph->pixels.begin(),
+			glyph->pixels.begin() + top*glyph->width);
+	}
+	font->lineH= bottom-top;
+}
+
+//! Width up to and including the last column with pixels.
+static int ink_width(const TRawGlyph *glyph, int lineH)
+{
+	int ix, iy;
+	for(ix=glyph->width-1; ix>=0; ix--)
+		for(iy=0; iy<lineH; iy++)
+			if(glyph->pixels[iy*glyph->width+ix])
+				return ix+1;
+	return 0;
+}
+
+
+//! Pick glyphs and layout, and pack the glyphs.
+static void convert(const TConvOpts *opts, TRawFont *font, TFontData *fd)
+{
+	uint ii, code;
+
+	// --- Pick glyphs by code ---
+	std::map<uint, const TRawGlyph*> byCode;
+	for(ii=0; ii<font->glyphs.size(); ii++)
+	{
+		code= font->glyphs[ii].code;
+		bool wanted= opts->ranges.empty();
+		for(size_t ir=0; ir<opts->ranges.size(); ir += 2)
+			if(code >= opts->ranges[ir] && code <= opts->ranges[ir+1])
+				wanted= true;
+		if(wanted)
+			byCode[code]= &font->glyphs[ii];
+	}
+	if(byCode.empty())
+		fail("no glyphs in the given ranges", NULL);
+
+	uint first= byCode.begin()->first, last= byCode.rbegin()->first;
+	if(last > 0xFFFF)
+		fail("code points must fit in 16 bits", NULL);
+
+	// The codes between first and last that were asked for. If that's
+	// all of them, missing glyphs are left blank; otherwise the gaps go
+	// through a LUT.
+	bool contiguous= true;
+	for(code=first; code<=last; code++)
+	{
+		bool wanted= opts->ranges.empty();
+		for(size_t ir=0; ir<opts->ranges.size(); ir += 2)
+			if(code >= opts->ranges[ir] && code <= opts->ranges[ir+1])
+				wanted= true;
+		if(!wanted || (opts->ranges.empty() && !byCode.count(code)))
+			contiguous= false;
+	}
+
+	std::vector<const TRawGlyph*> glyphs;
+	if(contiguous)
+	{
+		for(code=first; code<=last; code++)
+		{
+			if(!byCode.count(code))
+				fprintf(stderr, "fontconv: no glyph for %u; left blank\n", code);
+			glyphs.push_back(byCode.count(code) ? byCode[code] : NULL);
+		}
+	}
+	else
+	{
+		if(byCode.size() > 256)
+			fail("too many glyphs for a LUT (max 256)", NULL);
+
+		std::map<uint, uint> gids;
+		std::map<uint, const TRawGlyph*>::const_iterator it;
+		for(it=byCode.begin(); it != byCode.end(); ++it)
+		{
+			gids[it->first]= glyphs.size();
+			glyphs.push_back(it->second);
+		}
+
+		uint defGid= gids.count(opts->defCode) ? gids[opts->defCode] : 0;
+		for(code=first; code<=last; code++)
+			fd->lut.push_back(gids.count(code) ? gids[code] : defGid);
+	}
+
+	fd->charOffset= first;
+	fd->charCount= glyphs.size();
+
+	// --- Layout ---
+	int maxAdv= 0, maxInk= 0;
+	for(ii=0; ii<glyphs.size(); ii++)
+	{
+		if(glyphs[ii] == NULL)
+			continue;
+		int ink= ink_width(glyphs[ii], font->lineH);
+		if(glyphs[ii]->advance > maxAdv)	maxAdv= glyphs[ii]->advance;
+		if(ink > maxInk)					maxInk= ink;
+	}
+	if(maxAdv > 255 || font->lineH > 255)
+		fail("glyphs too large", NULL);
+
+	fd->charW= maxAdv > maxInk ? maxAdv : maxInk;
+	fd->charH= font->lineH;
+	fd->cellW= (fd->charW+7)&~7;
+	fd->cellH= opts->tiles ? (fd->charH+7)&~7 : fd->charH;
+
+	if(opts->cellW)
+	{
+		if(opts->cellW%8 || opts->cellW < (int)fd->cellW ||
+			opts->cellH < (int)fd->cellH)
+			fail("cell size must be a multiple of 8 wide and fit the glyphs", NULL);
+		fd->cellW= opts->cellW;
+		fd->cellH= opts->cellH;
+	}
+	if(fd->cellW == 0)
+		fd->cellW= 8;
+	if(fd->cellH > 255)
+		fail("cell too high", NULL);
+
+	uint strips= fd->cellW/8, rowSize= opts->bpp == 1 ? 1 : 4;
+	fd->cellSize= strips*fd->cellH*rowSize;
+	if(fd->cellSize > 0xFFFF)
+		fail("cell too large", NULL);
+
+	// --- Pack: strip by strip, rows in a strip in order ---
+	std::vector<u8> data(glyphs.size()*fd->cellSize, 0);
+	for(ii=0; ii<glyphs.size(); ii++)
+	{
+		const TRawGlyph *glyph= glyphs[ii];
+		if(!opts->fixed)
+		{
+			int width= glyph ? glyph->advance : 0;
+			fd->widths.push_back(width < 0 ? 0 : width);
+		}
+		if(glyph == NULL)
+			continue;
+
+		u8 *dstD= &data[ii*fd->cellSize];
+		int ix, iy, w= glyph->width < (int)fd->cellW ? glyph->width : fd->cellW;
+		for(iy=0; iy<font->lineH; iy++)
+		{
+			for(ix=0; ix<w; ix++)
+			{
+				uint px= glyph->pixels[iy*glyph->width+ix];
+				if(px == 0)
+					continue;
+
+				u8 *dstL= &dstD[(ix/8*fd->cellH + iy)*rowSize];
+				if(opts->bpp == 1)
+					dstL[0] |= 1<<(ix%8);
+				else
+					dstL[ix%8/2] |= (px&15)<<(ix%2*4);
+			}
+		}
+	}
+
+	while(data.size()%4)
+		data.push_back(0);
+
+	fd->rawSize= data.size();
+	if(opts->lz77)
+		lz77_compress(&data[0], data.size(), &fd->glyphs);
+	else
+		fd->glyphs.swap(data);
+}
+
+
+// --------------------------------------------------------------------
+// OUTPUT
+// --------------------------------------------------------------------
+
+
+//! Character for the description: 'c' if printable, else the number.
+static std::string code_str(uint code)
+{
+	char buf[16];
+	if(code >= ' ' && code < 0x7F && code != '\'')
+		sprintf(buf, "'%c'", code);
+	else
+		sprintf(buf, "%u", code);
+	return buf;
+}
+
+static void write_asm(FILE *fp, const TConvOpts *opts, const TRawFont *font,
+	const TFontData *fd)
+{
+	const char *name= opts->name.c_str();
+	uint ii;
+
+	fprintf(fp, "\n@{{BLOCK(%s)\n\n", name);
+	fprintf(fp, "@ %s, %s to %s, %dbpp%s\n\n", font->name.c_str(),
+		code_str(fd->charOffset).c_str(),
+		code_str(fd->charOffset + (fd->lut.empty() ? fd->charCount : fd->lut.size()) - 1).c_str(),
+		opts->bpp, opts->lz77 ? ", LZ77" : "");
+
+	if(opts->lz77)
+	{
+		fprintf(fp, "@ The glyphs are compressed: decompress %sGlyphsLz to\n", name);
+		fprintf(fp, "@ %u bytes of RAM with LZ77UnCompWram() and set %sFont.data\n", fd->rawSize, name);
+		fprintf(fp, "@ to it before use.\n\n");
+	}
+
+	// Font struct
+	fprintf(fp, "\t.section %s\n", opts->lz77 ? ".data" : ".rodata");
+	fprintf(fp, "\t.align\t2\n");
+	fprintf(fp, "\t.global\t%sFont\n", name);
+	fprintf(fp, "%sFont:\n", name);
+	if(opts->lz77)
+		fprintf(fp, "\t.word\t0, ");
+	else
+		fprintf(fp, "\t.word\t%sGlyphs, ", name);
+	if(fd->widths.empty())
+		fprintf(fp, "0, 0\n");
+	else
+		fprintf(fp, "%sWidths, 0\n", name);
+	fprintf(fp, "\t.hword\t%u, %u\n", fd->charOffset, fd->charCount);
+	fprintf(fp, "\t.byte\t%u, %u\n", fd->charW, fd->charH);
+	fprintf(fp, "\t.byte\t%u, %u\n", fd->cellW, fd->cellH);
+	fprintf(fp, "\t.hword\t%u\n", fd->cellSize);
+	fprintf(fp, "\t.byte\t%u, 0\n\n", opts->bpp);
+
+	// Glyphs, as words
+	fprintf(fp, "\t.section .rodata\n");
+	fprintf(fp, "\t.align\t2\n");
+	fprintf(fp, "\t.global %sGlyphs%s\t\t@ %u unsigned chars\n",
+		name, opts->lz77 ? "Lz" : "", (uint)fd->glyphs.size());
+	fprintf(fp, "%sGlyphs%s:\n", name, opts->lz77 ? "Lz" : "");
+	for(ii=0; ii<fd->glyphs.size(); ii += 4)
+	{
+		const u8 *src= &fd->glyphs[ii];
+		if(ii%32 == 0)
+			fprintf(fp, "\t.word ");
+		fprintf(fp, "0x%08X", src[0] | src[1]<<8 | src[2]<<16 | src[3]<<24);
+		if(ii%32 == 28 || ii+4 >= fd->glyphs.size())
+			fprintf(fp, "\n%s", ii%256 == 252 ? "\n" : "");
+		else
+			fprintf(fp, ",");
+	}
+	if(fd->glyphs.size()%256)
+		fprintf(fp, "\n");
+
+	// Widths and LUT, as bytes
+	const std::vector<u8> *tables[2]= { &fd->widths, &fd->lut };
+	const char *suffix[2]= { "Widths", "CharLut" };
+	for(int it=0; it<2; it++)
+	{
+		const std::vector<u8> &tbl= *tables[it];
+		if(tbl.empty())
+			continue;
+
+		fprintf(fp, "\t.section .rodata\n");
+		fprintf(fp, "\t.align\t2\n");
+		fprintf(fp, "\t.global %s%s\t\t@ %u unsigned chars\n",
+			name, suffix[it], (uint)tbl.size());
+		fprintf(fp, "%s%s:\n", name, suffix[it]);
+		for(ii=0; ii<tbl.size(); ii++)
+		{
+			if(ii%16 == 0)
+				fprintf(fp, "\t.byte ");
+			fprintf(fp, "0x%02X", tbl[ii]);
+			if(ii%16 == 15 || ii+1 == tbl.size())
+				fprintf(fp, "\n%s", ii%128 == 127 ? "\n" : "");
+			else
+				fprintf(fp, ",");
+		}
+		if(tbl.size()%128)
+			fprintf(fp, "\n");
+	}
+
+	fprintf(fp, "@}}BLOCK(%s)\n", name);
+}
+
+static void write_cpp(FILE *fp, const TConvOpts *opts, const TRawFont *font,
+	const TFontData *fd)
+{
+	const char *name= opts->name.c_str();
+	uint ii;
+
+	fprintf(fp, "\n//{{BLOCK(%s)\n\n", name);
+	fprintf(fp, "// %s, %s to %s, %dbpp%s\n", font->name.c_str(),
+		code_str(fd->charOffset).c_str(),
+		code_str(fd->charOffset + (fd->lut.empty() ? fd->charCount : fd->lut.size()) - 1).c_str(),
+		opts->bpp, opts->lz77 ? ", LZ77" : "");
+	if(opts->lz77)
+	{
+		fprintf(fp, "// The glyphs are compressed: decompress %sGlyphsLz to\n", name);
+		fprintf(fp, "// %u bytes of RAM with LZ77UnCompWram() and set %sFont.data\n", fd->rawSize, name);
+		fprintf(fp, "// to it before use.\n");
+	}
+	fprintf(fp, "// To use: extern %sTFont %sFont;\n", opts->lz77 ? "" : "const ", name);
+	fprintf(fp, "\n#include \"tonc_tte.hpp\"\n\n");
+
+	fprintf(fp, "extern const unsigned int %sGlyphs%s[%u] __attribute__((aligned(4)))=\n{\n",
+		name, opts->lz77 ? "Lz" : "", (uint)fd->glyphs.size()/4);
+	for(ii=0; ii<fd->glyphs.size(); ii += 4)
+	{
+		const u8 *src= &fd->glyphs[ii];
+		fprintf(fp, "%s0x%08X,", ii%32 == 0 ? "\t" : "",
+			src[0] | src[1]<<8 | src[2]<<16 | src[3]<<24);
+		if(ii%32 == 28 || ii+4 >= fd->glyphs.size())
+			fprintf(fp, "\n%s", ii%256 == 252 && ii+4 < fd->glyphs.size() ? "\n" : "");
+	}
+	fprintf(fp, "};\n\n");
+
+	const std::vector<u8> *tables[2]= { &fd->widths, &fd->lut };
+	const char *suffix[2]= { "Widths", "CharLut" };
+	for(int it=0; it<2; it++)
+	{
+		const std::vector<u8> &tbl= *tables[it];
+		if(tbl.empty())
+			continue;
+
+		fprintf(fp, "extern const unsigned char %s%s[%u] __attribute__((aligned(4)))=\n{\n",
+			name, suffix[it], (uint)tbl.size());
+		for(ii=0; ii<tbl.size(); ii++)
+		{
+			fprintf(fp, "%s0x%02X,", ii%16 == 0 ? "\t" : "", tbl[ii]);
+			if(ii%16 == 15 || ii+1 == tbl.size())
+				fprintf(fp, "\n%s", ii%128 == 127 && ii+1 < tbl.size() ? "\n" : "");
+		}
+		fprintf(fp, "};\n\n");
+	}
+
+	fprintf(fp, "%sTFont %sFont=\n{\n", opts->lz77 ? "" : "extern const ", name);
+	if(opts->lz77)
+		fprintf(fp, "\tNULL, ");
+	else
+		fprintf(fp, "\t%sGlyphs, ", name);
+	if(fd->widths.empty())
+		fprintf(fp, "NULL, NULL,\n");
+	else
+		fprintf(fp, "%sWidths, NULL,\n", name);
+	fprintf(fp, "\t%u, %u,\n", fd->charOffset, fd->charCount);
+	fprintf(fp, "\t%u, %u,\n", fd->charW, fd->charH);
+	fprintf(fp, "\t%u, %u,\n", fd->cellW, fd->cellH);
+	fprintf(fp, "\t%u,\n", fd->cellSize);
+	fprintf(fp, "\t%u, 0\n};\n\n", opts->bpp);
+
+	fprintf(fp, "//}}BLOCK(%s)\n", name);
+}
+
+
+int main(int argc, char *argv[])
+{
+	TConvOpts opts;
+	TRawFont font;
+	TFontData fd;
+	std::string err;
+
+	parse_args(argc, argv, &opts);
+
+	bool ok;
+	if(ends_with(opts.inPath, ".png") || ends_with(opts.inPath, ".PNG"))
+	{
+		if(opts.grid.cellW == 0)
+			fail("PNG sheets need a grid size (-c WxH)", NULL);
+		ok= png_load(opts.inPath, &opts.grid, &font, &err);
+	}
+	else
+		ok= bdf_load(opts.inPath, &font, &err);
+	if(!ok)
+		fail(err.c_str(), opts.inPath);
+
+	if(font.name.empty())
+		font.name= opts.name;
+	if(opts.shadow)
+		add_shadow(&font);
+	if(opts.trim)
+		trim_rows(&font);
+
+	convert(&opts, &font, &fd);
+
+	FILE *fp= stdout;
+	if(opts.outPath && strcmp(opts.outPath, "-") != 0)
+	{
+		fp= fopen(opts.outPath, "w");
+		if(fp == NULL)
+			fail("can't write", opts.outPath);
+	}
+
+	if(opts.cpp)
+		write_cpp(fp, &opts, &font, &fd);
+	else
+		write_asm(fp, &opts, &font, &fd);
+
+	if(fp != stdout)
+		fclose(fp);
+
+	fprintf(stderr, "%s: %u glyphs, %ux%u in %ux%u cells, %u bytes%s\n",
+		opts.name.c_str(), fd.charCount, fd.charW, fd.charH, fd.cellW,
+		fd.cellH, (uint)fd.glyphs.size(), fd.lut.empty() ? "" : ", LUT");
+	return 0;
+}
+
+// EOF
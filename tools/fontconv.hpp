@@ -0,0 +1,76 @@
+//
+// Font converter: shared types
+//
+//! \file fontconv.hpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * Host-side; this is built with the system compiler, not devkitARM.
+	See fontconv.cpp for usage.
+*/
+
+#ifndef TONC_FONTCONV
+#define TONC_FONTCONV
+
+#include <string>
+#include <vector>
+
+typedef unsigned char	u8;
+typedef unsigned short	u16;
+typedef unsigned int	u32;
+typedef unsigned int	uint;
+
+
+// --------------------------------------------------------------------
+// CLASSES
+// --------------------------------------------------------------------
+
+
+//! A glyph as loaded, before it's packed into cells.
+/*!	Pixels are 0 for background, 1 for ink and 2 for shadow, which
+	are the nibbles the b4 renderers take. All glyphs of a font are
+	TRawFont.lineH pixels high, with the baseline in the same place.
+*/
+struct TRawGlyph
+{
+	uint	code;				//!< Code point.
+	int		advance;			//!< Pen advance, in pixels.
+	int		width;				//!< Width of the pixel box.
+	std::vector<u8>	pixels;		//!< width*lineH pixels, row by row.
+};
+
+//! A font as loaded.
+struct TRawFont
+{
+	std::string	name;			//!< Description for the output.
+	int		lineH;				//!< Height of all pixel boxes.
+	std::vector<TRawGlyph>	glyphs;
+};
+
+//! How to cut a font image into glyphs.
+struct TGridInfo
+{
+	int		cellW, cellH;		//!< Size of a grid cell.
+	uint	first;				//!< Code point of the top-left cell.
+	bool	fixed;				//!< Advance is cellW, not the ink width.
+	int		spacing;			//!< Space after the ink of a VWF glyph.
+	int		spaceW;				//!< Advance of empty VWF glyphs.
+};
+
+
+// --------------------------------------------------------------------
+// PROTOTYPES
+// --------------------------------------------------------------------
+
+
+bool bdf_load(const char *path, TRawFont *font, std::string *err);
+bool png_load(const char *path, const TGridInfo *grid, TRawFont *font,
+	std::string *err);
+
+bool inflate_zlib(const u8 *src, uint size, std::vector<u8> *dst);
+void lz77_compress(const u8 *src, uint size, std::vector<u8> *dst);
+
+#endif // TONC_FONTCONV
+
+// EOF
@@ -0,0 +1,354 @@
+//
+// Font converter: BDF and PNG loaders
+//
+//! \file fontconv_load.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * BDF glyphs are placed on a common baseline at FONT_ASCENT; parts
+	that stick out of the font's ascent/descent or left of the origin
+	are clipped.
+  * PNG sheets are a grid of cells in code-point order, like the ones
+	the existing fonts were made from. The top-left pixel is the
+	background. With a palette, the other indices are used as they are,
+	so an (ink, shadow) = (1, 2) sheet comes out the way the b4
+	renderers want it. Without one, pixels far from the background are
+	ink and pixels somewhat away from it are shadow.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fontconv.hpp"
+
+
+// --------------------------------------------------------------------
+// BDF
+// --------------------------------------------------------------------
+
+
+//! Load a BDF font.
+bool bdf_load(const char *path, TRawFont *font, std::string *err)
+{
+	FILE *fp= fopen(path, "r");
+	if(fp == NULL)
+	{
+		*err= "can't open file";
+		return false;
+	}
+
+	char line[1024], key[64];
+	int ascent= -1, descent= -1, bbw=0, bbh=0, bbx=0, bby=0;
+	int code= -1, advance= 0, gw=0, gh=0, gx=0, gy=0, row= -1;
+	TRawGlyph glyph;
+
+	font->glyphs.clear();
+	font->lineH= 0;
+
+	while(fgets(line, sizeof(line), fp))
+	{
+		if(row >= 0)
+		{
+			// Bitmap rows: hex, MSB is the leftmost pixel
+			if(strncmp(line, "ENDCHAR", 7) == 0)
+			{
+				if(code >= 0)
+					font->glyphs.push_back(glyph);
+				row= -1;
+				continue;
+			}
+
+			int py= ascent - (gy+gh) + row++;
+			if(py < 0 || py >= font->lineH)
+				continue;
+
+			int ix, px;
+			for(ix=0; ix<gw; ix++)
+			{
+				char hex[2]= { line[ix/4], 0 };
+				if(!hex[0] || !(strtol(hex, NULL, 16) & 8>>(ix%4)))
+					continue;
+				px= gx+ix;
+				if(px >= 0 && px < glyph.width)
+					glyph.pixels[py*glyph.width + px]= 1;
+			}
+			continue;
+		}
+
+		if(sscanf(line, "%63s", key) != 1)
+			continue;
+
+		if(strcmp(key, "FONT") == 0)
+		{
+			line[strcspn(line, "\r\n")]= '\0';
+			font->name= &line[5];
+		}
+		else if(strcmp(key, "FONTBOUNDINGBOX") == 0)
+			sscanf(line, "%*s %d %d %d %d", &bbw, &bbh, &bbx, &bby);
+		else if(strcmp(key, "FONT_ASCENT") == 0)
+			sscanf(line, "%*s %d", &ascent);
+		else if(strcmp(key, "FONT_DESCENT") == 0)
+			sscanf(line, "%*s %d", &descent);
+		else if(strcmp(key, "STARTCHAR") == 0)
+		{
+			code= -1;
+			advance= bbw;
+			gw= bbw;	gh= bbh;	gx= bbx;	gy= bby;
+		}
+		else if(strcmp(key, "ENCODING") == 0)
+			sscanf(line, "%*s %d", &code);
+		else if(strcmp(key, "DWIDTH") == 0)
+			sscanf(line, "%*s %d", &advance);
+		else if(strcmp(key, "BBX") == 0)
+			sscanf(line, "%*s %d %d %d %d", &gw, &gh, &gx, &gy);
+		else if(strcmp(key, "BITMAP") == 0)
+		{
+			if(font->lineH == 0)
+			{
+				// No properties: use the bounding box
+				if(ascent < 0)	ascent= bbh+bby;
+				if(descent < 0)	descent= -bby;
+				font->lineH= ascent+descent;
+				if(font->lineH <= 0)
+				{
+					*err= "no font height";
+					fclose(fp);
+					return false;
+				}
+			}
+
+			glyph.code= code;
+			glyph.advance= advance;
+			glyph.width= advance > gx+gw ? advance : gx+gw;
+			if(glyph.width < 0)
+				glyph.width= 0;
+			glyph.pixels.assign(glyph.width*font->lineH, 0);
+			row= 0;
+		}
+	}
+	fclose(fp);
+
+	if(font->glyphs.empty())
+	{
+		*err= "no glyphs";
+		return false;
+	}
+	return true;
+}
+
+
+// --------------------------------------------------------------------
+// PNG
+// --------------------------------------------------------------------
+
+
+static u32 png_u32(const u8 *src)
+{
+	return src[0]<<24 | src[1]<<16 | src[2]<<8 | src[3];
+}
+
+static int png_paeth(int a, int b, int c)
+{
+	int p= a+b-c, pa= abs(p-a), pb= abs(p-b), pc= abs(p-c);
+	if(pa <= pb && pa <= pc)
+		return a;
+	return pb <= pc ? b : c;
+}
+
+//! Load a PNG font sheet.
+bool png_load(const char *path, const TGridInfo *grid, TRawFont *font,
+	std::string *err)
+{
+	// --- Read the chunks ---
+	FILE *fp= fopen(path, "rb");
+	if(fp == NULL)
+	{
+		*err= "can't open file";
+		return false;
+	}
+
+	std::vector<u8> file, idat, raw;
+	u8 buf[4096];
+	size_t count;
+	while((count= fread(buf, 1, sizeof(buf), fp)) > 0)
+		file.insert(file.end(), buf, buf+count);
+	fclose(fp);
+
+	static const u8 sig[8]= { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	if(file.size() < 8 || memcmp(&file[0], sig, 8) != 0)
+	{
+		*err= "not a PNG file";
+		return false;
+	}
+
+	uint width=0, height=0, depth=0, type=0, pos= 8;
+	bool interlaced= false;
+	while(pos+12 <= file.size())
+	{
+		uint len= png_u32(&file[pos]);
+		const u8 *data= &file[pos+8];
+		if(pos+12+len > file.size())
+			break;
+
+		if(memcmp(&file[pos+4], "IHDR", 4) == 0 && len >= 13)
+		{
+			width= png_u32(&data[0]);
+			height= png_u32(&data[4]);
+			depth= data[8];
+			type= data[9];
+			interlaced= data[12] != 0;
+		}
+		else if(memcmp(&file[pos+4], "IDAT", 4) == 0)
+			idat.insert(idat.end(), data, data+len);
+		else if(memcmp(&file[pos+4], "IEND", 4) == 0)
+			break;
+		pos += 12+len;
+	}
+
+	if(width == 0 || height == 0 || idat.empty())
+	{
+		*err= "broken PNG file";
+		return false;
+	}
+	if(interlaced)
+	{
+		*err= "interlaced PNGs aren't supported";
+		return false;
+	}
+
+	// --- Unfilter ---
+	static const u8 chans[7]= { 1, 0, 3, 1, 2, 0, 4 };
+	uint nchan= type < 7 ? chans[type] : 0;
+	if(nchan == 0 || (depth < 8 && type != 0 && type != 3))
+	{
+		*err= "unsupported PNG format";
+		return false;
+	}
+
+	uint bpp= (nchan*depth+7)/8;				// Filter step, in bytes
+	uint pitch= (width*nchan*depth+7)/8;
+	if(!inflate_zlib(&idat[0], idat.size(), &raw) ||
+		raw.size() < (pitch+1)*height)
+	{
+		*err= "broken PNG data";
+		return false;
+	}
+
+	std::vector<u8> img(pitch*height);
+	uint ix, iy;
+	for(iy=0; iy<height; iy++)
+	{
+		const u8 *srcL= &raw[iy*(pitch+1)];
+		u8 *dstL= &img[iy*pitch], *prevL= iy ? dstL-pitch : NULL;
+		for(ix=0; ix<pitch; ix++)
+		{
+			int a= ix >= bpp ? dstL[ix-bpp] : 0;
+			int b= prevL ? prevL[ix] : 0;
+			int c= prevL && ix >= bpp ? prevL[ix-bpp] : 0;
+			int x= srcL[ix+1];
+			switch(srcL[0])
+			{
+			case 1:		x += a;						break;
+			case 2:		x += b;						break;
+			case 3:		x += (a+b)/2;				break;
+			case 4:		x += png_paeth(a, b, c);	break;
+			}
+			dstL[ix]= x;
+		}
+	}
+
+	// --- Pixels to ink/shadow ---
+	// Value per pixel: index or gray level, alpha separate.
+	std::vector<int> value(width*height), alpha(width*height, 255);
+	for(iy=0; iy<height; iy++)
+	{
+		const u8 *srcL= &img[iy*pitch];
+		for(ix=0; ix<width; ix++)
+		{
+			uint ii= iy*width+ix, step= depth/8;
+			if(depth < 8)
+			{
+				uint bit= ix*depth;
+				value[ii]= srcL[bit/8]>>(8-depth-bit%8) & ((1<<depth)-1);
+				if(type == 0)
+					value[ii]= value[ii]*255/((1<<depth)-1);
+				continue;
+			}
+
+			const u8 *px= &srcL[ix*nchan*step];
+			if(type == 0 || type == 3 || type == 4)
+				value[ii]= px[0];
+			else
+				value[ii]= (px[0]*77 + px[step]*150 + px[2*step]*29)>>8;
+
+			if(type == 4)
+				alpha[ii]= px[step];
+			else if(type == 6)
+				alpha[ii]= px[3*step];
+		}
+	}
+
+	// --- Cut into glyphs ---
+	int cellW= grid->cellW, cellH= grid->cellH;
+	uint cols= width/cellW, rows= height/cellH;
+	if(cols == 0 || rows == 0)
+	{
+		*err= "image smaller than a cell";
+		return false;
+	}
+
+	int bg= value[0], bgAlpha= alpha[0];
+	font->lineH= cellH;
+	font->glyphs.clear();
+
+	uint gid;
+	int cx, cy;
+	for(gid=0; gid<cols*rows; gid++)
+	{
+		TRawGlyph glyph;
+		glyph.code= grid->first+gid;
+		glyph.width= cellW;
+		glyph.pixels.assign(cellW*cellH, 0);
+
+		int right= 0;
+		for(cy=0; cy<cellH; cy++)
+		{
+			for(cx=0; cx<cellW; cx++)
+			{
+				uint ii= (gid/cols*cellH + cy)*width + gid%cols*cellW + cx;
+				int px= 0;
+				if(alpha[ii] < 128)
+					px= 0;
+				else if(type == 3)
+					px= value[ii] == bg ? 0 : (value[ii] > 15 ? 15 : value[ii]);
+				else
+				{
+					int diff= abs(value[ii]-bg);
+					if(bgAlpha < 128)
+						diff= 255;
+					px= diff >= 128 ? 1 : (diff >= 48 ? 2 : 0);
+				}
+
+				glyph.pixels[cy*cellW+cx]= px;
+				if(px && cx+1 > right)
+					right= cx+1;
+			}
+		}
+
+		// The renderers take the advance as the number of pixels to
+		// draw, so it can't go past the cell.
+		if(grid->fixed)
+			glyph.advance= cellW;
+		else
+			glyph.advance= right ? right+grid->spacing : grid->spaceW;
+		if(glyph.advance > cellW)
+			glyph.advance= cellW;
+		font->glyphs.push_back(glyph);
+	}
+
+	return true;
+}
+
+// EOF
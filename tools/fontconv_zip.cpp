@@ -0,0 +1,337 @@
+//
+// Font converter: inflate for PNGs, LZ77 for the GBA BIOS
+//
+//! \file fontconv_zip.cpp
+//! \author J Vijn
+//! \date 20261018 - 20261018
+//
+/* === NOTES ===
+  * The inflater follows the canonical-Huffman decoder of zlib's puff;
+	small and slow, which is plenty for font sheets.
+  * The LZ77 output is what LZ77UnCompWram/Vram want. Matches never
+	refer to the byte just before, so the VRAM version can take it.
+*/
+
+#include <string.h>
+
+#include "fontconv.hpp"
+
+
+// --------------------------------------------------------------------
+// INFLATE
+// --------------------------------------------------------------------
+
+
+struct TInflate
+{
+	const u8 *src;
+	uint	size, pos;
+	u32		bitbuf;
+	uint	bitcnt;
+	bool	error;
+	std::vector<u8> *dst;
+};
+
+//! Canonical Huffman table: code counts per length, then symbols.
+struct THuff
+{
+	short	count[16];
+	short	symbol[288];
+};
+
+static const short cLenBase[29]=
+{
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const short cLenExtra[29]=
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const short cDistBase[30]=
+{
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+	8193, 12289, 16385, 24577
+};
+static const short cDistExtra[30]=
+{
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+
+static uint inf_bits(TInflate *inf, uint count)
+{
+	while(inf->bitcnt < count)
+	{
+		if(inf->pos >= inf->size)
+		{
+			inf->error= true;
+			return 0;
+		}
+		inf->bitbuf |= (u32)inf->src[inf->pos++] << inf->bitcnt;
+		inf->bitcnt += 8;
+	}
+	uint val= inf->bitbuf & ((1<<count)-1);
+	inf->bitbuf >>= count;
+	inf->bitcnt -= count;
+	return val;
+}
+
+static void huff_build(THuff *huff, const short *lengths, uint count)
+{
+	short offs[16];
+	uint ii;
+
+	memset(huff->count, 0, sizeof(huff->count));
+	for(ii=0; ii<count; ii++)
+		huff->count[lengths[ii]]++;
+	huff->count[0]= 0;
+
+	offs[1]= 0;
+	for(ii=1; ii<15; ii++)
+		offs[ii+1]= offs[ii] + huff->count[ii];
+	for(ii=0; ii<count; ii++)
+		if(lengths[ii])
+			huff->symbol[offs[lengths[ii]]++]= ii;
+}
+
+static int huff_decode(TInflate *inf, const THuff *huff)
+{
+	int code=0, first=0, index=0, len;
+	for(len=1; len<16; len++)
+	{
+		code |= inf_bits(inf, 1);
+		int count= huff->count[len];
+		if(code - count < first)
+			return huff->symbol[index + code - first];
+		index += count;
+		first= (first+count)<<1;
+		code <<= 1;
+	}
+	inf->error= true;
+	return -1;
+}
+
+static bool inf_codes(TInflate *inf, const THuff *lens, const THuff *dists)
+{
+	int sym;
+	while(!inf->error)
+	{
+		sym= huff_decode(inf, lens);
+		if(sym < 0)
+			return false;
+		if(sym < 256)
+			inf->dst->push_back(sym);
+		else if(sym == 256)
+			return true;
+		else
+		{
+			sym -= 257;
+			if(sym >= 29)
+				return false;
+			uint len= cLenBase[sym] + inf_bits(inf, cLenExtra[sym]);
+
+			sym= huff_decode(inf, dists);
+			if(sym < 0 || sym >= 30)
+				return false;
+			uint dist= cDistBase[sym] + inf_bits(inf, cDistExtra[sym]);
+			if(dist > inf->dst->size())
+				return false;
+
+			while(len--)
+				inf->dst->push_back((*inf->dst)[inf->dst->size()-dist]);
+		}
+	}
+	return false;
+}
+
+static bool inf_stored(TInflate *inf)
+{
+	inf->bitbuf= 0;
+	inf->bitcnt= 0;
+	if(inf->pos+4 > inf->size)
+		return false;
+
+	uint len= inf->src[inf->pos] | inf->src[inf->pos+1]<<8;
+	uint nlen= inf->src[inf->pos+2] | inf->src[inf->pos+3]<<8;
+	inf->pos += 4;
+	if(len != (~nlen & 0xFFFF) || inf->pos+len > inf->size)
+		return false;
+
+	inf->dst->insert(inf->dst->end(), &inf->src[inf->pos],
+		&inf->src[inf->pos+len]);
+	inf->pos += len;
+	return true;
+}
+
+static bool inf_fixed(TInflate *inf)
+{
+	short lengths[288+30];
+	THuff lens, dists;
+	uint ii;
+
+	for(ii=0; ii<144; ii++)		lengths[ii]= 8;
+	for(   ; ii<256; ii++)		lengths[ii]= 9;
+	for(   ; ii<280; ii++)		lengths[ii]= 7;
+	for(   ; ii<288; ii++)		lengths[ii]= 8;
+	huff_build(&lens, lengths, 288);
+
+	for(ii=0; ii<30; ii++)		lengths[ii]= 5;
+	huff_build(&dists, lengths, 30);
+
+	return inf_codes(inf, &lens, &dists);
+}
+
+static bool inf_dynamic(TInflate *inf)
+{
+	static const u8 order[19]=
+	{	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15	};
+
+	short lengths[288+30];
+	THuff lens, dists;
+	uint ii, nlen, ndist, ncode;
+
+	nlen=  inf_bits(inf, 5) + 257;
+	ndist= inf_bits(inf, 5) + 1;
+	ncode= inf_bits(inf, 4) + 4;
+	if(nlen > 286 || ndist > 30)
+		return false;
+
+	// Code-length code
+	memset(lengths, 0, sizeof(lengths));
+	for(ii=0; ii<ncode; ii++)
+		lengths[order[ii]]= inf_bits(inf, 3);
+	huff_build(&lens, lengths, 19);
+
+	// Literal/length and distance code lengths
+	for(ii=0; ii<nlen+ndist; )
+	{
+		int sym= huff_decode(inf, &lens);
+		if(sym < 0 || inf->error)
+			return false;
+		if(sym < 16)
+		{
+			lengths[ii++]= sym;
+			continue;
+		}
+
+		short len= 0;
+		uint rep;
+		if(sym == 16)
+		{
+			if(ii == 0)
+				return false;
+			len= lengths[ii-1];
+			rep= 3 + inf_bits(inf, 2);
+		}
+		else if(sym == 17)
+			rep= 3 + inf_bits(inf, 3);
+		else
+			rep= 11 + inf_bits(inf, 7);
+
+		if(ii+rep > nlen+ndist)
+			return false;
+		while(rep--)
+			lengths[ii++]= len;
+	}
+
+	huff_build(&lens, lengths, nlen);
+	huff_build(&dists, &lengths[nlen], ndist);
+
+	return inf_codes(inf, &lens, &dists);
+}
+
+
+// --------------------------------------------------------------------
+// FUNCTIONS
+// --------------------------------------------------------------------
+
+
+//! Decompress a zlib stream, like PNG's IDAT data.
+/*!	\return	false for broken streams. The checksum isn't checked.
+*/
+bool inflate_zlib(const u8 *src, uint size, std::vector<u8> *dst)
+{
+	if(size < 2 || (src[0]&15) != 8 || (src[0]<<8 | src[1]) % 31)
+		return false;
+
+	TInflate inf= { src, size, 2, 0, 0, false, dst };
+	uint last;
+
+	do
+	{
+		last= inf_bits(&inf, 1);
+		bool ok;
+		switch(inf_bits(&inf, 2))
+		{
+		case 0:		ok= inf_stored(&inf);	break;
+		case 1:		ok= inf_fixed(&inf);	break;
+		case 2:		ok= inf_dynamic(&inf);	break;
+		default:	ok= false;
+		}
+		if(!ok || inf.error)
+			return false;
+	} while(!last);
+
+	return true;
+}
+
+
+//! Compress for the BIOS LZ77 decompressors.
+/*!	Greedy, longest match first. The output has the BIOS header and
+	is padded to a word boundary.
+*/
+void lz77_compress(const u8 *src, uint size, std::vector<u8> *dst)
+{
+	dst->clear();
+	dst->push_back(0x10);
+	dst->push_back(size);
+	dst->push_back(size>>8);
+	dst->push_back(size>>16);
+
+	uint pos= 0, flagpos= 0, item= 8;
+	while(pos < size)
+	{
+		if(item == 8)
+		{
+			flagpos= dst->size();
+			dst->push_back(0);
+			item= 0;
+		}
+
+		// Find the longest match, at least 2 back for VRAM
+		uint best=0, bestDist=0, dist, len;
+		for(dist=2; dist<=4096 && dist<=pos; dist++)
+		{
+			for(len=0; len<18 && pos+len<size; len++)
+				if(src[pos+len] != src[pos+len-dist])
+					break;
+			if(len > best)
+			{
+				best= len;
+				bestDist= dist;
+				if(len == 18)
+					break;
+			}
+		}
+
+		if(best >= 3)
+		{
+			(*dst)[flagpos] |= 0x80>>item;
+			dst->push_back((best-3)<<4 | (bestDist-1)>>8);
+			dst->push_back((bestDist-1) & 255);
+			pos += best;
+		}
+		else
+			dst->push_back(src[pos++]);
+		item++;
+	}
+
+	while(dst->size()%4)
+		dst->push_back(0);
+}
+
+// EOF